@@ -19,6 +19,13 @@ class UAvoidanceManager;
 class UMovementComponent;
 class UCharacterMovementComponent;
 
+#if WITH_DEV_AUTOMATION_TESTS
+namespace UE::AI::Private
+{
+	struct FAvoidanceManagerTestUtil;
+}
+#endif
+
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Avoidance Time"),STAT_AI_ObstacleAvoidance,STATGROUP_AI, );
 
 class UAvoidanceManager;
@@ -119,6 +126,14 @@ class UAvoidanceManager : public UObject, public FSelfRegisteringExec
 	UPROPERTY(EditAnywhere, Category="Avoidance", config, meta=(ClampMin = "0.0"))
 	float HeightCheckMargin;
 
+	/** Size of the cells of the spatial grid used to find nearby avoidance objects. Works best when close to the typical avoidance consideration radius. */
+	UPROPERTY(EditAnywhere, Category="Avoidance", config, meta=(ClampMin = "1.0"))
+	float GridCellSize;
+
+	/** If set, nearby avoidance objects are found through a spatial grid instead of testing every registered object */
+	UPROPERTY(EditAnywhere, Category="Avoidance", config)
+	uint32 bUseSpatialGrid : 1;
+
 	/** Get the number of avoidance objects currently in the manager. */
 	UFUNCTION(BlueprintCallable, Category="AI")
 	ENGINE_API int32 GetObjectCount();
@@ -203,6 +218,28 @@ protected:
 	/** This is called by our blueprint-accessible functions, and permits the user to ignore self, or not. Important in case the user isn't in the avoidance manager. */
 	ENGINE_API FVector GetAvoidanceVelocity_Internal(const FNavAvoidanceData& AvoidanceData, float DeltaTime, int32 *IgnoreThisUID = NULL);
 
+	/** Avoidance solve of GetAvoidanceVelocity_Internal, using the given scratch arrays for the cones and the candidate objects */
+	ENGINE_API FVector CalculateAvoidanceVelocity(const FNavAvoidanceData& AvoidanceData, float DeltaTime, const int32* IgnoreThisUID, double CurrentTime,
+		TArray<FVelocityAvoidanceCone>& Cones, TArray<FSetElementId>& Candidates, bool bDebugMode) const;
+
+	/** Fills OutCandidates with the avoidance objects that can be within the test radius of AvoidanceData, in AvoidanceObjects order. Returns false if all objects must be tested instead. */
+	ENGINE_API bool GatherAvoidanceCandidates(const FNavAvoidanceData& AvoidanceData, TArray<FSetElementId>& OutCandidates) const;
+
+	/** Moves the object to the grid cell containing Center, adding it if needed */
+	ENGINE_API void UpdateSpatialGrid(int32 AvoidanceUID, const FVector& Center);
+
+	/** Removes the object from the spatial grid */
+	ENGINE_API void RemoveFromSpatialGrid(int32 AvoidanceUID);
+
+	/** Rebuilds the spatial grid from scratch if the cell size has changed since it was built */
+	ENGINE_API void ValidateSpatialGrid();
+
+	/** Returns the grid cell containing Location */
+	FIntPoint GetSpatialGridCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X / SpatialGridCellSize), FMath::FloorToInt32(Location.Y / SpatialGridCellSize));
+	}
+
 	/** All objects currently part of the avoidance solution. This is pretty transient stuff. */
 	TMap<int32, FNavAvoidanceData> AvoidanceObjects;
 
@@ -212,6 +249,18 @@ protected:
 	/** Keeping this here to avoid constant allocation */
 	TArray<FVelocityAvoidanceCone> AllCones;
 
+	/** Keeping this here to avoid constant allocation */
+	TArray<FSetElementId> AllCandidates;
+
+	/** Spatial grid of the live avoidance objects, cell coordinates to UIDs. Updated along with AvoidanceObjects. */
+	TMap<FIntPoint, TArray<int32>> SpatialGrid;
+
+	/** Grid cell of every avoidance object in SpatialGrid */
+	TMap<int32, FIntPoint> SpatialGridObjectCells;
+
+	/** Cell size SpatialGrid was built with */
+	float SpatialGridCellSize;
+
 	/** Provider of navigation edges to consider for avoidance */
 	TWeakObjectPtr<UObject> EdgeProviderOb;
 	INavEdgeProviderInterface* EdgeProviderInterface;
@@ -235,4 +284,8 @@ protected:
 	/** main switch for avoidance system */
 	static ENGINE_API bool bSystemActive;
 #endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+	friend UE::AI::Private::FAvoidanceManagerTestUtil;
+#endif
 };
@@ -39,16 +39,40 @@ class UCurveFloat : public UCurveBase
 	UPROPERTY()
 	bool	bIsEventCurve;
 
+	/** If set, GetFloatValues looks values up in uniform samples of the curve instead of evaluating the keys, see FRichCurve::EnableBakedEvaluation */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category="Evaluation")
+	bool	bUseBakedEvaluation = false;
+
+	/** Max error allowed between the baked samples and the curve */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category="Evaluation", meta=(EditCondition="bUseBakedEvaluation", ClampMin="0.000001"))
+	float	BakedEvaluationErrorTolerance = 0.001f;
+
 	/** Evaluate this float curve at the specified time */
 	UFUNCTION(BlueprintCallable, Category="Math|Curves")
 	ENGINE_API float GetFloatValue(float InTime) const;
 
+	/** Evaluate this float curve at each of the specified times */
+	ENGINE_API void GetFloatValues(TArrayView<const float> InTimes, TArrayView<float> OutValues) const;
+
 	// Begin FCurveOwnerInterface
 	ENGINE_API virtual TArray<FRichCurveEditInfoConst> GetCurves() const override;
 	ENGINE_API virtual TArray<FRichCurveEditInfo> GetCurves() override;
 	ENGINE_API virtual bool IsValidCurve( FRichCurveEditInfo CurveInfo ) override;
+#if WITH_EDITOR
+	ENGINE_API virtual void OnCurveChanged(const TArray<FRichCurveEditInfo>& ChangedCurveEditInfos) override;
+#endif
+
+	// Begin UObject interface
+	ENGINE_API virtual void PostLoad() override;
+#if WITH_EDITOR
+	ENGINE_API virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 
 	/** Determine if Curve is the same */
 	ENGINE_API bool operator == (const UCurveFloat& Curve) const;
+
+private:
+	/** Applies the baked evaluation settings to FloatCurve */
+	void UpdateBakedEvaluation();
 };
 
@@ -192,6 +192,27 @@ struct TStructOpsTypeTraits<FRichCurveKey>
 };
 
 
+struct FRichCurveBakedEvaluation;
+
+/**
+ * Owns the baked evaluation of a FRichCurve, see FRichCurve::EnableBakedEvaluation.
+ * Only allocated once baked evaluation is enabled, so other curves just carry a null pointer. Copies keep the settings but build their own samples.
+ */
+struct FRichCurveBakedEvaluationPtr
+{
+	FRichCurveBakedEvaluationPtr() = default;
+	ENGINE_API FRichCurveBakedEvaluationPtr(const FRichCurveBakedEvaluationPtr& Other);
+	ENGINE_API FRichCurveBakedEvaluationPtr(FRichCurveBakedEvaluationPtr&& Other);
+	ENGINE_API FRichCurveBakedEvaluationPtr& operator=(const FRichCurveBakedEvaluationPtr& Other);
+	ENGINE_API FRichCurveBakedEvaluationPtr& operator=(FRichCurveBakedEvaluationPtr&& Other);
+	ENGINE_API ~FRichCurveBakedEvaluationPtr();
+
+	/** Frees the samples, they are rebuilt on the next batched evaluation. Must not be called while the curve is being evaluated. */
+	ENGINE_API void Invalidate();
+
+	TUniquePtr<FRichCurveBakedEvaluation> Evaluation;
+};
+
 /** A rich, editable float curve */
 USTRUCT()
 struct FRichCurve
@@ -309,6 +330,31 @@ public:
 	/** Evaluate this rich curve at the specified time */
 	ENGINE_API virtual float Eval(float InTime, float InDefaultValue = 0.0f) const final override;
 
+	/**
+	 * Evaluate this rich curve at each of the specified times.
+	 * When baked evaluation is enabled, times between the first and last key are looked up in the baked samples, which are built on first use.
+	 */
+	ENGINE_API void Eval(TArrayView<const float> InTimes, TArrayView<float> OutValues, float InDefaultValue = 0.0f) const;
+
+	/**
+	 * Enable baked evaluation for the batched Eval. The curve is resampled uniformly between its first and last key,
+	 * with as few samples as needed for linear interpolation between them to stay within ErrorTolerance of the curve.
+	 * Curves that would need more than MaxSamples keep being evaluated exactly.
+	 */
+	ENGINE_API void EnableBakedEvaluation(float ErrorTolerance = 0.001f, int32 MaxSamples = 4096);
+
+	/** Disable baked evaluation and free the baked samples */
+	ENGINE_API void DisableBakedEvaluation();
+
+	/** Returns whether the batched Eval uses baked samples */
+	bool IsBakedEvaluationEnabled() const { return BakedEvaluation.Evaluation.IsValid(); }
+
+	/**
+	 * Free the baked samples so they are rebuilt from the current keys.
+	 * Key functions of this curve already do this, it is only needed after modifying the values of existing Keys directly.
+	 */
+	void InvalidateBakedEvaluation() { BakedEvaluation.Invalidate(); }
+
 	/** Auto set tangents for any 'auto' keys in curve */
 	ENGINE_API void AutoSetTangents(float Tension = 0.f);
 
@@ -343,6 +389,9 @@ private:
 	ENGINE_API void RemoveRedundantKeysInternal(float Tolerance, int32 InStartKeepKey, int32 InEndKeepKey, FFrameRate SampleRate);
 	ENGINE_API virtual int32 GetKeyIndex(float KeyTime, float KeyTimeTolerance) const override final;
 
+	/** Baked evaluation settings and samples, not serialized */
+	FRichCurveBakedEvaluationPtr BakedEvaluation;
+
 public:
 
 	// FIndexedCurve interface
@@ -10,6 +10,7 @@
 #include "UObject/Class.h"
 #include "UObject/UnrealType.h"
 #include "UObject/PropertyPortFlags.h"
+#include "Serialization/BulkData.h"
 #include "DataTableUtils.h"
 #include "DataTable.generated.h"
 
@@ -19,6 +20,7 @@ struct FDataTableEditorUtils;
 class UGameplayTagTableManager;
 class FDataTableImporterCSV;
 class FDataTableImporterJSON;
+struct FDataTableBinaryRowsTestUtil;
 template <class CharType> struct TPrettyJsonPrintPolicy;
 
 // forward declare JSON writer
@@ -79,6 +81,9 @@ class UDataTable
 	friend UGameplayTagTableManager;
 	friend FDataTableImporterCSV;
 	friend FDataTableImporterJSON;
+#if WITH_DEV_AUTOMATION_TESTS
+	friend FDataTableBinaryRowsTestUtil;
+#endif
 
 	/** Structure to use for each row of the table, must inherit from FTableRowBase */
 	UPROPERTY(VisibleAnywhere, Category=DataTable, meta=(DisplayThumbnail="false"))
@@ -96,6 +101,15 @@ protected:
 
 	/** Deletes the row memory */
 	ENGINE_API virtual void RemoveRowInternal(FName RowName);
+
+	/** Rows loaded from binary row storage share this single allocation, they are destroyed but never freed individually. */
+	uint8* RowBlock = nullptr;
+	SIZE_T RowBlockSize = 0;
+
+	bool IsRowInRowBlock(const uint8* RowData) const { return RowData >= RowBlock && RowData < RowBlock + RowBlockSize; }
+
+	/** Packed row records of a table using binary row storage, only holds data while the table is being saved or loaded. */
+	FByteBulkData BinaryRowBulkData;
 public:
 
 	virtual const TMap<FName, uint8*>& GetRowMap() const { return RowMap; }
@@ -110,6 +124,14 @@ public:
 	UPROPERTY(EditAnywhere, Category=DataTable)
 	uint8 bStripFromClientBuilds : 1;
 
+	/**
+	 * Set to true to cook the rows as a single block of packed binary records rather than as tagged properties, which is memory mapped on load
+	 * and unpacked into one allocation for all rows. Only used when every property of the row struct is plain data (numbers, enums, bools and
+	 * structs made of those) and it has no custom serializer, other tables are cooked as usual.
+	 */
+	UPROPERTY(EditAnywhere, Category=DataTable, AdvancedDisplay)
+	uint8 bUseBinaryRowStorage : 1;
+
 	/** Set to true to ignore extra fields in the import data, if false it will warn about them */
 	UPROPERTY(EditAnywhere, Category=ImportOptions)
 	uint8 bIgnoreExtraFields : 1;
@@ -392,6 +414,11 @@ protected:
 	void SaveStructData(FStructuredArchiveSlot Slot);
 	void LoadStructData(FStructuredArchiveSlot Slot);
 
+	/** Whether the rows can be saved as packed binary records, see bUseBinaryRowStorage. */
+	bool CanUseBinaryRowStorage() const;
+	void SaveBinaryRowData(FStructuredArchiveRecord Record);
+	void LoadBinaryRowData(FStructuredArchiveRecord Record);
+
 	/**
 	 * Called whenever new data is imported into the data table via CreateTableFrom*; Alerts each imported row and gives the
 	 * row struct a chance to operate on the imported data
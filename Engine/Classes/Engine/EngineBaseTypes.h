@@ -253,6 +253,9 @@ private:
 		/** Cache whether this function was rescheduled as an interval function during StartParallel */
 		bool bWasInterval:1;
 
+		/** Whether TaskPointer refers to a shared tick batch task rather than a task for this function alone */
+		bool bIsBatched:1;
+
 		/** Internal data that indicates the tick group we actually started in (it may have been delayed due to prerequisites) **/
 		TEnumAsByte<enum ETickingGroup> ActualStartTickGroup;
 
@@ -648,6 +648,8 @@ public:
 	EIncrementalComponentState					IncrementalComponentState;
 	/** Current index into actors array for updating components.							*/
 	int32										CurrentActorIndexForIncrementalUpdate;
+	/** Actors before this index have already had their component registration prepared, see s.ParallelComponentRegistrationBatchSize. */
+	int32										PreparedActorIndexForIncrementalUpdate;
 	/** Current index into actors array for updating components.							*/
 	int32										CurrentActorIndexForUnregisterComponents;
 
@@ -1379,6 +1381,8 @@ public:
 
 private:
 	bool IncrementalRegisterComponents(bool bPreRegisterComponents, int32 NumComponentsToUpdate, FRegisterComponentContext* Context);
+	/** Does the thread safe part of registering the components of the actors up to EndActorIndex in parallel, ahead of them being registered. */
+	void PrepareComponentRegistration(int32 EndActorIndex);
 #if WITH_EDITOR
 	bool IncrementalRunConstructionScripts(bool bProcessAllActors);
 	TOptional<bool> bCachedHasStaticMeshCompilationPending;
@@ -484,6 +484,16 @@ public:
 	/** The singleton buffer for sending bunch header information */
 	FBitWriter		SendBunchHeader;
 
+	/** Data bits of LastOut left in the send buffer by PopLastStartForMerge, for SendRawBunch to merge the bunch in place. INDEX_NONE when not merging. */
+	int64			InPlaceMergeBits = INDEX_NONE;
+	/**
+	 * Identifies the bunch PopLastStartForMerge was called for: channel index, sequence and size of LastOut once merged. Only that bunch is merged in place,
+	 * anything else written first pops the bits left in the buffer. The size tells it apart from the partial bunches it's split into when too large.
+	 */
+	int32			InPlaceMergeChIndex = INDEX_NONE;
+	int32			InPlaceMergeChSequence = 0;
+	int64			InPlaceMergeBunchBits = 0;
+
 	// Stat display.
 	/** Time of last stat update */
 	double			StatUpdateTime;
@@ -1182,6 +1192,15 @@ public:
 	/** Pops the LastStart bits off of the send buffer, used for merging bunches */
 	void PopLastStart();
 
+	/**
+	 * Used instead of PopLastStart when LastOut is about to be sent again with more bits appended. With net.MergeBunchesInPlace enabled the bits are left
+	 * in the send buffer, and SendRawBunch only rewrites the bunch header and appends the bits after NumMergedBits rather than writing the whole bunch again.
+	 */
+	void PopLastStartForMerge(int64 NumMergedBits);
+
+	/** Pops the bits left in the send buffer by PopLastStartForMerge if the merged bunch wasn't sent again yet */
+	void CancelInPlaceMerge();
+
 	/**
 	 * returns whether the client has initialized the given level
 	 * @return true if the client has initialized the given level, false otherwise
@@ -1640,6 +1659,15 @@ private:
 		const int32		ExtraSizeInBits,
 		EWriteBitsDataType DataType =  EWriteBitsDataType::Unknown);
 
+	/** Merges a bunch into the one at LastStart left in the send buffer by PopLastStartForMerge: overwrites its header, which must be the same size,
+		and appends the bunch bits past NumMergedBits. The appended bits must fit in the packet. */
+	int32 WriteMergedBunchToSendBufferInternal(
+		const uint8 *	HeaderBits,
+		const int32		HeaderSizeInBits,
+		const uint8 *	BunchBits,
+		const int64		NumMergedBits,
+		const int32		BunchSizeInBits);
+
 	/**
 	 * on the server, the world the client has told us it has loaded
 	 * used to make sure the client has traveled correctly, prevent replicating actors before level transitions are done, etc
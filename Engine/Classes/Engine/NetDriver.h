@@ -345,6 +345,7 @@ class UNetDriver;
 class UActorChannel;
 class PacketHandler;
 struct FReplicatedStaticActorDestructionInfo;
+struct FPrioritizedConnectionActors;
 
 enum class ECreateReplicationChangelistMgrFlags;
 enum class EEngineNetworkRuntimeFeatures : uint16;
@@ -2007,6 +2008,9 @@ protected:
 
 	// Actor prioritization
 	ENGINE_API int32 ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*>& ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors );
+
+	// Thread safe actor prioritization used by net.ParallelPrioritizeActors. Channel side effects are deferred into OutPrioritized for the game thread to apply.
+	void ServerReplicateActors_PrioritizeActorsForConnection( UNetConnection* Connection, const TArray<FNetworkObjectInfo*>& ConsiderList, FPrioritizedConnectionActors& OutPrioritized ) const;
 	
 	UE_DEPRECATED(5.3, "This function has been deprecated. Please use ServerReplicateActors_ProcessPrioritizedActorsRange instead")
 	int32 ServerReplicateActors_ProcessPrioritizedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated );
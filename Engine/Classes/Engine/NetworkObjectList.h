@@ -84,6 +84,9 @@ struct FNetworkObjectInfo
 	/** Force this object to be considered relevant for at least one update */
 	uint32 ForceRelevantFrame = 0;
 
+	/** Serial of this object's latest entry in the FNetworkObjectList update schedule, older entries are ignored */
+	uint32 UpdateScheduleSerial = 0;
+
 	FNetworkObjectInfo()
 		: Actor(nullptr)
 		, NextUpdateTime(0.0)
@@ -222,6 +225,24 @@ public:
 
 	/** Force this actor to be relevant for at least one update */
 	ENGINE_API void ForceActorRelevantNextUpdate(AActor* const Actor, UNetDriver* NetDriver);
+
+	/**
+	 * Enables the time bucketed schedule of active objects by NextUpdateTime, which lets GatherDueActiveObjects only touch the objects due for an update
+	 * rather than iterating every active object. Objects aren't tracked while it's disabled, enabling it schedules all active objects.
+	 */
+	ENGINE_API void SetUpdateScheduleEnabled(bool bEnabled);
+
+	bool IsUpdateScheduleEnabled() const { return bUpdateScheduleEnabled; }
+
+	/**
+	 * Adds the active objects that are pending a net update or whose NextUpdateTime is before CurrentTime to OutDueObjects.
+	 * The objects returned are scheduled again on the next call, from the NextUpdateTime and bPendingNetUpdate they have by then.
+	 */
+	ENGINE_API void GatherDueActiveObjects(double CurrentTime, TArray<TSharedPtr<FNetworkObjectInfo>>& OutDueObjects);
+
+	/** Schedules the object again from its current NextUpdateTime. Must be called when NextUpdateTime is moved earlier outside of the objects returned by GatherDueActiveObjects. */
+	ENGINE_API void ScheduleUpdate(AActor* const Actor);
+	ENGINE_API void ScheduleUpdate(const TSharedPtr<FNetworkObjectInfo>& ObjectInfo);
 		
 	ENGINE_API void Reset();
 
@@ -304,6 +325,34 @@ private:
 	TMap<FName, FNetworkObjectSet> FullyDormantObjectsByLevel;
 	TMap<TObjectKey<UNetConnection>, TMap<FName, FNetworkObjectSet>> DormantObjectsPerConnection;
 
+	/** Adds the object to the bucket of its NextUpdateTime, or of the next tick to process if that's earlier */
+	void AddToUpdateSchedule(const TSharedPtr<FNetworkObjectInfo>& ObjectInfo);
+
+	/** Whether the object is still in ActiveNetworkObjects, rather than another object since allocated at the same address */
+	bool IsActiveObject(const TSharedPtr<FNetworkObjectInfo>& ObjectInfo) const;
+
+	struct FScheduledUpdate
+	{
+		TSharedPtr<FNetworkObjectInfo> ObjectInfo;
+		uint32 Serial = 0;
+	};
+
+	/** Timer wheel of the active objects, each bucket holds the objects due during one tick of UpdateScheduleTickDuration */
+	TArray<TArray<FScheduledUpdate>> UpdateScheduleBuckets;
+
+	/** Objects that need to be scheduled again on the next GatherDueActiveObjects, because they were just returned by it, activated or had their NextUpdateTime changed */
+	TArray<TSharedPtr<FNetworkObjectInfo>> ObjectsToSchedule;
+
+	/** First tick whose bucket hasn't been fully processed yet */
+	int64 NextUpdateScheduleTick = 0;
+
+	uint32 LastUpdateScheduleSerial = 0;
+
+	bool bUpdateScheduleEnabled = false;
+
+	/** Set when all active objects need to be scheduled again, such as when they all became active at once */
+	bool bRebuildUpdateSchedule = false;
+
 public:
 
 	/**
@@ -405,6 +405,9 @@ private:
 	/** If true, this handle will be released when it finishes loading */
 	bool bIsCombinedHandle;
 
+	/** If true, this handle was made by FStreamableManager::RequestAsyncLoadBatch and has FStreamableBatchLoadStats context data */
+	bool bIsBatchLoad;
+
 	/** Delegate to call when streaming is completed */
 	FStreamableDelegate CompleteDelegate;
 
@@ -469,6 +472,33 @@ enum class EStreamableManagerCombinedHandleOptions : uint8
 
 ENUM_CLASS_FLAGS(EStreamableManagerCombinedHandleOptions);
 
+/** Context data added to handles made by FStreamableManager::RequestAsyncLoadBatch, tracks how long each target took to load */
+struct FStreamableBatchLoadStats : public TStreamableHandleContextData<FStreamableBatchLoadStats>
+{
+	static ENGINE_API TStreamableHandleContextDataTypeIDStorage& TypeIdCrossModuleStorage();
+
+	/** Number of unique targets in the batch */
+	int32 NumTargets = 0;
+
+	/** Targets that were already loaded when the batch was requested */
+	int32 NumAlreadyLoaded = 0;
+
+	/** Targets that were already being loaded by an earlier request, which the batch waited on instead of issuing its own */
+	int32 NumJoinedInFlight = 0;
+
+	/** Time the batch was requested, in FPlatformTime::Seconds */
+	double RequestTime = 0.0;
+
+	/** Seconds from the request to each target finishing loading, in the order they finished */
+	TArray<float> Latencies;
+
+	/** Latency percentiles in seconds, filled in once every target has finished loading */
+	float LatencyP50 = 0.0f;
+	float LatencyP90 = 0.0f;
+	float LatencyP99 = 0.0f;
+	float LatencyMax = 0.0f;
+};
+
 /** A native class for managing streaming assets in and keeping them in memory. AssetManager is the global singleton version of this with blueprint access */
 struct FStreamableManager : public FGCObject
 {
@@ -494,6 +524,19 @@ struct FStreamableManager : public FGCObject
 	ENGINE_API TSharedPtr<FStreamableHandle> RequestAsyncLoad(TArray<FSoftObjectPath> TargetsToStream, TFunction<void()>&& Callback, TAsyncLoadPriority Priority = DefaultAsyncLoadPriority, bool bManageActiveHandle = false, bool bStartStalled = false, FString DebugName = TEXT("ArrayLambda"));
 	ENGINE_API TSharedPtr<FStreamableHandle> RequestAsyncLoad(const FSoftObjectPath& TargetToStream, TFunction<void()>&& Callback, TAsyncLoadPriority Priority = DefaultAsyncLoadPriority, bool bManageActiveHandle = false, bool bStartStalled = false, FString DebugName = TEXT("SingleLambda"));
 
+	/**
+	 * Batched version of RequestAsyncLoad, meant for systems issuing many small overlapping requests at once. All targets share the returned handle,
+	 * which completes once every one of them has loaded. Targets already being loaded by this manager wait on the request in flight rather than
+	 * issuing a new async load request. The handle gets FStreamableBatchLoadStats context data with the load latencies of its targets.
+	 *
+	 * @param TargetsToStream		Assets to load off disk, duplicates are removed
+	 * @param DelegateToCall		Delegate to call when all assets have loaded
+	 * @param Priority				Priority to pass to the streaming system, higher priority will be loaded first
+	 * @param bManageActiveHandle	If true, the manager will keep the streamable handle active until explicitly released
+	 * @param DebugName				Name of this handle, will be reported in debug tools
+	 */
+	ENGINE_API TSharedPtr<FStreamableHandle> RequestAsyncLoadBatch(TArray<FSoftObjectPath> TargetsToStream, FStreamableDelegate DelegateToCall = FStreamableDelegate(), TAsyncLoadPriority Priority = DefaultAsyncLoadPriority, bool bManageActiveHandle = false, FString DebugName = TEXT("Batch"));
+
 	/** 
 	 * Synchronously load a set of assets, and return a handle. This can be very slow and may stall the game thread for several seconds.
 	 * 
@@ -588,12 +631,13 @@ private:
 	friend FStreamableHandle;
 
 	ENGINE_API void RemoveReferencedAsset(const FSoftObjectPath& Target, TSharedRef<FStreamableHandle> Handle);
-	ENGINE_API void StartHandleRequests(TSharedRef<FStreamableHandle> Handle);
+	ENGINE_API void StartHandleRequests(TSharedRef<FStreamableHandle> Handle, bool bJoinInFlightRequests = false);
 	ENGINE_API TArray<int32> GetAsyncLoadRequestIds(TSharedRef<FStreamableHandle> Handle);
 	ENGINE_API void FindInMemory(FSoftObjectPath& InOutTarget, struct FStreamable* Existing, UPackage* Package = nullptr);
 	ENGINE_API FSoftObjectPath HandleLoadedRedirector(UObjectRedirector* LoadedRedirector, FSoftObjectPath RequestedPath, struct FStreamable* RequestedStreamable);
 	ENGINE_API struct FStreamable* FindStreamable(const FSoftObjectPath& Target) const;
-	ENGINE_API struct FStreamable* StreamInternal(const FSoftObjectPath& Target, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle);
+	ENGINE_API struct FStreamable* StreamInternal(const FSoftObjectPath& Target, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle, bool bJoinInFlightRequest = false);
+	ENGINE_API void RequestAsyncLoadForStreamable(const FSoftObjectPath& TargetName, struct FStreamable* Existing, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle);
 	ENGINE_API UObject* GetStreamed(const FSoftObjectPath& Target) const;
 	ENGINE_API void CheckCompletedRequests(const FSoftObjectPath& Target, struct FStreamable* Existing);
 
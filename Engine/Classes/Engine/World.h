@@ -2373,6 +2373,16 @@ public:
 	 */
 	FTraceHandle	AsyncOverlapByProfile(const FVector& Pos, const FQuat& Rot, FName ProfileName, const FCollisionShape& CollisionShape, const FCollisionQueryParams& Params = FCollisionQueryParams::DefaultQueryParam, const FOverlapDelegate* InDelegate = nullptr, uint32 UserData = 0);
 
+	/**
+	 * Interface for batched async traces
+	 * Runs every query of the batch in chunks on worker threads (or immediately on the game thread if async traces don't use worker threads)
+	 * Results can be read from the batch once FTraceBatch::Wait returns, or in the next frame without waiting since the world waits on the batch with the rest of its async traces
+	 * The batch must outlive its execution and can't be modified until it has completed
+	 *
+	 *  @param  Batch           Queries to run, see FTraceBatch
+	 */
+	void AsyncTraceBatch(FTraceBatch& Batch);
+
 	/**
 	 * Query function 
 	 * return true if already done and returning valid result - can be hit or no hit
@@ -899,6 +899,29 @@ private:
 	/** Remember last server movement base so we can detect mounts/dismounts and respond accordingly. */
 	TWeakObjectPtr<UPrimitiveComponent> LastServerMovementBase = nullptr;
 
+	/** Last walkable floor found by FindFloor(), reused while neither the capsule nor the floor moved when "p.FloorQueryCache" is enabled. */
+	struct FFloorQueryCache
+	{
+		FFindFloorResult FloorResult;
+		TWeakObjectPtr<UPrimitiveComponent> Floor;
+		FTransform FloorTransform;
+		FVector RelativeCapsuleLocation = FVector::ZeroVector;
+		FVector GravityDirection = FVector::ZeroVector;
+		float CapsuleRadius = 0.f;
+		float CapsuleHalfHeight = 0.f;
+		float SweepRadius = 0.f;
+		float LineDistance = 0.f;
+		float SweepDistance = 0.f;
+		double Time = 0.0;
+		int32 NumSceneQueries = 0;
+		bool bValid = false;
+	};
+
+	FFloorQueryCache FloorQueryCache;
+
+	/** Calls ComputeFloorDist(), or reuses FloorQueryCache if the query would be the same as the cached one. */
+	void ComputeFloorDistCached(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const;
+
 public:
 	/**
 	 * If true, walking movement always maintains horizontal velocity when moving up ramps, which causes movement up ramps to be faster parallel to the ramp surface.
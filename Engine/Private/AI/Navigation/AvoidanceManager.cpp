@@ -62,6 +62,9 @@ UAvoidanceManager::UAvoidanceManager(const FObjectInitializer& ObjectInitializer
 	bRequestedUpdateTimer = false;
 	bAutoPurgeOutdatedObjects = true;
 	HeightCheckMargin = 10.0f;
+	GridCellSize = 500.0f;
+	bUseSpatialGrid = true;
+	SpatialGridCellSize = GridCellSize;
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 	bDebugAll = false;
@@ -80,6 +83,7 @@ void UAvoidanceManager::RemoveAvoidanceObject(const int32 AvoidanceUID)
 	{
 		ExistingDataPtr->RemainingTimeToLive = 0.0f;
 	}
+	RemoveFromSpatialGrid(AvoidanceUID);
 
 	//Expired, not in pool yet, assign to pool
 	//DrawDebugLine(GetWorld(), AvoidanceData.Center, AvoidanceData.Center + FVector(0,0,500), FColor(64,255,64), true, 2.0f, SDPG_MAX, 20.0f);
@@ -119,6 +123,7 @@ void UAvoidanceManager::RemoveOutdatedObjects()
 		{
 			const int32 ObjectId = AvoidanceObj.Key;
 			AvoidanceData.RemainingTimeToLive = 0.0f;
+			RemoveFromSpatialGrid(ObjectId);
 
 			//Expired, not in pool yet, assign to pool
 			//DrawDebugLine(GetWorld(), AvoidanceData.Center, AvoidanceData.Center + FVector(0,0,500), FColor(64,255,64), true, 2.0f, SDPG_MAX, 20.0f);
@@ -253,6 +258,117 @@ void UAvoidanceManager::UpdateRVO_Internal(int32 inAvoidanceUID, const FNavAvoid
 	{
 		AvoidanceObjects.Add(inAvoidanceUID, inAvoidanceData);
 	}
+
+	UpdateSpatialGrid(inAvoidanceUID, inAvoidanceData.Center);
+}
+
+void UAvoidanceManager::UpdateSpatialGrid(int32 AvoidanceUID, const FVector& Center)
+{
+	ValidateSpatialGrid();
+	if (SpatialGridCellSize <= 0.0f)
+	{
+		return;
+	}
+
+	const FIntPoint NewCell = GetSpatialGridCell(Center);
+	if (FIntPoint* ExistingCell = SpatialGridObjectCells.Find(AvoidanceUID))
+	{
+		if (*ExistingCell == NewCell)
+		{
+			return;
+		}
+
+		if (TArray<int32>* OldCellObjects = SpatialGrid.Find(*ExistingCell))
+		{
+			OldCellObjects->RemoveSingleSwap(AvoidanceUID, EAllowShrinking::No);
+		}
+		*ExistingCell = NewCell;
+	}
+	else
+	{
+		SpatialGridObjectCells.Add(AvoidanceUID, NewCell);
+	}
+
+	SpatialGrid.FindOrAdd(NewCell).Add(AvoidanceUID);
+}
+
+void UAvoidanceManager::RemoveFromSpatialGrid(int32 AvoidanceUID)
+{
+	FIntPoint Cell;
+	if (SpatialGridObjectCells.RemoveAndCopyValue(AvoidanceUID, Cell))
+	{
+		if (TArray<int32>* CellObjects = SpatialGrid.Find(Cell))
+		{
+			CellObjects->RemoveSingleSwap(AvoidanceUID, EAllowShrinking::No);
+		}
+	}
+}
+
+void UAvoidanceManager::ValidateSpatialGrid()
+{
+	if (SpatialGridCellSize == GridCellSize)
+	{
+		return;
+	}
+
+	SpatialGridCellSize = GridCellSize;
+	SpatialGrid.Reset();
+	SpatialGridObjectCells.Reset();
+
+	if (SpatialGridCellSize <= 0.0f)
+	{
+		return;
+	}
+
+	for (const TPair<int32, FNavAvoidanceData>& AvoidanceObj : AvoidanceObjects)
+	{
+		if (!AvoidanceObj.Value.ShouldBeIgnored())
+		{
+			const FIntPoint Cell = GetSpatialGridCell(AvoidanceObj.Value.Center);
+			SpatialGridObjectCells.Add(AvoidanceObj.Key, Cell);
+			SpatialGrid.FindOrAdd(Cell).Add(AvoidanceObj.Key);
+		}
+	}
+}
+
+bool UAvoidanceManager::GatherAvoidanceCandidates(const FNavAvoidanceData& AvoidanceData, TArray<FSetElementId>& OutCandidates) const
+{
+	OutCandidates.Reset();
+
+	if (!bUseSpatialGrid || SpatialGridCellSize != GridCellSize || SpatialGridCellSize <= 0.0f)
+	{
+		return false;
+	}
+
+	const FVector TestExtent(AvoidanceData.TestRadius2D, AvoidanceData.TestRadius2D, 0.0f);
+	const FIntPoint MinCell = GetSpatialGridCell(AvoidanceData.Center - TestExtent);
+	const FIntPoint MaxCell = GetSpatialGridCell(AvoidanceData.Center + TestExtent);
+
+	// Scanning everything is cheaper than visiting more cells than there are objects
+	const int64 NumCells = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+	if (NumCells > SpatialGrid.Num())
+	{
+		return false;
+	}
+
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			if (const TArray<int32>* CellObjects = SpatialGrid.Find(FIntPoint(CellX, CellY)))
+			{
+				for (const int32 AvoidanceUID : *CellObjects)
+				{
+					OutCandidates.Add(AvoidanceObjects.FindId(AvoidanceUID));
+				}
+			}
+		}
+	}
+
+	// Visit candidates in the same order as a full scan of AvoidanceObjects, the cone solve depends on it
+	OutCandidates.Sort([](const FSetElementId& A, const FSetElementId& B) { return A.AsInteger() < B.AsInteger(); });
+
+	return true;
 }
 
 FVector AvoidCones(TArray<FVelocityAvoidanceCone>& AllCones, const FVector& BasePosition, const FVector& DesiredPosition, const int NumConesToTest)
@@ -357,7 +473,6 @@ static bool AvoidsNavEdges(const FVector& OrgLocation, const FVector& TestVeloci
 	return true;
 }
 
-//RickH - We could probably significantly improve speed if we put separate Z checks in place and did everything else in 2D.
 FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData& inAvoidanceData, float DeltaTime, int32* inIgnoreThisUID)
 {
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
@@ -371,42 +486,63 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 		return inAvoidanceData.Velocity;
 	}
 
-	FVector ReturnVelocity = inAvoidanceData.Velocity * DeltaTime;
-	FVector::FReal MaxSpeed = ReturnVelocity.Size2D();
-	double CurrentTime;
-
 	UWorld* MyWorld = Cast<UWorld>(GetOuter());
-	if (MyWorld)
-	{
-		CurrentTime = MyWorld->TimeSeconds;
-	}
-	else
+	if (!MyWorld)
 	{
 		//No world? OK, just quietly back out and don't alter anything.
 		return inAvoidanceData.Velocity;
 	}
 
-	bool Unobstructed = true;
+	bool DebugMode = false;
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	bool DebugMode = IsDebugOnForAll() || (inIgnoreThisUID ? IsDebugOnForUID(*inIgnoreThisUID) : false);
+	DebugMode = IsDebugOnForAll() || (inIgnoreThisUID ? IsDebugOnForUID(*inIgnoreThisUID) : false);
 #endif
 
+	ValidateSpatialGrid();
+
+	return CalculateAvoidanceVelocity(inAvoidanceData, DeltaTime, inIgnoreThisUID, MyWorld->TimeSeconds, AllCones, AllCandidates, DebugMode);
+}
+
+//RickH - We could probably significantly improve speed if we put separate Z checks in place and did everything else in 2D.
+FVector UAvoidanceManager::CalculateAvoidanceVelocity(const FNavAvoidanceData& inAvoidanceData, float DeltaTime, const int32* inIgnoreThisUID, double CurrentTime,
+	TArray<FVelocityAvoidanceCone>& Cones, TArray<FSetElementId>& Candidates, bool DebugMode) const
+{
+	if (DeltaTime <= 0.0f)
+	{
+		return inAvoidanceData.Velocity;
+	}
+
+	FVector ReturnVelocity = inAvoidanceData.Velocity * DeltaTime;
+	FVector::FReal MaxSpeed = ReturnVelocity.Size2D();
+	bool Unobstructed = true;
+
 	//If we're moving very slowly, just push forward. Not sure it's worth avoiding at this speed, though I could be wrong.
 	if (MaxSpeed < 0.01f)
 	{
 		return inAvoidanceData.Velocity;
 	}
-	AllCones.Empty(AllCones.Max());
+	Cones.Empty(Cones.Max());
 
 	//DrawDebugDirectionalArrow(GetWorld(), inAvoidanceData.Center, inAvoidanceData.Center + inAvoidanceData.Velocity, 2.5f, FColor(0,255,255), true, 0.05f, SDPG_MAX);
 
-	for (auto& AvoidanceObj : AvoidanceObjects)
+	// Only visit objects from nearby grid cells when the grid is usable, otherwise test all of them
+	const bool bUseCandidates = GatherAvoidanceCandidates(inAvoidanceData, Candidates);
+	const int32 NumToTest = bUseCandidates ? Candidates.Num() : AvoidanceObjects.Num();
+	TMap<int32, FNavAvoidanceData>::TConstIterator AvoidanceObjIt = AvoidanceObjects.CreateConstIterator();
+
+	for (int32 TestIndex = 0; TestIndex < NumToTest; ++TestIndex)
 	{
+		const TPair<int32, FNavAvoidanceData>& AvoidanceObj = bUseCandidates ? AvoidanceObjects.Get(Candidates[TestIndex]) : *AvoidanceObjIt;
+		if (!bUseCandidates)
+		{
+			++AvoidanceObjIt;
+		}
+
 		if ((inIgnoreThisUID) && (*inIgnoreThisUID == AvoidanceObj.Key))
 		{
 			continue;
 		}
-		FNavAvoidanceData& OtherObject = AvoidanceObj.Value;
+		const FNavAvoidanceData& OtherObject = AvoidanceObj.Value;
 
 		//
 		//Start with a few fast-rejects
@@ -510,7 +646,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 					Unobstructed = false;
 				}
 
-				AllCones.Add(NewCone);
+				Cones.Add(NewCone);
 			}
 		}
 	}
@@ -528,7 +664,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 	}
 
 	//Find a good velocity that isn't inside a cone.
-	if (AllCones.Num())
+	if (Cones.Num())
 	{
 		FVector::FReal AngleCurrent;
 		FVector::FReal AngleF = ReturnVelocity.HeadingAngle();
@@ -561,7 +697,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 				const bool bAvoidsNavEdges = NavEdges.Num() > 0 ? AvoidsNavEdges(inAvoidanceData.Center, VelSpacePoint, NavEdges, inAvoidanceData.HalfHeight) : true;
 				if (bAvoidsNavEdges)
 				{
-					FVector CandidateVelocity = AvoidCones(AllCones, FVector::ZeroVector, VelSpacePoint, AllCones.Num());
+					FVector CandidateVelocity = AvoidCones(Cones, FVector::ZeroVector, VelSpacePoint, Cones.Num());
 					FVector::FReal CandidateScore = (CandidateVelocity|ReturnVelocity) * (CandidateVelocity|CandidateVelocity);
 
 					//Vectors are rated by their length and their overall forward movement.
@@ -577,7 +713,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 		if (DebugMode)
 		{
-			DrawDebugDirectionalArrow(MyWorld, inAvoidanceData.Center + inAvoidanceData.Velocity, inAvoidanceData.Center + (ReturnVelocity / DeltaTime), 75.0f, FColor(64,255,64), true, 2.0f, SDPG_MAX);
+			DrawDebugDirectionalArrow(Cast<UWorld>(GetOuter()), inAvoidanceData.Center + inAvoidanceData.Velocity, inAvoidanceData.Center + (ReturnVelocity / DeltaTime), 75.0f, FColor(64,255,64), true, 2.0f, SDPG_MAX);
 		}
 #endif
 	}
@@ -19,6 +19,7 @@
 #include "Animation/MirrorDataTable.h"
 #include "Animation/SkeletonRemappingRegistry.h"
 #include "Animation/SkeletonRemapping.h"
+#include "Misc/MemStack.h"
 
 DEFINE_LOG_CATEGORY(LogAnimation);
 DEFINE_LOG_CATEGORY(LogRootMotion);
@@ -75,6 +76,10 @@ static_assert(sizeof(ispc::FPerBoneBlendWeight) == sizeof(FPerBoneBlendWeight),
 #define ANIM_CONVERT_POSE_TO_ADDITIVE_ISPC_ENABLED_DEFAULT 1
 #endif
 
+#if !defined(ANIM_BLEND_POSES_TOGETHER_ISPC_ENABLED_DEFAULT)
+#define ANIM_BLEND_POSES_TOGETHER_ISPC_ENABLED_DEFAULT 1
+#endif
+
 #if UE_BUILD_SHIPPING
 static constexpr bool bAnim_BlendPoseOverwrite_ISPC_Enabled = ANIM_BLEND_POSE_OVERWRITE_ISPC_ENABLED_DEFAULT;
 static constexpr bool bAnim_BlendPoseAccumulate_ISPC_Enabled = ANIM_BLEND_POSE_ACCUMULATE_ISPC_ENABLED_DEFAULT;
@@ -85,6 +90,7 @@ static constexpr bool bAnim_ConvertMeshRotationPoseToLocalSpace_ISPC_Enabled = A
 static constexpr bool bAnim_AccumulateLocalSpaceAdditivePose_ISPC_Enabled = ANIM_ACCUMULATE_LOCAL_SPACE_ADDITIVE_POSE_ISPC_ENABLED_DEFAULT;
 static constexpr bool bAnim_BlendPosesPerBoneFilter_ISPC_Enabled = ANIM_BLEND_POSES_PER_BONE_FILTER_ISPC_ENABLED_DEFAULT;
 static constexpr bool bAnim_ConvertPoseToAdditive_ISPC_Enabled = ANIM_CONVERT_POSE_TO_ADDITIVE_ISPC_ENABLED_DEFAULT;
+static constexpr bool bAnim_BlendPosesTogether_ISPC_Enabled = ANIM_BLEND_POSES_TOGETHER_ISPC_ENABLED_DEFAULT;
 #else
 static bool bAnim_BlendPoseOverwrite_ISPC_Enabled = ANIM_BLEND_POSE_OVERWRITE_ISPC_ENABLED_DEFAULT;
 static FAutoConsoleVariableRef CVarBlendPoseOverwriteISPCEnabled(TEXT("a.BlendPoseOverwrite.ISPC"), bAnim_BlendPoseOverwrite_ISPC_Enabled, TEXT("Whether to use ISPC optimizations for over-write pose blending"));
@@ -104,6 +110,8 @@ static bool bAnim_BlendPosesPerBoneFilter_ISPC_Enabled = ANIM_BLEND_POSES_PER_BO
 static FAutoConsoleVariableRef CVarBlendPosesPerBoneFilter(TEXT("a.BlendPosesPerBoneFilter.ISPC"), bAnim_BlendPosesPerBoneFilter_ISPC_Enabled, TEXT("Whether to use ISPC optimizations for blending poses with a per-bone filter"));
 static bool bAnim_ConvertPoseToAdditive_ISPC_Enabled = ANIM_CONVERT_POSE_TO_ADDITIVE_ISPC_ENABLED_DEFAULT;
 static FAutoConsoleVariableRef CVarConvertPoseToAdditiveISPCEnabled(TEXT("a.ConvertPoseToAdditive.ISPC"), bAnim_ConvertPoseToAdditive_ISPC_Enabled, TEXT("Whether to use ISPC optimizations for converting poses to additive poses"));
+static bool bAnim_BlendPosesTogether_ISPC_Enabled = ANIM_BLEND_POSES_TOGETHER_ISPC_ENABLED_DEFAULT;
+static FAutoConsoleVariableRef CVarBlendPosesTogetherISPCEnabled(TEXT("a.BlendPosesTogether.ISPC"), bAnim_BlendPosesTogether_ISPC_Enabled, TEXT("Whether to use ISPC optimizations for blending several poses together in a single pass"));
 #endif // UE_BUILD_SHIPPING
 
 #endif // INTEL_ISPC
@@ -201,6 +209,73 @@ FORCEINLINE void BlendPose<ETransformBlendMode::Accumulate>(const FCompactPose&
 	}
 }
 
+FORCEINLINE const FCompactPose& GetSourcePose(const FCompactPose& SourcePose)
+{
+	return SourcePose;
+}
+
+FORCEINLINE const FCompactPose& GetSourcePose(const FCompactPose* SourcePose)
+{
+	return *SourcePose;
+}
+
+/** Blends all source poses into OutPose in a single pass over the bones, normalizing the result when there is more than one pose */
+template <typename SourcePoseType>
+void BlendPosesTogether(const TArrayView<const SourcePoseType> SourcePoses, const TArrayView<const float> SourceWeights, FCompactPose& OutPose)
+{
+	const int32 NumBones = OutPose.GetNumBones();
+
+	TArray<const FTransform*, TInlineAllocator<16>> SourceTransforms;
+	SourceTransforms.Reserve(SourcePoses.Num());
+	for (const SourcePoseType& SourcePose : SourcePoses)
+	{
+		checkSlow(GetSourcePose(SourcePose).GetNumBones() == NumBones);
+		SourceTransforms.Add(GetSourcePose(SourcePose).GetBones().GetData());
+	}
+
+	FAnimationRuntime::BlendTransformsTogether(SourceTransforms, SourceWeights, OutPose.GetMutableBones().GetData(), NumBones, SourcePoses.Num() > 1);
+}
+
+/** Per bone version of BlendPosesTogether, BlendSampleDataCacheIndices maps source poses to their sample data if it is not empty */
+void BlendPosesTogetherPerBone(const TArrayView<const FCompactPose> SourcePoses, const TArray<int32>& PerBoneIndices, const TArrayView<const FBlendSampleData> BlendSampleDataCache, const TArrayView<const int32> BlendSampleDataCacheIndices, FCompactPose& OutPose)
+{
+	FMemMark Mark(FMemStack::Get());
+
+	const int32 NumBones = OutPose.GetNumBones();
+
+	TArray<const FTransform*, TInlineAllocator<16>> SourceTransforms;
+	SourceTransforms.Reserve(SourcePoses.Num());
+
+	// Weights of every bone of every pose, laid out per pose
+	TArray<float, TMemStackAllocator<>> BoneWeights;
+	BoneWeights.SetNumUninitialized(SourcePoses.Num() * NumBones);
+
+	for (int32 PoseIndex = 0; PoseIndex < SourcePoses.Num(); ++PoseIndex)
+	{
+		const FCompactPose& SourcePose = SourcePoses[PoseIndex];
+		checkSlow(SourcePose.GetNumBones() == NumBones);
+		SourceTransforms.Add(SourcePose.GetBones().GetData());
+
+		const FBlendSampleData& BlendSampleData = BlendSampleDataCache[BlendSampleDataCacheIndices.Num() > 0 ? BlendSampleDataCacheIndices[PoseIndex] : PoseIndex];
+		const float BlendWeight = BlendSampleData.GetClampedWeight();
+		float* PoseBoneWeights = BoneWeights.GetData() + PoseIndex * NumBones;
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			const int32 PerBoneIndex = PerBoneIndices[BoneIndex];
+			if (PerBoneIndex == INDEX_NONE || !BlendSampleData.PerBoneBlendData.IsValidIndex(PerBoneIndex))
+			{
+				PoseBoneWeights[BoneIndex] = BlendWeight;
+			}
+			else
+			{
+				PoseBoneWeights[BoneIndex] = BlendSampleData.PerBoneBlendData[PerBoneIndex];
+			}
+		}
+	}
+
+	FAnimationRuntime::BlendTransformsTogetherPerBone(SourceTransforms, BoneWeights, OutPose.GetMutableBones().GetData(), NumBones, true);
+}
+
 FORCEINLINE void BlendCurves(const TArrayView<const FBlendedCurve> SourceCurves, const TArrayView<const float> SourceWeights, const TArrayView<const int32> SourceWeightsIndices, FBlendedCurve& OutCurve)
 {
 	if (SourceCurves.Num() > 0)
@@ -356,18 +431,8 @@ void FAnimationRuntime::BlendPosesTogether(TArrayView<const FCompactPose> Source
 	FBlendedCurve& OutCurve = OutAnimationPoseData.GetCurve();
 	UE::Anim::FStackAttributeContainer& OutAttributes = OutAnimationPoseData.GetAttributes();
 
-	BlendPose<ETransformBlendMode::Overwrite>(SourcePoses[0], OutPose, SourceWeights[0]);
-
-	for (int32 PoseIndex = 1; PoseIndex < SourcePoses.Num(); ++PoseIndex)
-	{
-		BlendPose<ETransformBlendMode::Accumulate>(SourcePoses[PoseIndex], OutPose, SourceWeights[PoseIndex]);
-	}
-
-	// Ensure that all of the resulting rotations are normalized
-	if (SourcePoses.Num() > 1)
-	{
-		OutPose.NormalizeRotations();
-	}
+	// Also ensures that all of the resulting rotations are normalized
+	::BlendPosesTogether(SourcePoses, SourceWeights, OutPose);
 
 	// curve blending if exists
 	if (SourceCurves.Num() > 0)
@@ -404,18 +469,15 @@ void FAnimationRuntime::BlendPosesTogether(TArrayView<const FCompactPose> Source
 	FBlendedCurve& OutCurve = OutAnimationPoseData.GetCurve();
 	UE::Anim::FStackAttributeContainer& OutAttributes = OutAnimationPoseData.GetAttributes();
 
-	BlendPose<ETransformBlendMode::Overwrite>(SourcePoses[0], OutPose, SourceWeights[SourceWeightsIndices[0]]);
-
-	for (int32 PoseIndex = 1; PoseIndex < SourcePoses.Num(); ++PoseIndex)
+	TArray<float, TInlineAllocator<16>> PoseWeights;
+	PoseWeights.AddUninitialized(SourcePoses.Num());
+	for (int32 PoseIndex = 0; PoseIndex < SourcePoses.Num(); ++PoseIndex)
 	{
-		BlendPose<ETransformBlendMode::Accumulate>(SourcePoses[PoseIndex], OutPose, SourceWeights[SourceWeightsIndices[PoseIndex]]);
+		PoseWeights[PoseIndex] = SourceWeights[SourceWeightsIndices[PoseIndex]];
 	}
 
-	// Ensure that all of the resulting rotations are normalized
-	if (SourcePoses.Num() > 1)
-	{
-		OutPose.NormalizeRotations();
-	}
+	// Also ensures that all of the resulting rotations are normalized
+	::BlendPosesTogether(SourcePoses, MakeArrayView(PoseWeights), OutPose);
 
 	// curve blending if exists
 	if (SourceCurves.Num() > 0)
@@ -450,18 +512,8 @@ void FAnimationRuntime::BlendPosesTogetherIndirect(TArrayView<const FCompactPose
 	FBlendedCurve& OutCurve = OutAnimationPoseData.GetCurve();
 	UE::Anim::FStackAttributeContainer& OutAttributes = OutAnimationPoseData.GetAttributes();
 	
-	BlendPose<ETransformBlendMode::Overwrite>(*SourcePoses[0], OutPose, SourceWeights[0]);
-
-	for (int32 PoseIndex = 1; PoseIndex < SourcePoses.Num(); ++PoseIndex)
-	{
-		BlendPose<ETransformBlendMode::Accumulate>(*SourcePoses[PoseIndex], OutPose, SourceWeights[PoseIndex]);
-	}
-
-	// Ensure that all of the resulting rotations are normalized
-	if (SourcePoses.Num() > 1)
-	{
-		OutPose.NormalizeRotations();
-	}
+	// Also ensures that all of the resulting rotations are normalized
+	::BlendPosesTogether(SourcePoses, SourceWeights, OutPose);
 
 	if (SourceCurves.Num() > 0)
 	{
@@ -592,24 +644,6 @@ void BlendPosePerBone(const TArray<FBoneIndexType>& RequiredBoneIndices, const T
 	}
 }
 
-template <int32 TRANSFORM_BLEND_MODE>
-void BlendPosePerBone(const TArray<int32>& PerBoneIndices, const FBlendSampleData& BlendSampleDataCache, FCompactPose& ResultPose, const FCompactPose& SourcePose)
-{
-	const float BlendWeight = BlendSampleDataCache.GetClampedWeight();
-	for (FCompactPoseBoneIndex BoneIndex : SourcePose.ForEachBoneIndex())
-	{
-		const int32 PerBoneIndex = PerBoneIndices[BoneIndex.GetInt()];
-		if (PerBoneIndex == INDEX_NONE || !BlendSampleDataCache.PerBoneBlendData.IsValidIndex(PerBoneIndex))
-		{
-			BlendTransform<TRANSFORM_BLEND_MODE>(SourcePose[BoneIndex], ResultPose[BoneIndex], BlendWeight);
-		}
-		else
-		{
-			BlendTransform<TRANSFORM_BLEND_MODE>(SourcePose[BoneIndex], ResultPose[BoneIndex], BlendSampleDataCache.PerBoneBlendData[PerBoneIndex]);
-		}
-	}
-}
-
 void FAnimationRuntime::BlendPosesTogetherPerBone(
 	const TArrayView<const FCompactPose> SourcePoses,
 	const TArrayView<const FBlendedCurve> SourceCurves,
@@ -642,14 +676,8 @@ void FAnimationRuntime::BlendPosesTogetherPerBone(TArrayView<const FCompactPose>
 		PerBoneIndices[BoneIndex.GetInt()] = InterpolationIndexProvider->GetPerBoneInterpolationIndex(BoneIndex, RequiredBones, Data.Get());
 	}
 
-	BlendPosePerBone<ETransformBlendMode::Overwrite>(PerBoneIndices, BlendSampleDataCache[0], OutPose, SourcePoses[0]);
-	for (int32 i = 1; i < SourcePoses.Num(); ++i)
-	{
-		BlendPosePerBone<ETransformBlendMode::Accumulate>(PerBoneIndices, BlendSampleDataCache[i], OutPose, SourcePoses[i]);
-	}
-
-	// Ensure that all of the resulting rotations are normalized
-	OutPose.NormalizeRotations();
+	// Also ensures that all of the resulting rotations are normalized
+	::BlendPosesTogetherPerBone(SourcePoses, PerBoneIndices, BlendSampleDataCache, {}, OutPose);
 
 	if (SourceCurves.Num() > 0)
 	{
@@ -701,15 +729,8 @@ void FAnimationRuntime::BlendPosesTogetherPerBone(TArrayView<const FCompactPose>
 		PerBoneIndices[BoneIndex.GetInt()] = InterpolationIndexProvider->GetPerBoneInterpolationIndex(BoneIndex, RequiredBones, Data.Get());
 	}
 
-	BlendPosePerBone<ETransformBlendMode::Overwrite>(PerBoneIndices, BlendSampleDataCache[BlendSampleDataCacheIndices[0]], OutPose, SourcePoses[0]);
-
-	for (int32 i = 1; i < SourcePoses.Num(); ++i)
-	{
-		BlendPosePerBone<ETransformBlendMode::Accumulate>(PerBoneIndices, BlendSampleDataCache[BlendSampleDataCacheIndices[i]], OutPose, SourcePoses[i]);
-	}
-
-	// Ensure that all of the resulting rotations are normalized
-	OutPose.NormalizeRotations();
+	// Also ensures that all of the resulting rotations are normalized
+	::BlendPosesTogetherPerBone(SourcePoses, PerBoneIndices, BlendSampleDataCache, BlendSampleDataCacheIndices, OutPose);
 
 	if (SourceCurves.Num() > 0)
 	{
@@ -749,15 +770,8 @@ void FAnimationRuntime::BlendPosesTogetherPerBoneRemapped(TArrayView<const FComp
 		PerBoneIndices[BoneIndex.GetInt()] = (SourceBoneIndex != INDEX_NONE) ? InterpolationIndexProvider->GetPerBoneInterpolationIndex(SourceBoneIndex, RequiredBones, Data.Get()) : INDEX_NONE;
 	}
 
-	BlendPosePerBone<ETransformBlendMode::Overwrite>(PerBoneIndices, BlendSampleDataCache[BlendSampleDataCacheIndices[0]], OutPose, SourcePoses[0]);
-
-	for (int32 i = 1; i < SourcePoses.Num(); ++i)
-	{
-		BlendPosePerBone<ETransformBlendMode::Accumulate>(PerBoneIndices, BlendSampleDataCache[BlendSampleDataCacheIndices[i]], OutPose, SourcePoses[i]);
-	}
-
-	// Ensure that all of the resulting rotations are normalized
-	OutPose.NormalizeRotations();
+	// Also ensures that all of the resulting rotations are normalized
+	::BlendPosesTogetherPerBone(SourcePoses, PerBoneIndices, BlendSampleDataCache, BlendSampleDataCacheIndices, OutPose);
 
 	if (SourceCurves.Num() > 0)
 	{
@@ -995,6 +1009,81 @@ void FAnimationRuntime::LerpBoneTransforms(TArray<FTransform>& A, const TArray<F
 	}
 }
 
+void FAnimationRuntime::BlendTransformsTogether(TArrayView<const FTransform* const> SourceTransforms, TArrayView<const float> SourceWeights, FTransform* OutTransforms, int32 NumTransforms, bool bNormalizeRotations)
+{
+	check(SourceTransforms.Num() > 0 && SourceWeights.Num() >= SourceTransforms.Num());
+
+#if INTEL_ISPC
+	if (bAnim_BlendPosesTogether_ISPC_Enabled)
+	{
+		ispc::BlendPosesTogether(
+			(const ispc::FTransform**)SourceTransforms.GetData(),
+			SourceWeights.GetData(),
+			(ispc::FTransform*)OutTransforms,
+			SourceTransforms.Num(),
+			NumTransforms,
+			bNormalizeRotations
+		);
+	}
+	else
+#endif
+	{
+		// Every source is blended into a local before it is written out, so OutTransforms can be one of the sources
+		for (int32 Index = 0; Index < NumTransforms; ++Index)
+		{
+			FTransform Blended = SourceTransforms[0][Index] * ScalarRegister(SourceWeights[0]);
+			for (int32 PoseIndex = 1; PoseIndex < SourceTransforms.Num(); ++PoseIndex)
+			{
+				Blended.AccumulateWithShortestRotation(SourceTransforms[PoseIndex][Index], ScalarRegister(SourceWeights[PoseIndex]));
+			}
+
+			if (bNormalizeRotations)
+			{
+				Blended.NormalizeRotation();
+			}
+
+			OutTransforms[Index] = Blended;
+		}
+	}
+}
+
+void FAnimationRuntime::BlendTransformsTogetherPerBone(TArrayView<const FTransform* const> SourceTransforms, TArrayView<const float> SourceWeights, FTransform* OutTransforms, int32 NumTransforms, bool bNormalizeRotations)
+{
+	check(SourceTransforms.Num() > 0 && SourceWeights.Num() >= SourceTransforms.Num() * NumTransforms);
+
+#if INTEL_ISPC
+	if (bAnim_BlendPosesTogether_ISPC_Enabled)
+	{
+		ispc::BlendPosesTogetherPerBone(
+			(const ispc::FTransform**)SourceTransforms.GetData(),
+			SourceWeights.GetData(),
+			(ispc::FTransform*)OutTransforms,
+			SourceTransforms.Num(),
+			NumTransforms,
+			bNormalizeRotations
+		);
+	}
+	else
+#endif
+	{
+		for (int32 Index = 0; Index < NumTransforms; ++Index)
+		{
+			FTransform Blended = SourceTransforms[0][Index] * ScalarRegister(SourceWeights[Index]);
+			for (int32 PoseIndex = 1; PoseIndex < SourceTransforms.Num(); ++PoseIndex)
+			{
+				Blended.AccumulateWithShortestRotation(SourceTransforms[PoseIndex][Index], ScalarRegister(SourceWeights[PoseIndex * NumTransforms + Index]));
+			}
+
+			if (bNormalizeRotations)
+			{
+				Blended.NormalizeRotation();
+			}
+
+			OutTransforms[Index] = Blended;
+		}
+	}
+}
+
 void FAnimationRuntime::BlendTransformsByWeight(FTransform& OutTransform, const TArray<FTransform>& Transforms, const TArray<float>& Weights)
 {
 	int32 NumBlends = Transforms.Num();
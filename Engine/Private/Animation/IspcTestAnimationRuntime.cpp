@@ -0,0 +1,176 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#if WITH_DEV_AUTOMATION_TESTS && INTEL_ISPC
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "AnimationRuntime.h"
+
+namespace IspcTestAnimationRuntimePrivate
+{
+	static constexpr int32 NumPoses = 8;
+	static constexpr int32 NumBones = 203; // Not a multiple of the ISPC gang size so the scalar tail gets tested too
+
+	static void MakeRandomPoses(TArray<TArray<FTransform>>& OutPoses, TArray<const FTransform*>& OutPosePointers)
+	{
+		FRandomStream RandomStream(0x9a3e);
+
+		OutPoses.SetNum(NumPoses);
+		for (TArray<FTransform>& Pose : OutPoses)
+		{
+			Pose.SetNum(NumBones);
+			for (FTransform& Transform : Pose)
+			{
+				const FQuat Rotation = FQuat(RandomStream.GetUnitVector(), RandomStream.FRandRange(-UE_PI, UE_PI));
+				const FVector Translation = RandomStream.GetUnitVector() * RandomStream.FRandRange(0.0f, 100.0f);
+				const FVector Scale3D(RandomStream.FRandRange(0.5f, 2.0f), RandomStream.FRandRange(0.5f, 2.0f), RandomStream.FRandRange(0.5f, 2.0f));
+				Transform = FTransform(Rotation, Translation, Scale3D);
+			}
+			OutPosePointers.Add(Pose.GetData());
+		}
+	}
+
+	static void MakeRandomWeights(const int32 NumWeightsPerPose, TArray<float>& OutWeights)
+	{
+		FRandomStream RandomStream(0x51f7);
+
+		OutWeights.SetNum(NumPoses * NumWeightsPerPose);
+		for (int32 WeightIndex = 0; WeightIndex < NumWeightsPerPose; ++WeightIndex)
+		{
+			float TotalWeight = 0.0f;
+			for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+			{
+				OutWeights[PoseIndex * NumWeightsPerPose + WeightIndex] = RandomStream.FRand();
+				TotalWeight += OutWeights[PoseIndex * NumWeightsPerPose + WeightIndex];
+			}
+			for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+			{
+				OutWeights[PoseIndex * NumWeightsPerPose + WeightIndex] /= TotalWeight;
+			}
+		}
+	}
+
+	static void TestTransformsEqual(FAutomationTestBase& Test, const TArray<FTransform>& ISPCTransforms, const TArray<FTransform>& CPPTransforms)
+	{
+		for (int32 i = 0; i < ISPCTransforms.Num(); ++i)
+		{
+			const FString Message(FString::Format(TEXT("Transform {0}"), { i }));
+			Test.TestTrue(*Message, ISPCTransforms[i].Equals(CPPTransforms[i], UE_KINDA_SMALL_NUMBER));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FIspcTestAnimationRuntimeBlendTransformsTogether, "Ispc.Animation.AnimationRuntime.BlendTransformsTogether", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FIspcTestAnimationRuntimeBlendTransformsTogether::RunTest(const FString& Parameters)
+{
+	using namespace IspcTestAnimationRuntimePrivate;
+
+	const FString CommandName(TEXT("a.BlendPosesTogether.ISPC"));
+	auto FormatCommand = [CommandName](bool State) -> FString {
+		return FString::Format(TEXT("{0} {1}"), { CommandName, State });
+	};
+
+	const IConsoleVariable* CVarISPCEnabled = IConsoleManager::Get().FindConsoleVariable(*CommandName);
+	bool InitialState = CVarISPCEnabled->GetBool();
+	check(GEngine);
+
+	TArray<TArray<FTransform>> Poses;
+	TArray<const FTransform*> PosePointers;
+	MakeRandomPoses(Poses, PosePointers);
+
+	TArray<float> Weights;
+	MakeRandomWeights(1, Weights);
+
+	TArray<FTransform> ISPCTransforms;
+	ISPCTransforms.SetNum(NumBones);
+	TArray<FTransform> CPPTransforms;
+	CPPTransforms.SetNum(NumBones);
+
+	// Blend with overwrite followed by accumulate one pose at a time, as BlendPosesTogether used to
+	TArray<FTransform> ReferenceTransforms;
+	ReferenceTransforms.SetNum(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		BlendTransform<ETransformBlendMode::Overwrite>(Poses[0][BoneIndex], ReferenceTransforms[BoneIndex], Weights[0]);
+	}
+	for (int32 PoseIndex = 1; PoseIndex < NumPoses; ++PoseIndex)
+	{
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			BlendTransform<ETransformBlendMode::Accumulate>(Poses[PoseIndex][BoneIndex], ReferenceTransforms[BoneIndex], Weights[PoseIndex]);
+		}
+	}
+	for (FTransform& Transform : ReferenceTransforms)
+	{
+		Transform.NormalizeRotation();
+	}
+
+	constexpr int32 NumIterations = 1000;
+	auto TimeBlends = [&](TArray<FTransform>& OutTransforms)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			FAnimationRuntime::BlendTransformsTogether(PosePointers, Weights, OutTransforms.GetData(), NumBones, true);
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	};
+
+	GEngine->Exec(nullptr, *FormatCommand(true));
+	const double ISPCSeconds = TimeBlends(ISPCTransforms);
+
+	GEngine->Exec(nullptr, *FormatCommand(false));
+	const double CPPSeconds = TimeBlends(CPPTransforms);
+
+	GEngine->Exec(nullptr, *FormatCommand(InitialState));
+
+	TestTransformsEqual(*this, ISPCTransforms, CPPTransforms);
+	TestTransformsEqual(*this, CPPTransforms, ReferenceTransforms);
+
+	AddInfo(FString::Printf(TEXT("%d poses of %d bones, %d blends. C++: %.3f ms, ISPC: %.3f ms"), NumPoses, NumBones, NumIterations, CPPSeconds * 1000.0, ISPCSeconds * 1000.0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FIspcTestAnimationRuntimeBlendTransformsTogetherPerBone, "Ispc.Animation.AnimationRuntime.BlendTransformsTogetherPerBone", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool FIspcTestAnimationRuntimeBlendTransformsTogetherPerBone::RunTest(const FString& Parameters)
+{
+	using namespace IspcTestAnimationRuntimePrivate;
+
+	const FString CommandName(TEXT("a.BlendPosesTogether.ISPC"));
+	auto FormatCommand = [CommandName](bool State) -> FString {
+		return FString::Format(TEXT("{0} {1}"), { CommandName, State });
+	};
+
+	const IConsoleVariable* CVarISPCEnabled = IConsoleManager::Get().FindConsoleVariable(*CommandName);
+	bool InitialState = CVarISPCEnabled->GetBool();
+	check(GEngine);
+
+	TArray<TArray<FTransform>> Poses;
+	TArray<const FTransform*> PosePointers;
+	MakeRandomPoses(Poses, PosePointers);
+
+	TArray<float> Weights;
+	MakeRandomWeights(NumBones, Weights);
+
+	TArray<FTransform> ISPCTransforms;
+	ISPCTransforms.SetNum(NumBones);
+	TArray<FTransform> CPPTransforms;
+	CPPTransforms.SetNum(NumBones);
+
+	GEngine->Exec(nullptr, *FormatCommand(true));
+	FAnimationRuntime::BlendTransformsTogetherPerBone(PosePointers, Weights, ISPCTransforms.GetData(), NumBones, true);
+
+	GEngine->Exec(nullptr, *FormatCommand(false));
+	FAnimationRuntime::BlendTransformsTogetherPerBone(PosePointers, Weights, CPPTransforms.GetData(), NumBones, true);
+
+	GEngine->Exec(nullptr, *FormatCommand(InitialState));
+
+	TestTransformsEqual(*this, ISPCTransforms, CPPTransforms);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && INTEL_ISPC
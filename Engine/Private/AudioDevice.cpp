@@ -4746,6 +4746,9 @@ void FAudioDevice::Update(bool bGameTicking)
 		// Start and/or update any sources that have a high enough priority to play
 		StartSources(ActiveWaveInstances, FirstActiveIndex, bGameTicking);
 
+		// Read ahead the chunks that playing and about to play streamed sounds will need
+		UpdateStreamingPrefetch(ActiveWaveInstances);
+
 		// Check which sounds are active from these wave instances and update passive SoundMixes
 		UpdatePassiveSoundMixModifiers(ActiveWaveInstances, FirstActiveIndex);
 
@@ -4774,6 +4777,138 @@ void FAudioDevice::Update(bool bGameTicking)
 	SendUpdateResultsToGameThread(FirstActiveIndex);
 }
 
+void FAudioDevice::UpdateStreamingPrefetch(const TArray<FWaveInstance*>& WaveInstances)
+{
+	check(IsInAudioThread());
+	TRACE_CPUPROFILER_EVENT_SCOPE(FAudioDevice_UpdateStreamingPrefetch);
+
+	static IConsoleVariable* EnablePrefetchCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("au.streamcaching.Prefetch.Enable"));
+	if (!FPlatformCompressionUtilities::IsCurrentPlatformUsingStreamCaching() || !EnablePrefetchCVar || EnablePrefetchCVar->GetInt() == 0)
+	{
+		PrefetchSoundWaveProxies.Reset();
+		PrefetchSoundCueWaves.Reset();
+		return;
+	}
+
+	// Sounds that aren't playing yet are prefetched after the ones that are.
+	constexpr float CueBranchPriorityScale = 0.5f;
+	constexpr float VirtualLoopPriorityScale = 0.25f;
+
+	// Only keep the proxies and sound cue waves of sounds that are still being prefetched.
+	TMap<FObjectKey, FSoundWaveProxyPtr> PreviousSoundWaveProxies = MoveTemp(PrefetchSoundWaveProxies);
+	TMap<FObjectKey, TArray<TWeakObjectPtr<USoundWave>>> PreviousSoundCueWaves = MoveTemp(PrefetchSoundCueWaves);
+	PrefetchSoundWaveProxies.Reset();
+	PrefetchSoundCueWaves.Reset();
+	PrefetchRequests.Reset();
+
+	auto AddRequest = [this, &PreviousSoundWaveProxies](USoundWave* SoundWave, float PlaybackTime, float Priority, bool bLooping)
+	{
+		if (!SoundWave || SoundWave->HasAnyFlags(RF_NeedLoad) || !SoundWave->IsStreaming(nullptr) || SoundWave->GetNumChunks() <= 1)
+		{
+			return;
+		}
+
+		const FObjectKey SoundWaveKey(SoundWave);
+		FSoundWaveProxyPtr* SoundWaveProxy = PrefetchSoundWaveProxies.Find(SoundWaveKey);
+		if (!SoundWaveProxy)
+		{
+			FSoundWaveProxyPtr* PreviousSoundWaveProxy = PreviousSoundWaveProxies.Find(SoundWaveKey);
+			SoundWaveProxy = &PrefetchSoundWaveProxies.Add(SoundWaveKey, PreviousSoundWaveProxy ? MoveTemp(*PreviousSoundWaveProxy) : SoundWave->CreateSoundWaveProxy());
+		}
+
+		FAudioChunkPrefetchRequest& Request = PrefetchRequests.AddDefaulted_GetRef();
+		Request.SoundWave = *SoundWaveProxy;
+		Request.PlaybackTime = PlaybackTime;
+		Request.Priority = Priority;
+		Request.bLooping = bLooping;
+	};
+
+	auto AddSoundCueRequests = [this, &PreviousSoundCueWaves, &AddRequest](USoundCue* SoundCue, float Priority, const TSet<const USoundWave*>& PlayingSoundWaves)
+	{
+		const FObjectKey SoundCueKey(SoundCue);
+		TArray<TWeakObjectPtr<USoundWave>>* SoundCueWaves = PrefetchSoundCueWaves.Find(SoundCueKey);
+		if (!SoundCueWaves)
+		{
+			if (TArray<TWeakObjectPtr<USoundWave>>* PreviousSoundCueWaves = PreviousSoundCueWaves.Find(SoundCueKey))
+			{
+				SoundCueWaves = &PrefetchSoundCueWaves.Add(SoundCueKey, MoveTemp(*PreviousSoundCueWaves));
+			}
+			else
+			{
+				TArray<USoundNodeWavePlayer*> WavePlayers;
+				SoundCue->RecursiveFindNode<USoundNodeWavePlayer>(SoundCue->FirstNode, WavePlayers);
+
+				SoundCueWaves = &PrefetchSoundCueWaves.Add(SoundCueKey);
+				for (const USoundNodeWavePlayer* WavePlayer : WavePlayers)
+				{
+					USoundWave* SoundWave = WavePlayer->GetSoundWave();
+					if (SoundWave && SoundWave->IsStreaming(nullptr))
+					{
+						SoundCueWaves->AddUnique(SoundWave);
+					}
+				}
+			}
+		}
+
+		// Branches the cue may play next start from the beginning of their wave.
+		for (const TWeakObjectPtr<USoundWave>& SoundWave : *SoundCueWaves)
+		{
+			if (!PlayingSoundWaves.Contains(SoundWave.Get()))
+			{
+				AddRequest(SoundWave.Get(), 0.0f, Priority, false);
+			}
+		}
+	};
+
+	// Wave instances that didn't get a source this update are included, they play as soon as the ones ahead of them stop.
+	TSet<const USoundWave*> PlayingSoundWaves;
+	for (const FWaveInstance* WaveInstance : WaveInstances)
+	{
+		if (WaveInstance->WaveData && WaveInstance->IsStreaming())
+		{
+			PlayingSoundWaves.Add(WaveInstance->WaveData);
+
+			// The wave instance's playback time only advances with cooked analysis data, the source knows where it is
+			float PlaybackTime = WaveInstance->StartTime;
+			if (const FSoundSource* Source = WaveInstanceSourceMap.FindRef(WaveInstance))
+			{
+				PlaybackTime = Source->GetPlaybackPercent() * WaveInstance->WaveData->Duration;
+			}
+			else if (WaveInstance->ActiveSound)
+			{
+				PlaybackTime = WaveInstance->ActiveSound->PlaybackTime;
+			}
+
+			AddRequest(WaveInstance->WaveData, PlaybackTime, WaveInstance->GetVolumeWeightedPriority(), WaveInstance->LoopingMode != LOOP_Never);
+		}
+	}
+
+	for (const FActiveSound* ActiveSound : ActiveSounds)
+	{
+		if (USoundCue* SoundCue = Cast<USoundCue>(ActiveSound->GetSound()))
+		{
+			AddSoundCueRequests(SoundCue, ActiveSound->Priority * CueBranchPriorityScale, PlayingSoundWaves);
+		}
+	}
+
+	// Virtualized loops resume once they are audible again.
+	for (const AudioDeviceUtils::FVirtualLoopPair& Pair : VirtualLoops)
+	{
+		const FActiveSound& ActiveSound = Pair.Value.GetActiveSound();
+		const float Priority = ActiveSound.Priority * VirtualLoopPriorityScale;
+		if (USoundWave* SoundWave = Cast<USoundWave>(ActiveSound.GetSound()))
+		{
+			AddRequest(SoundWave, ActiveSound.PlaybackTime, Priority, true);
+		}
+		else if (USoundCue* SoundCue = Cast<USoundCue>(ActiveSound.GetSound()))
+		{
+			AddSoundCueRequests(SoundCue, Priority, PlayingSoundWaves);
+		}
+	}
+
+	IStreamingManager::Get().GetAudioStreamingManager().PrefetchChunks(PrefetchRequests);
+}
+
 void FAudioDevice::UpdateAudioVolumeEffects()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FAudioDevice_UpdateAudioVolumeEffects);
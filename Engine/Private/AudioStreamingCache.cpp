@@ -142,6 +142,28 @@ FAutoConsoleVariableRef CVarEnableExhaustiveCacheSearches(
 	TEXT("0: Rely on chunk offset. 1: Search using linear search"),
 	ECVF_Default);
 
+static int32 EnablePrefetchCVar = 0;
+FAutoConsoleVariableRef CVarEnablePrefetch(
+	TEXT("au.streamcaching.Prefetch.Enable"),
+	EnablePrefetchCVar,
+	TEXT("Reads the chunks that playing and about to play sounds will need ahead of their decoders, instead of only requesting the next chunk once the current one is in use.\n")
+	TEXT("0: Disabled, 1: Enabled"),
+	ECVF_Default);
+
+static float PrefetchLookaheadSecondsCVar = 2.0f;
+FAutoConsoleVariableRef CVarPrefetchLookaheadSeconds(
+	TEXT("au.streamcaching.Prefetch.LookaheadSeconds"),
+	PrefetchLookaheadSecondsCVar,
+	TEXT("How far ahead of the current playback position, in seconds, chunks are prefetched."),
+	ECVF_Default);
+
+static int32 PrefetchMaxReadsPerUpdateCVar = 16;
+FAutoConsoleVariableRef CVarPrefetchMaxReadsPerUpdate(
+	TEXT("au.streamcaching.Prefetch.MaxReadsPerUpdate"),
+	PrefetchMaxReadsPerUpdateCVar,
+	TEXT("The maximum number of prefetch reads started per audio update. Higher priority sounds are read first."),
+	ECVF_Default);
+
 static FAutoConsoleCommand GFlushAudioCacheCommand(
 	TEXT("au.streamcaching.FlushAudioCache"),
 	TEXT("This will flush any non retained audio from the cache when Stream Caching is enabled."),
@@ -731,6 +753,148 @@ bool FCachedAudioStreamingManager::RequestChunk(const FSoundWaveProxyPtr& SoundW
 	}
 }
 
+void FCachedAudioStreamingManager::PrefetchChunks(TArrayView<const FAudioChunkPrefetchRequest> Requests)
+{
+	LLM_SCOPE(ELLMTag::AudioStreamCache);
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCachedAudioStreamingManager::PrefetchChunks);
+
+	if (!EnablePrefetchCVar || PrefetchLookaheadSecondsCVar <= 0.0f || Requests.Num() == 0)
+	{
+		return;
+	}
+
+	// Serve requests from highest to lowest priority, so that once we are out of reads for this update it's the least important sounds that wait.
+	TArray<int32, TInlineAllocator<64>> SortedRequestIndices;
+	SortedRequestIndices.Reserve(Requests.Num());
+	for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); RequestIndex++)
+	{
+		SortedRequestIndices.Add(RequestIndex);
+	}
+	SortedRequestIndices.Sort([&Requests](int32 A, int32 B) { return Requests[A].Priority > Requests[B].Priority; });
+
+	int32 NumReadsRemaining = PrefetchMaxReadsPerUpdateCVar;
+	for (const int32 RequestIndex : SortedRequestIndices)
+	{
+		if (NumReadsRemaining <= 0)
+		{
+			break;
+		}
+
+		const FAudioChunkPrefetchRequest& Request = Requests[RequestIndex];
+		const FSoundWaveProxyPtr& SoundWave = Request.SoundWave;
+		if (!SoundWave.IsValid() || SoundWave->GetLoadingBehavior() == ESoundWaveLoadingBehavior::ForceInline)
+		{
+			continue;
+		}
+
+		FAudioChunkCache* Cache = GetCacheForWave(SoundWave);
+		TSharedPtr<FSoundWaveData> SoundWaveData = SoundWave->GetSoundWaveData();
+		if (!Cache || !SoundWaveData.IsValid())
+		{
+			continue;
+		}
+
+		const float Duration = SoundWave->GetDuration();
+		float WindowStartTime = Request.PlaybackTime;
+		if (Request.bLooping && Duration > 0.0f)
+		{
+			WindowStartTime = FMath::Fmod(WindowStartTime, Duration);
+		}
+		const float WindowEndTime = WindowStartTime + PrefetchLookaheadSecondsCVar;
+
+		auto PrefetchChunk = [&](int32 ChunkIndex)
+		{
+			const FAudioChunkCache::FChunkKey ChunkKey(
+				  SoundWaveData
+				, ((uint32)ChunkIndex)
+#if WITH_EDITOR
+				, (uint32)SoundWave->GetCurrentChunkRevision()
+#endif
+			);
+
+			if (Cache->PrefetchChunk(ChunkKey, SoundWaveData))
+			{
+				NumReadsRemaining--;
+			}
+		};
+
+		// The zeroth chunk is inlined on the asset, so it's never read through the cache.
+		const int32 FirstChunkIndex = FMath::Max(GetChunkIndexForTime(SoundWave, WindowStartTime), 1);
+		const int32 LastChunkIndex = GetChunkIndexForTime(SoundWave, WindowEndTime);
+		for (int32 ChunkIndex = FirstChunkIndex; ChunkIndex <= LastChunkIndex && NumReadsRemaining > 0; ChunkIndex++)
+		{
+			PrefetchChunk(ChunkIndex);
+		}
+
+		// A looping wave carries on from its start once the lookahead runs past its end.
+		if (Request.bLooping && WindowEndTime > Duration)
+		{
+			const int32 LastWrappedChunkIndex = FMath::Min(GetChunkIndexForTime(SoundWave, WindowEndTime - Duration), FirstChunkIndex - 1);
+			for (int32 ChunkIndex = 1; ChunkIndex <= LastWrappedChunkIndex && NumReadsRemaining > 0; ChunkIndex++)
+			{
+				PrefetchChunk(ChunkIndex);
+			}
+		}
+	}
+}
+
+int32 FCachedAudioStreamingManager::GetChunkIndexForTime(const FSoundWaveProxyPtr& InSoundWave, float InTime) const
+{
+	const int32 NumChunks = InSoundWave->GetNumChunks();
+	const float Duration = InSoundWave->GetDuration();
+	if (NumChunks <= 1 || Duration <= 0.0f)
+	{
+		return 0;
+	}
+
+	const float PlaybackFraction = FMath::Clamp(InTime / Duration, 0.0f, 1.0f);
+	return GetChunkIndexForPlaybackFraction(NumChunks, InSoundWave->GetNumFrames(), PlaybackFraction, [&InSoundWave](int32 ChunkIndex) -> const FStreamedAudioChunk&
+	{
+		return InSoundWave->GetChunk(ChunkIndex);
+	});
+}
+
+int32 FCachedAudioStreamingManager::GetChunkIndexForPlaybackFraction(int32 NumChunks, int32 NumFrames, float PlaybackFraction, TFunctionRef<const FStreamedAudioChunk&(int32)> GetChunk)
+{
+	if (NumChunks <= 1)
+	{
+		return 0;
+	}
+
+	// If the wave has a seek table, every chunk knows which frame it starts at.
+	if (GetChunk(1).SeekOffsetInAudioFrames != INDEX_NONE)
+	{
+		const uint32 PlaybackFrame = (uint32)(PlaybackFraction * NumFrames);
+
+		int32 ChunkIndex = 0;
+		while (ChunkIndex + 1 < NumChunks && GetChunk(ChunkIndex + 1).SeekOffsetInAudioFrames <= PlaybackFrame)
+		{
+			ChunkIndex++;
+		}
+		return ChunkIndex;
+	}
+
+	// Otherwise assume a constant bitrate, so that the position in the compressed data follows the position in time.
+	int64 TotalAudioDataSize = 0;
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+	{
+		TotalAudioDataSize += GetChunk(ChunkIndex).AudioDataSize;
+	}
+
+	const int64 PlaybackOffset = (int64)(PlaybackFraction * TotalAudioDataSize);
+	int64 ChunkEndOffset = 0;
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ChunkIndex++)
+	{
+		ChunkEndOffset += GetChunk(ChunkIndex).AudioDataSize;
+		if (PlaybackOffset < ChunkEndOffset)
+		{
+			return ChunkIndex;
+		}
+	}
+
+	return NumChunks - 1;
+}
+
 FAudioChunkCache::FAudioChunkCache(uint32 InMaxChunkSize, uint32 NumChunks, uint64 InMemoryLimitInBytes)
 	: MaxChunkSize(InMaxChunkSize)
 	, MostRecentElement(nullptr)
@@ -854,6 +1018,29 @@ uint64 FAudioChunkCache::AddOrTouchChunk(const FChunkKey& InKey, const TSharedPt
 	}
 }
 
+bool FAudioChunkCache::PrefetchChunk(const FChunkKey& InKey, const TSharedPtr<FSoundWaveData>& InSoundWaveData)
+{
+	if (!InSoundWaveData.IsValid() || !DoesKeyContainValidChunkIndex(InKey, *InSoundWaveData))
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&CacheMutationCriticalSection);
+
+	// Chunks already in the cache are only touched, which keeps them ahead of the chunks that will be evicted to make room for the next reads.
+	const bool bWasInCache = FindElementForKey(InKey) != nullptr;
+
+	const uint64 LookupID = AddOrTouchChunk(InKey, InSoundWaveData, [](EAudioChunkLoadResult) {}, ENamedThreads::AnyThread, false);
+	if (bWasInCache || LookupID == InvalidAudioStreamCacheLookupID)
+	{
+		return false;
+	}
+
+	CachePool[LookupID].bWasPrefetched = true;
+	NumPrefetchedChunks.Increment();
+	return true;
+}
+
 TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, const TSharedPtr<FSoundWaveData>& InSoundWavePtr, bool bBlockForLoadCompletion, bool bNeededForPlayback, uint64& OutCacheOffset)
 {
 	FScopeLock ScopeLock(&CacheMutationCriticalSection);
@@ -862,6 +1049,20 @@ TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, const TShar
 	{
 		OutCacheOffset = FoundElement->CacheLookupID;
 		TouchElement(FoundElement);
+
+		if (FoundElement->bWasPrefetched)
+		{
+			FoundElement->bWasPrefetched = false;
+			if (FoundElement->IsLoadInProgress())
+			{
+				NumLatePrefetches.Increment();
+			}
+			else
+			{
+				NumPrefetchHits.Increment();
+			}
+		}
+
 		if (FoundElement->IsLoadInProgress())
 		{
 			if (bBlockForLoadCompletion)
@@ -929,8 +1130,8 @@ TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, const TShar
 
 				MemoryCounterBytes += ChunkAudioDataSize;
 
-				// Populate key and DataSize. The async read request was set up to write directly into CacheElement->ChunkData.
-				FoundElement->Key = InKey;
+				// Populate DataSize, the key was set by InsertChunk. The async read request was set up to write directly into CacheElement->ChunkData.
+				check(FoundElement->Key == InKey);
 				FoundElement->ChunkDataSize = ChunkAudioDataSize;
 				FoundElement->bIsLoaded = true;
 #if DEBUG_STREAM_CACHE
@@ -974,7 +1175,7 @@ TArrayView<uint8> FAudioChunkCache::GetChunk(const FChunkKey& InKey, const TShar
 
 void FAudioChunkCache::AddNewReferenceToChunk(const FChunkKey& InKey)
 {
-	FScopeLock ScopeLock(&CacheMutationCriticalSection);
+	// The caller copies a handle which already references this chunk, so it can't be evicted and doesn't need CacheMutationCriticalSection.
 	FCacheElement* FoundElement = FindElementForKey(InKey);
 	if (ensure(FoundElement))
 	{
@@ -986,7 +1187,7 @@ void FAudioChunkCache::AddNewReferenceToChunk(const FChunkKey& InKey)
 
 void FAudioChunkCache::RemoveReferenceToChunk(const FChunkKey& InKey)
 {
-	FScopeLock ScopeLock(&CacheMutationCriticalSection);
+	// The caller releases a handle which references this chunk, so it can't be evicted and doesn't need CacheMutationCriticalSection.
 	FCacheElement* FoundElement = FindElementForKey(InKey);
 	if (ensure(FoundElement))
 	{
@@ -1003,7 +1204,10 @@ void FAudioChunkCache::ClearCache()
 
 	UE_LOG(LogAudioStreamCaching, Verbose, TEXT("Clearing Cache"));
 
+	FWriteScopeLock WriteLock(CacheLookupIdLock);
+
 	CachePool.Reset(NumChunks);
+	CacheLookupIdMap.Empty();
 	check(NumberOfLoadsInFlight.GetValue() == 0);
 
 	for (uint32 Index = 0; Index < NumChunks; Index++)
@@ -1167,8 +1371,7 @@ uint64 FAudioChunkCache::TrimMemory(uint64 BytesToFree, bool bInAllowRetainedChu
 
 			CurrentElement->ChunkData = nullptr;
 			CurrentElement->ChunkDataSize = 0;
-			CacheLookupIdMap.Remove(CurrentElement->Key);
-			CurrentElement->Key = FChunkKey();
+			SetElementKey(CurrentElement, FChunkKey());
 
 #if DEBUG_STREAM_CACHE
 			// Reset debug info:
@@ -1211,8 +1414,7 @@ uint64 FAudioChunkCache::TrimMemory(uint64 BytesToFree, bool bInAllowRetainedChu
 					FMemory::Free(CurrentElement->ChunkData);
 					CurrentElement->ChunkData = nullptr;
 					CurrentElement->ChunkDataSize = 0;
-					CacheLookupIdMap.Remove(CurrentElement->Key);
-					CurrentElement->Key = FChunkKey();
+					SetElementKey(CurrentElement, FChunkKey());
 
 #if DEBUG_STREAM_CACHE
 					// Reset debug info:
@@ -1375,32 +1577,40 @@ FString FAudioChunkCache::FlushCacheMissLog()
 		}
 	}
 
-	return TopChunkMissesLog + TEXT("\n") + ConcatenatedCacheMisses;
+	// Prefetches are resolved once the decoder asks for the chunk or the chunk is evicted unused.
+	const int32 NumPrefetchHitsValue = NumPrefetchHits.GetValue();
+	const int32 NumResolvedPrefetches = NumPrefetchHitsValue + NumLatePrefetches.GetValue() + NumUnusedPrefetches.GetValue();
+	const float PrefetchHitRate = NumResolvedPrefetches > 0 ? (100.0f * NumPrefetchHitsValue) / NumResolvedPrefetches : 0.0f;
+
+	FString PrefetchLog = TEXT("Prefetched Chunks:\n");
+	PrefetchLog += TEXT("Reads:\t, Hits:\t, Late:\t, Unused:\t, Hit Rate:\n");
+	PrefetchLog += FString::Printf(TEXT("%d\t, %d\t, %d\t, %d\t, %.1f%%\n"), NumPrefetchedChunks.GetValue(), NumPrefetchHitsValue, NumLatePrefetches.GetValue(), NumUnusedPrefetches.GetValue(), PrefetchHitRate);
+
+	return PrefetchLog + TEXT("\n") + TopChunkMissesLog + TEXT("\n") + ConcatenatedCacheMisses;
 }
 
 FAudioChunkCache::FCacheElement* FAudioChunkCache::FindElementForKey(const FChunkKey& InKey)
 {
-	FScopeLock ScopeLock(&CacheMutationCriticalSection);
-
-	const uint64 CacheOffset = GetCacheLookupIDForChunk(InKey);
-
-	// If we have a known cache offset, access that chunk directly.
-	if (CacheOffset != InvalidAudioStreamCacheLookupID)
 	{
-		check(CacheOffset < CachePool.Num());
+		FReadScopeLock ReadLock(CacheLookupIdLock);
 
-		// Finally, sanity check that the key is still the same.
-		if (CachePool[CacheOffset].Key == InKey)
+		if (const uint64* CacheOffset = CacheLookupIdMap.Find(InKey))
 		{
-			return &CachePool[CacheOffset];
-		}
+			check(*CacheOffset < CachePool.Num());
 
-		UE_LOG(LogAudioStreamCaching, Verbose, TEXT("Cache Miss for soundwave: %s. (Cache Lookup ID [%i] currently stores chunk for Soundwave: %s"),
-			*InKey.SoundWaveName.ToString(), CacheOffset, *CachePool[CacheOffset].Key.SoundWaveName.ToString());
+			// CacheLookupIdMap is updated along with the element keys, sanity check that the key is still the same.
+			FCacheElement& Element = CachePool[*CacheOffset];
+			if (ensureMsgf(Element.Key == InKey, TEXT("Cache Lookup ID [%i] for soundwave %s currently stores chunk for Soundwave: %s"), *CacheOffset, *InKey.SoundWaveName.ToString(), *Element.Key.SoundWaveName.ToString()))
+			{
+				return &Element;
+			}
+		}
 	}
 
 	if (EnableExhaustiveCacheSearchesCVar)
 	{
+		FScopeLock ScopeLock(&CacheMutationCriticalSection);
+
 		// Otherwise, linearly search the cache.
 		if (SearchUsingChunkArrayCVar)
 		{
@@ -1569,7 +1779,7 @@ FAudioChunkCache::FCacheElement* FAudioChunkCache::InsertChunk(const FChunkKey&
 
 		check(CacheElement);
 		CacheElement->bIsLoaded = false;
-		CacheElement->Key = InKey;
+		SetElementKey(CacheElement, InKey);
 		CacheElement->SoundWaveWeakPtr = InSoundWavePtr;
 		TouchElement(CacheElement);
 
@@ -1581,10 +1791,34 @@ FAudioChunkCache::FCacheElement* FAudioChunkCache::InsertChunk(const FChunkKey&
 		}
 	}
 
-	SetCacheLookupIDForChunk(InKey, CacheElement->CacheLookupID);
 	return CacheElement;
 }
 
+void FAudioChunkCache::SetElementKey(FCacheElement* InElement, const FChunkKey& InKey)
+{
+	FWriteScopeLock WriteLock(CacheLookupIdLock);
+
+	const uint64* PreviousCacheLookupID = CacheLookupIdMap.Find(InElement->Key);
+	if (PreviousCacheLookupID && *PreviousCacheLookupID == InElement->CacheLookupID)
+	{
+		CacheLookupIdMap.Remove(InElement->Key);
+	}
+
+	InElement->Key = InKey;
+
+	if (InElement->bWasPrefetched)
+	{
+		// The prefetched chunk is being evicted before anything asked for it.
+		InElement->bWasPrefetched = false;
+		NumUnusedPrefetches.Increment();
+	}
+
+	if (!(InKey == FChunkKey()))
+	{
+		CacheLookupIdMap.Add(InKey, InElement->CacheLookupID);
+	}
+}
+
 void FAudioChunkCache::SetUpLeastRecentChunk()
 {
 	FScopeLock ScopeLock(&CacheMutationCriticalSection);
@@ -1798,13 +2032,8 @@ void FAudioChunkCache::KickOffAsyncLoad(FCacheElement* CacheElement, const FChun
 			// and other threads trying to search for elements by key.
 			
 			// If this ensure is tripped for some reason, we must find the root cause, not remove the ensure.
+			// Keys are only changed through SetElementKey, which keeps CacheLookupIdMap in sync.
 			ensure(CacheElement->Key == InKey);
-			// This can be removed later once we're sure the ensure is never tripped
-			// For now, avoid overwriting when both values are the same to avoid a race condition.
-			if (!(CacheElement->Key == InKey))
-			{
-				CacheElement->Key = InKey;
-			}
 
 			CacheElement->ChunkDataSize = ChunkDataSize;
 			CacheElement->bIsLoaded = true;
@@ -1858,8 +2087,8 @@ void FAudioChunkCache::KickOffAsyncLoad(FCacheElement* CacheElement, const FChun
 				TGraphTask<FClearAudioChunkCacheReadRequestTask>::CreateTask().ConstructAndDispatchWhenReady(LocalReadRequest);
 			}
 
-			// Populate key and DataSize. The async read request was set up to write directly into CacheElement->ChunkData.
-			CacheElement->Key = InKey;
+			// Populate DataSize, the key was set by InsertChunk. The async read request was set up to write directly into CacheElement->ChunkData.
+			ensure(CacheElement->Key == InKey);
 			CacheElement->ChunkDataSize = ChunkDataSize;
 			CacheElement->bIsLoaded = true;
 
@@ -2009,7 +2238,7 @@ bool FAudioChunkCache::DoesKeyContainValidChunkIndex(const FChunkKey& InKey, con
 
 uint64 FAudioChunkCache::GetCacheLookupIDForChunk(const FChunkKey& InChunkKey) const
 {
-	FScopeLock Lock(&CacheMutationCriticalSection);
+	FReadScopeLock ReadLock(CacheLookupIdLock);
 	const uint64* ID = CacheLookupIdMap.Find(InChunkKey);
 
 	if (ID)
@@ -2024,8 +2253,12 @@ uint64 FAudioChunkCache::GetCacheLookupIDForChunk(const FChunkKey& InChunkKey) c
 
 void FAudioChunkCache::SetCacheLookupIDForChunk(const FChunkKey& InChunkKey, uint64 InCacheLookupID)
 {
-	FScopeLock Lock(&CacheMutationCriticalSection);
-	CacheLookupIdMap.FindOrAdd(InChunkKey, InCacheLookupID);
+	// CacheLookupIdMap is maintained when elements change keys, only accept IDs that still store the chunk.
+	FWriteScopeLock WriteLock(CacheLookupIdLock);
+	if (InCacheLookupID < (uint64)CachePool.Num() && CachePool[InCacheLookupID].Key == InChunkKey)
+	{
+		CacheLookupIdMap.Add(InChunkKey, InCacheLookupID);
+	}
 }
 
 
@@ -42,6 +42,13 @@ namespace AsyncTraceCVars
 		TEXT("0: Use game thread, 1: User worker thread"),
 		ECVF_Default);
 
+	static int32 AsyncTraceBatchChunkSize = 128;
+	static FAutoConsoleVariableRef CVarAsyncTraceBatchChunkSize(
+		TEXT("AsyncTraceBatchChunkSize"),
+		AsyncTraceBatchChunkSize,
+		TEXT("Number of queries of an FTraceBatch that run in a single worker task."),
+		ECVF_Default);
+
 	bool IsAsyncTraceOnWorkerThreads()
 	{
 		return RunAsyncTraceOnWorkerThread != 0 && (FApp::ShouldUseThreadingForPerformance() || FForkProcessHelper::IsForkedMultithreadInstance());
@@ -356,6 +363,148 @@ namespace
 	}
 }
 
+FTraceBatch::FTraceBatch()
+	: TraceChannel(DefaultCollisionChannel)
+	, TraceType(EAsyncTraceType::Single)
+	, ChunkSize(0)
+{
+	CollisionParams.CollisionShape = FCollisionShape::LineShape;
+}
+
+FTraceBatch::~FTraceBatch()
+{
+	Wait();
+}
+
+void FTraceBatch::Reset()
+{
+	Wait();
+
+	Starts.Reset();
+	Ends.Reset();
+	Rots.Reset();
+	BlockingHits.Reset();
+	HitStarts.Reset();
+	HitCounts.Reset();
+
+	// Chunks keep their hit buffers, they are reset when they run again
+}
+
+void FTraceBatch::Reserve(int32 NumQueries)
+{
+	Starts.Reserve(NumQueries);
+	Ends.Reserve(NumQueries);
+	Rots.Reserve(NumQueries);
+	BlockingHits.Reserve(NumQueries);
+	HitStarts.Reserve(NumQueries);
+	HitCounts.Reserve(NumQueries);
+}
+
+void FTraceBatch::SetParams(EAsyncTraceType InTraceType, ECollisionChannel InTraceChannel, const FCollisionShape& InCollisionShape, const FCollisionQueryParams& InParams,
+	const FCollisionResponseParams& InResponseParam, const FCollisionObjectQueryParams& InObjectQueryParam)
+{
+	Wait();
+
+	TraceType = InTraceType;
+	TraceChannel = InTraceChannel;
+	CollisionParams.CollisionShape = InCollisionShape;
+	CollisionParams.CollisionQueryParam = InParams;
+	CollisionParams.ResponseParam = InResponseParam;
+	CollisionParams.ObjectQueryParam = InObjectQueryParam;
+}
+
+void FTraceBatch::Wait()
+{
+	if (CompletionEvents.Num() > 0)
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_WaitForTraceBatch);
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(CompletionEvents, ENamedThreads::GameThread);
+		CompletionEvents.Reset();
+	}
+}
+
+bool FTraceBatch::IsComplete() const
+{
+	for (const FGraphEventRef& Event : CompletionEvents)
+	{
+		if (!Event->IsComplete())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+TArrayView<const FHitResult> FTraceBatch::GetHits(int32 QueryIndex) const
+{
+	checkSlow(IsComplete());
+
+	const int32 HitCount = HitCounts[QueryIndex];
+	if (HitCount == 0)
+	{
+		return TArrayView<const FHitResult>();
+	}
+
+	const FChunk& Chunk = Chunks[QueryIndex / ChunkSize];
+	return TArrayView<const FHitResult>(Chunk.Hits.GetData() + HitStarts[QueryIndex], HitCount);
+}
+
+void FTraceBatch::RunChunk(const UWorld* World, int32 ChunkIndex, int32 FirstQuery, int32 NumQueries)
+{
+	FChunk& Chunk = Chunks[ChunkIndex];
+	Chunk.Hits.Reset();
+
+	const FCollisionShape& CollisionShape = CollisionParams.CollisionShape;
+	const FCollisionQueryParams& QueryParams = CollisionParams.CollisionQueryParam;
+	const FCollisionResponseParams& ResponseParams = CollisionParams.ResponseParam;
+	const FCollisionObjectQueryParams& ObjectParams = CollisionParams.ObjectQueryParam;
+	const bool bRaycast = (CollisionShape.ShapeType == ECollisionShape::Line) || CollisionShape.IsNearlyZero();
+
+	const int32 EndQuery = FirstQuery + NumQueries;
+	for (int32 QueryIndex = FirstQuery; QueryIndex < EndQuery; ++QueryIndex)
+	{
+		const FVector& Start = Starts[QueryIndex];
+		const FVector& End = Ends[QueryIndex];
+		const int32 HitStart = Chunk.Hits.Num();
+		bool bHit = false;
+
+		// MULTI
+		if (TraceType == EAsyncTraceType::Multi)
+		{
+			bHit = bRaycast
+				? FPhysicsInterface::RaycastMulti(World, Chunk.Scratch, Start, End, TraceChannel, QueryParams, ResponseParams, ObjectParams)
+				: FPhysicsInterface::GeomSweepMulti(World, CollisionShape, Rots[QueryIndex], Chunk.Scratch, Start, End, TraceChannel, QueryParams, ResponseParams, ObjectParams);
+
+			Chunk.Hits.Append(Chunk.Scratch);
+		}
+		// SINGLE
+		else if (TraceType == EAsyncTraceType::Single)
+		{
+			FHitResult Result;
+
+			bHit = bRaycast
+				? FPhysicsInterface::RaycastSingle(World, Result, Start, End, TraceChannel, QueryParams, ResponseParams, ObjectParams)
+				: FPhysicsInterface::GeomSweepSingle(World, CollisionShape, Rots[QueryIndex], Result, Start, End, TraceChannel, QueryParams, ResponseParams, ObjectParams);
+
+			if (bHit)
+			{
+				Chunk.Hits.Add(Result);
+			}
+		}
+		// TEST
+		else
+		{
+			bHit = bRaycast
+				? FPhysicsInterface::RaycastTest(World, Start, End, TraceChannel, QueryParams, ResponseParams, ObjectParams)
+				: FPhysicsInterface::GeomSweepTest(World, CollisionShape, Rots[QueryIndex], Start, End, TraceChannel, QueryParams, ResponseParams, ObjectParams);
+		}
+
+		BlockingHits[QueryIndex] = bHit ? 1 : 0;
+		HitStarts[QueryIndex] = HitStart;
+		HitCounts[QueryIndex] = Chunk.Hits.Num() - HitStart;
+	}
+}
+
 FWorldAsyncTraceState::FWorldAsyncTraceState()
 	: CurrentFrame             (0)
 {
@@ -421,6 +570,62 @@ FTraceHandle UWorld::AsyncOverlapByProfile(const FVector& Pos, const FQuat& Rot,
 	return StartNewTrace(AsyncTraceState, FOverlapDatum(this, CollisionShape, Params, ResponseParam, FCollisionObjectQueryParams::DefaultObjectQueryParam, TraceChannel, UserData, Pos, Rot, InDelegate, AsyncTraceState.CurrentFrame));
 }
 
+void UWorld::AsyncTraceBatch(FTraceBatch& Batch)
+{
+	// Using async traces outside of the game thread can cause memory corruption
+	check(IsInGameThread());
+
+	// A batch can only be in flight once
+	Batch.Wait();
+
+	const int32 NumQueries = Batch.Num();
+	if (NumQueries == 0)
+	{
+		return;
+	}
+
+	Batch.BlockingHits.SetNumUninitialized(NumQueries, EAllowShrinking::No);
+	Batch.HitStarts.SetNumUninitialized(NumQueries, EAllowShrinking::No);
+	Batch.HitCounts.SetNumUninitialized(NumQueries, EAllowShrinking::No);
+
+	Batch.ChunkSize = FMath::Max(AsyncTraceCVars::AsyncTraceBatchChunkSize, 1);
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumQueries, Batch.ChunkSize);
+	if (Batch.Chunks.Num() < NumChunks)
+	{
+		Batch.Chunks.SetNum(NumChunks);
+	}
+
+	if (!AsyncTraceCVars::IsAsyncTraceOnWorkerThreads())
+	{
+		for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+		{
+			const int32 FirstQuery = ChunkIndex * Batch.ChunkSize;
+			Batch.RunChunk(this, ChunkIndex, FirstQuery, FMath::Min(Batch.ChunkSize, NumQueries - FirstQuery));
+		}
+		return;
+	}
+
+	AsyncTraceData& DataBuffer = AsyncTraceState.GetBufferForCurrentFrame();
+
+	// Check we're allowed to do an async call here
+	check(DataBuffer.bAsyncAllowed);
+
+	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		const int32 FirstQuery = ChunkIndex * Batch.ChunkSize;
+		const int32 NumChunkQueries = FMath::Min(Batch.ChunkSize, NumQueries - FirstQuery);
+
+		FGraphEventRef Event = FFunctionGraphTask::CreateAndDispatchWhenReady([World = this, &Batch, ChunkIndex, FirstQuery, NumChunkQueries]()
+		{
+			Batch.RunChunk(World, ChunkIndex, FirstQuery, NumChunkQueries);
+		}, TStatId(), nullptr, CPrio_FAsyncTraceTask.Get());
+
+		// The world waits on the batch along with the rest of this frame's async traces
+		DataBuffer.AsyncTraceCompletionEvent.Add(Event);
+		Batch.CompletionEvents.Add(MoveTemp(Event));
+	}
+}
+
 bool UWorld::IsTraceHandleValid(const FTraceHandle& Handle, bool bOverlapTrace)
 {
 	// only valid if it's previous frame or current frame
@@ -63,6 +63,9 @@ DECLARE_CYCLE_STAT(TEXT("Char SmoothClientPosition_Visual"), STAT_CharacterMovem
 DECLARE_CYCLE_STAT(TEXT("Char Physics Interation"), STAT_CharPhysicsInteraction, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char StepUp"), STAT_CharStepUp, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char FindFloor"), STAT_CharFindFloor, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char FloorQueryCache Lookups"), STAT_CharFloorQueryCacheLookups, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char FloorQueryCache Hits"), STAT_CharFloorQueryCacheHits, STATGROUP_Character);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Char FloorQueryCache Saved Scene Queries"), STAT_CharFloorQueryCacheSavedSceneQueries, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char AdjustFloorHeight"), STAT_CharAdjustFloorHeight, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char Update Acceleration"), STAT_CharUpdateAcceleration, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char MoveUpdateDelegate"), STAT_CharMoveUpdateDelegate, STATGROUP_Character);
@@ -241,6 +244,28 @@ namespace CharacterMovementCVars
 		TEXT("p.AsyncCharacterMovement"),
 		AsyncCharacterMovement, TEXT("1 enables asynchronous simulation of character movement on physics thread. Toggling this at runtime is not recommended. This feature is not fully developed, and its use is discouraged."));
 
+	static int32 FloorQueryCache = 0;
+	FAutoConsoleVariableRef CVarFloorQueryCache(
+		TEXT("p.FloorQueryCache"),
+		FloorQueryCache,
+		TEXT("Whether FindFloor() reuses the previous walkable floor result instead of querying the scene again, as long as the floor and the capsule size haven't changed and the capsule moved less than p.FloorQueryCache.MaxDistance.\n")
+		TEXT("0: Disable, 1: Enable"),
+		ECVF_Default);
+
+	static float FloorQueryCacheMaxDistance = 0.1f;
+	FAutoConsoleVariableRef CVarFloorQueryCacheMaxDistance(
+		TEXT("p.FloorQueryCache.MaxDistance"),
+		FloorQueryCacheMaxDistance,
+		TEXT("Distance in cm the capsule can move relative to its floor while FindFloor() still reuses the cached floor result."),
+		ECVF_Default);
+
+	static float FloorQueryCacheMaxAge = 0.5f;
+	FAutoConsoleVariableRef CVarFloorQueryCacheMaxAge(
+		TEXT("p.FloorQueryCache.MaxAge"),
+		FloorQueryCacheMaxAge,
+		TEXT("Time in seconds a cached floor result is reused for before the floor is queried again, so objects moving under a standing character are eventually found."),
+		ECVF_Default);
+
 	int32 BasedMovementMode = 2;
 	FAutoConsoleVariableRef CVarBasedMovementMode(
 		TEXT("p.BasedMovementMode"),
@@ -6694,6 +6719,12 @@ bool UCharacterMovementComponent::IsWithinEdgeTolerance(const FVector& CapsuleLo
 }
 
 
+namespace CharacterMovementFloorQueryCache
+{
+	/** Scene queries issued by ComputeFloorDist(), to know how many a cached floor result saves. */
+	static thread_local int32 NumSceneQueries = 0;
+}
+
 void UCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const
 {
 	UE_LOG(LogCharacterMovement, VeryVerbose, TEXT("[Role:%d] ComputeFloorDist: %s at location %s"), (int32)CharacterOwner->GetLocalRole(), *GetNameSafe(CharacterOwner), *CapsuleLocation.ToString());
@@ -6762,6 +6793,7 @@ void UCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocatio
 
 		FHitResult Hit(1.f);
 		bBlockingHit = FloorSweepTest(Hit, CapsuleLocation, CapsuleLocation + RotateGravityToWorld(FVector(0.f,0.f,-TraceDist)), CollisionChannel, CapsuleShape, QueryParams, ResponseParam);
+		++CharacterMovementFloorQueryCache::NumSceneQueries;
 
 		if (bBlockingHit)
 		{
@@ -6780,6 +6812,7 @@ void UCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocatio
 					Hit.Reset(1.f, false);
 
 					bBlockingHit = FloorSweepTest(Hit, CapsuleLocation, CapsuleLocation + RotateGravityToWorld(FVector(0.f,0.f,-TraceDist)), CollisionChannel, CapsuleShape, QueryParams, ResponseParam);
+					++CharacterMovementFloorQueryCache::NumSceneQueries;
 				}
 			}
 
@@ -6820,6 +6853,7 @@ void UCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocatio
 
 		FHitResult Hit(1.f);
 		bBlockingHit = GetWorld()->LineTraceSingleByChannel(Hit, LineTraceStart, LineTraceStart + Down, CollisionChannel, QueryParams, ResponseParam);
+		++CharacterMovementFloorQueryCache::NumSceneQueries;
 
 		if (bBlockingHit)
 		{
@@ -6873,8 +6907,13 @@ void UCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFin
 
 		if ( bAlwaysCheckFloor || !bCanUseCachedLocation || bForceNextFloorCheck || bJustTeleported )
 		{
+			// A forced check must query the scene, the cached floor may be what it is meant to replace.
+			if (bForceNextFloorCheck || bJustTeleported)
+			{
+				MutableThis->FloorQueryCache.bValid = false;
+			}
 			MutableThis->bForceNextFloorCheck = false;
-			ComputeFloorDist(CapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
+			ComputeFloorDistCached(CapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
 		}
 		else
 		{
@@ -6901,7 +6940,8 @@ void UCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFin
 			else
 			{
 				MutableThis->bForceNextFloorCheck = false;
-				ComputeFloorDist(CapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
+				MutableThis->FloorQueryCache.bValid = false;
+				ComputeFloorDistCached(CapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
 			}
 		}
 	}
@@ -6947,6 +6987,82 @@ void UCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFin
 }
 
 
+void UCharacterMovementComponent::ComputeFloorDistCached(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const
+{
+	UCharacterMovementComponent* MutableThis = const_cast<UCharacterMovementComponent*>(this);
+	FFloorQueryCache& Cache = MutableThis->FloorQueryCache;
+
+	// A supplied downward sweep already saves the sweep, and may not match what is cached.
+	if (!CharacterMovementCVars::FloorQueryCache || DownwardSweepResult != nullptr)
+	{
+		Cache.bValid = false;
+		ComputeFloorDist(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, DownwardSweepResult);
+		return;
+	}
+
+	float PawnRadius, PawnHalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(PawnRadius, PawnHalfHeight);
+	const double Time = GetWorld()->GetTimeSeconds();
+
+	INC_DWORD_STAT(STAT_CharFloorQueryCacheLookups);
+
+	if (Cache.bValid
+		&& Cache.CapsuleRadius == PawnRadius
+		&& Cache.CapsuleHalfHeight == PawnHalfHeight
+		&& Cache.SweepRadius == SweepRadius
+		&& Cache.LineDistance == LineDistance
+		&& Cache.SweepDistance == SweepDistance
+		&& Cache.GravityDirection == GetGravityDirection()
+		&& Time - Cache.Time <= CharacterMovementCVars::FloorQueryCacheMaxAge)
+	{
+		const UPrimitiveComponent* Floor = Cache.Floor.Get();
+		if (Floor && Floor->IsQueryCollisionEnabled() && Floor->GetComponentTransform().Equals(Cache.FloorTransform, 0.0))
+		{
+			const FVector Delta = CapsuleLocation - Cache.FloorTransform.TransformPosition(Cache.RelativeCapsuleLocation);
+			if (Delta.SizeSquared() <= FMath::Square(CharacterMovementCVars::FloorQueryCacheMaxDistance))
+			{
+				// Within the distance threshold the floor is assumed flat, so only the height above it changes.
+				const float HeightDelta = RotateWorldToGravity(Delta).Z;
+				OutFloorResult = Cache.FloorResult;
+				OutFloorResult.FloorDist += HeightDelta;
+				if (OutFloorResult.bLineTrace)
+				{
+					OutFloorResult.LineDist += HeightDelta;
+				}
+
+				INC_DWORD_STAT(STAT_CharFloorQueryCacheHits);
+				INC_DWORD_STAT_BY(STAT_CharFloorQueryCacheSavedSceneQueries, Cache.NumSceneQueries);
+				CSV_CUSTOM_STAT(CharacterMovement, FloorQueryCacheHits, 1, ECsvCustomStatOp::Accumulate);
+				CSV_CUSTOM_STAT(CharacterMovement, FloorQueryCacheSavedSceneQueries, Cache.NumSceneQueries, ECsvCustomStatOp::Accumulate);
+				return;
+			}
+		}
+	}
+
+	const int32 NumSceneQueriesBefore = CharacterMovementFloorQueryCache::NumSceneQueries;
+	ComputeFloorDist(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, DownwardSweepResult);
+
+	// Only walkable floors are cached, without one the character is about to fall and keeps moving anyway.
+	UPrimitiveComponent* Floor = OutFloorResult.HitResult.GetComponent();
+	Cache.bValid = OutFloorResult.IsWalkableFloor() && Floor != nullptr;
+	if (Cache.bValid)
+	{
+		Cache.FloorResult = OutFloorResult;
+		Cache.Floor = Floor;
+		Cache.FloorTransform = Floor->GetComponentTransform();
+		Cache.RelativeCapsuleLocation = Cache.FloorTransform.InverseTransformPosition(CapsuleLocation);
+		Cache.GravityDirection = GetGravityDirection();
+		Cache.CapsuleRadius = PawnRadius;
+		Cache.CapsuleHalfHeight = PawnHalfHeight;
+		Cache.SweepRadius = SweepRadius;
+		Cache.LineDistance = LineDistance;
+		Cache.SweepDistance = SweepDistance;
+		Cache.Time = Time;
+		Cache.NumSceneQueries = CharacterMovementFloorQueryCache::NumSceneQueries - NumSceneQueriesBefore;
+	}
+}
+
+
 void UCharacterMovementComponent::K2_FindFloor(FVector CapsuleLocation, FFindFloorResult& FloorResult) const
 {
 	const bool SavedForceNextFloorCheck(bForceNextFloorCheck);
@@ -47,6 +47,47 @@ float UCurveFloat::GetFloatValue( float InTime ) const
 	return FloatCurve.Eval(InTime);
 }
 
+void UCurveFloat::GetFloatValues(TArrayView<const float> InTimes, TArrayView<float> OutValues) const
+{
+	FloatCurve.Eval(InTimes, OutValues);
+}
+
+void UCurveFloat::UpdateBakedEvaluation()
+{
+	if (bUseBakedEvaluation)
+	{
+		FloatCurve.EnableBakedEvaluation(FMath::Max(BakedEvaluationErrorTolerance, UE_SMALL_NUMBER));
+	}
+	else
+	{
+		FloatCurve.DisableBakedEvaluation();
+	}
+}
+
+void UCurveFloat::PostLoad()
+{
+	Super::PostLoad();
+
+	UpdateBakedEvaluation();
+}
+
+#if WITH_EDITOR
+void UCurveFloat::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Keys may have been edited in place
+	UpdateBakedEvaluation();
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+
+void UCurveFloat::OnCurveChanged(const TArray<FRichCurveEditInfo>& ChangedCurveEditInfos)
+{
+	FloatCurve.InvalidateBakedEvaluation();
+
+	Super::OnCurveChanged(ChangedCurveEditInfos);
+}
+#endif // WITH_EDITOR
+
 TArray<FRichCurveEditInfoConst> UCurveFloat::GetCurves() const
 {
 	TArray<FRichCurveEditInfoConst> Curves;
@@ -2,6 +2,10 @@
 
 #include "Curves/RichCurve.h"
 #include "Curves/CurveEvaluation.h"
+#include "Async/Mutex.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
 #include "UObject/UE5MainStreamObjectVersion.h"
 
 // Broken - do not turn on! 
@@ -300,6 +304,8 @@ FRichCurveKey* FRichCurve::GetFirstMatchingKey(const TArray<FKeyHandle>& KeyHand
 
 FKeyHandle FRichCurve::AddKey( const float InTime, const float InValue, const bool bUnwindRotation, FKeyHandle NewHandle )
 {
+	BakedEvaluation.Invalidate();
+
 	int32 Index = 0;
 	if (Keys.Num() == 0 || Keys.Last().Time < InTime)
 	{
@@ -364,6 +370,7 @@ void FRichCurve::DeleteKey(FKeyHandle InKeyHandle)
 {
 	int32 Index = GetIndex(InKeyHandle);
 	
+	BakedEvaluation.Invalidate();
 	Keys.RemoveAt(Index);
 	AutoSetTangents();
 
@@ -380,6 +387,7 @@ FKeyHandle FRichCurve::UpdateOrAddKey(float InTime, float InValue, const bool bU
 
 		if (FMath::IsNearlyEqual(KeyTime, InTime, KeyTimeTolerance))
 		{
+			BakedEvaluation.Invalidate();
 			Keys[KeyIndex].Value = InValue;
 
 			return GetKeyHandle(KeyIndex);
@@ -461,6 +469,7 @@ void FRichCurve::SetKeyValue(FKeyHandle KeyHandle, float NewValue, bool bAutoSet
 		return;
 	}
 
+	BakedEvaluation.Invalidate();
 	GetKey(KeyHandle).Value = NewValue;
 
 	if (bAutoSetTangents)
@@ -522,6 +531,7 @@ void FRichCurve::SetKeyInterpMode(FKeyHandle KeyHandle, ERichCurveInterpMode New
 		return;
 	}
 
+	BakedEvaluation.Invalidate();
 	GetKey(KeyHandle).InterpMode = NewInterpMode;
 	if (bAutoSetTangents)
 	{
@@ -537,6 +547,7 @@ void FRichCurve::SetKeyTangentMode(FKeyHandle KeyHandle, ERichCurveTangentMode N
 		return;
 	}
 
+	BakedEvaluation.Invalidate();
 	GetKey(KeyHandle).TangentMode = NewTangentMode;
 	if (bAutoSetTangents)
 	{
@@ -552,6 +563,7 @@ void FRichCurve::SetKeyTangentWeightMode(FKeyHandle KeyHandle, ERichCurveTangent
 		return;
 	}
 
+	BakedEvaluation.Invalidate();
 	GetKey(KeyHandle).TangentWeightMode = NewTangentWeightMode;
 	if (bAutoSetTangents)
 	{
@@ -666,6 +678,7 @@ void FRichCurve::GetValueRange(float& MinValue, float& MaxValue) const
 
 void FRichCurve::Reset()
 {
+	BakedEvaluation.Invalidate();
 	Keys.Empty();
 	KeyHandlesToIndices.Empty();
 }
@@ -673,6 +686,8 @@ void FRichCurve::Reset()
 
 void FRichCurve::AutoSetTangents(float Tension)
 {
+	BakedEvaluation.Invalidate();
+
 	// Iterate over all points in this InterpCurve
 	for (int32 KeyIndex = 0; KeyIndex<Keys.Num(); KeyIndex++)
 	{
@@ -751,6 +766,8 @@ void FRichCurve::AutoSetTangents(float Tension)
 
 void FRichCurve::ReadjustTimeRange(float NewMinTimeRange, float NewMaxTimeRange, bool bInsert/* whether insert or remove*/, float OldStartTime, float OldEndTime)
 {
+	BakedEvaluation.Invalidate();
+
 	// first readjust modified time keys
 	float ModifiedDuration = OldEndTime - OldStartTime;
 
@@ -972,6 +989,8 @@ void FRichCurve::RemoveRedundantKeysInternal(float Tolerance, int32 InStartKeepK
 		return;
 	}
 
+	BakedEvaluation.Invalidate();
+
 	//Build some helper data for managing the HandleTokey map
 	TArray<FKeyHandle> AllHandlesByIndex;
 	TArray<FKeyHandle> KeepHandles;
@@ -1245,6 +1264,310 @@ float FRichCurve::Eval(float InTime, float InDefaultValue) const
 }
 
 
+/** Uniformly resampled values of a FRichCurve between its first and last key */
+struct FRichCurveBakedSamples
+{
+	/** Keys the samples were built from, to catch keys that were resized or reallocated without invalidating the samples */
+	const FRichCurveKey* SourceKeys = nullptr;
+	int32 NumSourceKeys = 0;
+
+	float StartTime = 0.f;
+	float EndTime = 0.f;
+	float SamplesPerSecond = 0.f;
+
+	/** Empty if the curve can't be resampled within the error tolerance, it is then evaluated exactly */
+	TArray<float> Values;
+};
+
+/** Settings and lazily built samples for the baked evaluation of a FRichCurve */
+struct FRichCurveBakedEvaluation
+{
+	FRichCurveBakedEvaluation(float InErrorTolerance, int32 InMaxSamples)
+		: ErrorTolerance(InErrorTolerance)
+		, MaxSamples(InMaxSamples)
+	{
+	}
+
+	~FRichCurveBakedEvaluation()
+	{
+		Invalidate();
+	}
+
+	/** Frees all samples, must not be called while the curve is being evaluated */
+	void Invalidate()
+	{
+		delete Samples.exchange(nullptr, std::memory_order_acq_rel);
+		FreeRetiredSamples();
+	}
+
+	/** Frees the retired samples if no other batched evaluation may still be reading them. Called with Lock held by one of NumOwnReaders readers. */
+	void ReclaimRetiredSamplesLocked(int32 NumOwnReaders)
+	{
+		// Readers register before loading Samples, and retired samples are never published again.
+		// So once no other reader is registered, nothing can be left reading them.
+		if (NumReaders.load() == NumOwnReaders)
+		{
+			FreeRetiredSamples();
+		}
+	}
+
+	void FreeRetiredSamples()
+	{
+		for (FRichCurveBakedSamples* Retired : RetiredSamples)
+		{
+			delete Retired;
+		}
+		RetiredSamples.Reset();
+		bHasRetiredSamples.store(false, std::memory_order_relaxed);
+	}
+
+	/** Max error allowed between the samples and the curve */
+	const float ErrorTolerance;
+
+	/** Max number of samples between the first and last key, curves that need more are evaluated exactly */
+	const int32 MaxSamples;
+
+	// NOTE: Samples are built concurrently and lazily
+	std::atomic<FRichCurveBakedSamples*> Samples = nullptr;
+
+	/** Number of batched evaluations currently reading samples */
+	std::atomic<int32> NumReaders = 0;
+
+	/** Samples that were replaced after the keys changed but may still be read by other threads, freed once there are no readers left */
+	TArray<FRichCurveBakedSamples*> RetiredSamples;
+	std::atomic<bool> bHasRetiredSamples = false;
+
+	UE::FMutex Lock;
+};
+
+FRichCurveBakedEvaluationPtr::FRichCurveBakedEvaluationPtr(const FRichCurveBakedEvaluationPtr& Other)
+{
+	if (Other.Evaluation)
+	{
+		Evaluation = MakeUnique<FRichCurveBakedEvaluation>(Other.Evaluation->ErrorTolerance, Other.Evaluation->MaxSamples);
+	}
+}
+
+FRichCurveBakedEvaluationPtr::FRichCurveBakedEvaluationPtr(FRichCurveBakedEvaluationPtr&& Other) = default;
+
+FRichCurveBakedEvaluationPtr& FRichCurveBakedEvaluationPtr::operator=(const FRichCurveBakedEvaluationPtr& Other)
+{
+	if (this != &Other)
+	{
+		Evaluation.Reset();
+		if (Other.Evaluation)
+		{
+			Evaluation = MakeUnique<FRichCurveBakedEvaluation>(Other.Evaluation->ErrorTolerance, Other.Evaluation->MaxSamples);
+		}
+	}
+	return *this;
+}
+
+FRichCurveBakedEvaluationPtr& FRichCurveBakedEvaluationPtr::operator=(FRichCurveBakedEvaluationPtr&& Other) = default;
+
+FRichCurveBakedEvaluationPtr::~FRichCurveBakedEvaluationPtr() = default;
+
+void FRichCurveBakedEvaluationPtr::Invalidate()
+{
+	if (Evaluation)
+	{
+		Evaluation->Invalidate();
+	}
+}
+
+static FRichCurveBakedSamples* BuildBakedSamples(const FRichCurve& Curve, const float ErrorTolerance, const int32 MaxSamples)
+{
+	const TArray<FRichCurveKey>& Keys = Curve.GetConstRefOfKeys();
+
+	FRichCurveBakedSamples* Samples = new FRichCurveBakedSamples();
+	Samples->SourceKeys = Keys.GetData();
+	Samples->NumSourceKeys = Keys.Num();
+
+	// Curves without a range to sample are cheap to evaluate exactly
+	if (Keys.Num() < 2 || !(Keys.Last().Time - Keys[0].Time > UE_SMALL_NUMBER) || MaxSamples < 2)
+	{
+		return Samples;
+	}
+
+	Samples->StartTime = Keys[0].Time;
+	Samples->EndTime = Keys.Last().Time;
+	const float Duration = Samples->EndTime - Samples->StartTime;
+	TArray<float>& Values = Samples->Values;
+
+	auto SampleUniformly = [&Curve, &Values, StartTime = Samples->StartTime, Duration](int32 NumSamples)
+	{
+		const float SampleInterval = Duration / float(NumSamples - 1);
+		Values.SetNumUninitialized(NumSamples);
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			Values[SampleIndex] = Curve.Eval(StartTime + SampleIndex * SampleInterval);
+		}
+	};
+
+	// Start from a few samples per key and halve the interval until the error is within the tolerance
+	int32 NumSamples = FMath::Min(FMath::Max(Keys.Num() * 4, 16), MaxSamples);
+	SampleUniformly(NumSamples);
+
+	TArray<float> MidValues;
+	while (true)
+	{
+		const float SampleInterval = Duration / float(NumSamples - 1);
+
+		// The error is estimated halfway between samples, where linear interpolation is usually furthest from the curve
+		bool bWithinTolerance = true;
+		MidValues.SetNumUninitialized(NumSamples - 1);
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples - 1; ++SampleIndex)
+		{
+			MidValues[SampleIndex] = Curve.Eval(Samples->StartTime + (SampleIndex + 0.5f) * SampleInterval);
+			const float SampledValue = 0.5f * (Values[SampleIndex] + Values[SampleIndex + 1]);
+			bWithinTolerance &= FMath::Abs(MidValues[SampleIndex] - SampledValue) <= ErrorTolerance;
+		}
+
+		if (bWithinTolerance)
+		{
+			Samples->SamplesPerSecond = 1.f / SampleInterval;
+			return Samples;
+		}
+
+		if (NumSamples == MaxSamples)
+		{
+			Values.Empty();
+			return Samples;
+		}
+
+		if (NumSamples * 2 - 1 <= MaxSamples)
+		{
+			// Halving the interval keeps the previous samples at the even indices, and the values evaluated halfway become the odd ones
+			Values.SetNumUninitialized(NumSamples * 2 - 1);
+			for (int32 SampleIndex = NumSamples - 1; SampleIndex > 0; --SampleIndex)
+			{
+				Values[SampleIndex * 2] = Values[SampleIndex];
+				Values[SampleIndex * 2 - 1] = MidValues[SampleIndex - 1];
+			}
+			NumSamples = NumSamples * 2 - 1;
+		}
+		else
+		{
+			NumSamples = MaxSamples;
+			SampleUniformly(NumSamples);
+		}
+	}
+}
+
+void FRichCurve::EnableBakedEvaluation(float ErrorTolerance, int32 MaxSamples)
+{
+	check(ErrorTolerance > 0.f);
+
+	BakedEvaluation.Evaluation = MakeUnique<FRichCurveBakedEvaluation>(ErrorTolerance, MaxSamples);
+}
+
+void FRichCurve::DisableBakedEvaluation()
+{
+	BakedEvaluation.Evaluation.Reset();
+}
+
+/** Returns the baked samples for the current keys, building them if needed. The caller must be registered in NumReaders. */
+static const FRichCurveBakedSamples& GetBakedSamples(const FRichCurve& Curve, FRichCurveBakedEvaluation& Baked)
+{
+	const TArray<FRichCurveKey>& Keys = Curve.GetConstRefOfKeys();
+	auto IsUpToDate = [&Keys](const FRichCurveBakedSamples* Samples)
+	{
+		return Samples && Samples->SourceKeys == Keys.GetData() && Samples->NumSourceKeys == Keys.Num();
+	};
+
+	FRichCurveBakedSamples* Samples = Baked.Samples.load(std::memory_order_acquire);
+	if (!IsUpToDate(Samples))
+	{
+		UE::TScopeLock Lock(Baked.Lock);
+
+		// After obtaining the lock, another thread might have built the samples already
+		Samples = Baked.Samples.load(std::memory_order_acquire);
+		if (!IsUpToDate(Samples))
+		{
+			if (Samples)
+			{
+				Baked.RetiredSamples.Add(Samples);
+				Baked.bHasRetiredSamples.store(true);
+			}
+
+			Samples = BuildBakedSamples(Curve, Baked.ErrorTolerance, Baked.MaxSamples);
+			Baked.Samples.store(Samples);
+
+			Baked.ReclaimRetiredSamplesLocked(1);
+		}
+	}
+
+	return *Samples;
+}
+
+void FRichCurve::Eval(TArrayView<const float> InTimes, TArrayView<float> OutValues, float InDefaultValue) const
+{
+	check(InTimes.Num() == OutValues.Num());
+
+	FRichCurveBakedEvaluation* Baked = BakedEvaluation.Evaluation.Get();
+	if (!Baked)
+	{
+		for (int32 Index = 0; Index < InTimes.Num(); ++Index)
+		{
+			OutValues[Index] = Eval(InTimes[Index], InDefaultValue);
+		}
+		return;
+	}
+
+	Baked->NumReaders.fetch_add(1);
+	ON_SCOPE_EXIT
+	{
+		// The last reader out frees the samples retired while it was reading
+		if (Baked->NumReaders.fetch_sub(1) == 1 && Baked->bHasRetiredSamples.load())
+		{
+			UE::TScopeLock Lock(Baked->Lock);
+			Baked->ReclaimRetiredSamplesLocked(0);
+		}
+	};
+
+	const FRichCurveBakedSamples& Samples = GetBakedSamples(*this, *Baked);
+	if (Samples.Values.Num() == 0)
+	{
+		for (int32 Index = 0; Index < InTimes.Num(); ++Index)
+		{
+			OutValues[Index] = Eval(InTimes[Index], InDefaultValue);
+		}
+		return;
+	}
+
+	const float* RESTRICT Values = Samples.Values.GetData();
+	const int32 LastSegment = Samples.Values.Num() - 2;
+	const float StartTime = Samples.StartTime;
+	const float EndTime = Samples.EndTime;
+	const float SamplesPerSecond = Samples.SamplesPerSecond;
+
+	// Branchless lookup of every time clamped to the sampled range
+	int32 NumOutOfRange = 0;
+	for (int32 Index = 0; Index < InTimes.Num(); ++Index)
+	{
+		const float Time = InTimes[Index];
+		const float ClampedTime = FMath::Clamp(Time, StartTime, EndTime);
+		NumOutOfRange += (ClampedTime != Time) ? 1 : 0;
+
+		const float SamplePosition = (ClampedTime - StartTime) * SamplesPerSecond;
+		const int32 SampleIndex = FMath::Min((int32)SamplePosition, LastSegment);
+		OutValues[Index] = FMath::Lerp(Values[SampleIndex], Values[SampleIndex + 1], SamplePosition - (float)SampleIndex);
+	}
+
+	// Times outside of the keys depend on the extrapolation modes, evaluate them exactly
+	if (NumOutOfRange > 0)
+	{
+		for (int32 Index = 0; Index < InTimes.Num(); ++Index)
+		{
+			const float Time = InTimes[Index];
+			if (Time < StartTime || Time > EndTime)
+			{
+				OutValues[Index] = Eval(Time, InDefaultValue);
+			}
+		}
+	}
+}
+
 bool FRichCurve::operator==(const FRichCurve& Curve) const
 {
 	if(Keys.Num() != Curve.Keys.Num())
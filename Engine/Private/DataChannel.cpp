@@ -1274,7 +1274,7 @@ FPacketIdRange UChannel::SendBunch( FOutBunch* Bunch, bool Merge )
 		OutBunch                       = Connection->LastOutBunch;
 		Bunch                          = &Connection->LastOut;
 		check(!Bunch->IsError());
-		Connection->PopLastStart();
+		Connection->PopLastStartForMerge(PreExistingBits);
 		Connection->Driver->OutBunches--;
 	}
 
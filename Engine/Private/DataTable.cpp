@@ -10,6 +10,7 @@
 #include "UObject/AssetRegistryTagsContext.h"
 #include "UObject/LinkerLoad.h"
 #include "DataTableCSV.h"
+#include "DataTableCustomVersion.h"
 #include "DataTableJSON.h"
 #include "EditorFramework/AssetImportData.h"
 #include "Engine/UserDefinedStruct.h"
@@ -40,6 +41,81 @@ namespace
 #endif // WITH_EDITORONLY_DATA
 
 	UE_CALL_ONCE(UE::GC::RegisterSlowImplementation, &UDataTable::AddReferencedObjects, UE::GC::EAROFlags::ExtraSlow);
+
+	/** A plain data property of a row struct, flattened out of any nested structs, and where its value goes in a packed binary record. */
+	struct FBinaryRowField
+	{
+		const FProperty* Property = nullptr;
+		int32 Offset = 0;
+		int32 PackedSize = 0;
+	};
+
+	/**
+	 * Flattens the properties of a row struct into the fields of a packed binary record, and hashes their names, types and sizes.
+	 * Returns false if the struct holds anything but plain data, or relies on custom serialization.
+	 */
+	bool GatherBinaryRowFields(const UStruct* Struct, int32 BaseOffset, TArray<FBinaryRowField>& OutFields, uint32& InOutLayoutHash)
+	{
+		if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(Struct))
+		{
+			if (ScriptStruct->StructFlags & (STRUCT_SerializeNative | STRUCT_PostSerializeNative))
+			{
+				return false;
+			}
+		}
+
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			const FProperty* Property = *It;
+
+			// Tagged serialization doesn't save these either. Editor only properties are also left out so that the cooker and the game agree on the layout.
+			if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_Deprecated | CPF_EditorOnly))
+			{
+				continue;
+			}
+
+			const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			const bool bIsPlainValue = Property->IsA<FNumericProperty>() || Property->IsA<FEnumProperty>() || Property->IsA<FBoolProperty>();
+			if (!StructProperty && !bIsPlainValue)
+			{
+				return false;
+			}
+
+			InOutLayoutHash = FCrc::StrCrc32(*Property->GetName(), InOutLayoutHash);
+			InOutLayoutHash = FCrc::StrCrc32(*Property->GetClass()->GetName(), InOutLayoutHash);
+
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ArrayIndex++)
+			{
+				const int32 Offset = BaseOffset + Property->GetOffset_ForInternal() + ArrayIndex * Property->ElementSize;
+				if (StructProperty)
+				{
+					if (!GatherBinaryRowFields(StructProperty->Struct, Offset, OutFields, InOutLayoutHash))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					// Bools may be bitfields, they are packed as a byte
+					const int32 PackedSize = Property->IsA<FBoolProperty>() ? 1 : Property->ElementSize;
+					InOutLayoutHash = HashCombine(InOutLayoutHash, PackedSize);
+					OutFields.Add({ Property, Offset, PackedSize });
+				}
+			}
+		}
+
+		return true;
+	}
+
+	int32 GetBinaryRecordSize(const TArray<FBinaryRowField>& Fields)
+	{
+		int32 RecordSize = 0;
+		for (const FBinaryRowField& Field : Fields)
+		{
+			RecordSize += Field.PackedSize;
+		}
+		return RecordSize;
+	}
 }
 
 UDataTable::FScopedDataTableChange::FScopedDataTableChange(UDataTable* InTable)
@@ -73,6 +149,7 @@ UDataTable::UDataTable(const FObjectInitializer& ObjectInitializer)
 	bIgnoreExtraFields = false;
 	bIgnoreMissingFields = false;
 	bStripFromClientBuilds = false;
+	bUseBinaryRowStorage = false;
 
 #if WITH_EDITORONLY_DATA
 	{ static const FAutoRegisterLocalizationDataGatheringCallback AutomaticRegistrationOfLocalizationGatherer(UDataTable::StaticClass(), &GatherDataTableForLocalization); }
@@ -159,6 +236,119 @@ void UDataTable::SaveStructData(FStructuredArchiveSlot Slot)
 	}
 }
 
+bool UDataTable::CanUseBinaryRowStorage() const
+{
+	if (!bUseBinaryRowStorage || !RowStruct || !RowStruct->GetCppStructOps() || !RowStruct->IsChildOf(FTableRowBase::StaticStruct()))
+	{
+		return false;
+	}
+
+	TArray<FBinaryRowField> Fields;
+	uint32 LayoutHash = 0;
+	return GatherBinaryRowFields(RowStruct, 0, Fields, LayoutHash);
+}
+
+void UDataTable::SaveBinaryRowData(FStructuredArchiveRecord Record)
+{
+	TArray<FBinaryRowField> Fields;
+	uint32 LayoutHash = 0;
+	verify(GatherBinaryRowFields(RowStruct, 0, Fields, LayoutHash));
+	int32 RecordSize = GetBinaryRecordSize(Fields);
+
+	// Records are written in the order of the row map, which is the order the table exposes its rows in.
+	TArray<FName> RowNames;
+	RowMap.GenerateKeyArray(RowNames);
+
+	BinaryRowBulkData.Lock(LOCK_READ_WRITE);
+	uint8* PackedData = (uint8*)BinaryRowBulkData.Realloc((int64)RowNames.Num() * RecordSize);
+	for (const TPair<FName, uint8*>& TableRowPair : RowMap)
+	{
+		for (const FBinaryRowField& Field : Fields)
+		{
+			const uint8* ValuePtr = TableRowPair.Value + Field.Offset;
+			if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Field.Property))
+			{
+				*PackedData = BoolProperty->GetPropertyValue(ValuePtr) ? 1 : 0;
+			}
+			else
+			{
+				FMemory::Memcpy(PackedData, ValuePtr, Field.PackedSize);
+			}
+			PackedData += Field.PackedSize;
+		}
+	}
+	BinaryRowBulkData.Unlock();
+
+	// Keep the records in their own region of the package so that they can be memory mapped instead of read into a temporary buffer
+	BinaryRowBulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload | BULKDATA_MemoryMapPayload);
+
+	Record << SA_VALUE(TEXT("LayoutHash"), LayoutHash);
+	Record << SA_VALUE(TEXT("RecordSize"), RecordSize);
+	Record << SA_VALUE(TEXT("RowNames"), RowNames);
+	BinaryRowBulkData.Serialize(Record.GetUnderlyingArchive(), this);
+}
+
+void UDataTable::LoadBinaryRowData(FStructuredArchiveRecord Record)
+{
+	uint32 SavedLayoutHash = 0;
+	int32 SavedRecordSize = 0;
+	TArray<FName> RowNames;
+	Record << SA_VALUE(TEXT("LayoutHash"), SavedLayoutHash);
+	Record << SA_VALUE(TEXT("RecordSize"), SavedRecordSize);
+	Record << SA_VALUE(TEXT("RowNames"), RowNames);
+	BinaryRowBulkData.Serialize(Record.GetUnderlyingArchive(), this);
+
+	TArray<FBinaryRowField> Fields;
+	uint32 LayoutHash = 0;
+	const bool bHasBinaryLayout = RowStruct && GatherBinaryRowFields(RowStruct, 0, Fields, LayoutHash);
+	const int32 RecordSize = GetBinaryRecordSize(Fields);
+
+	if (!bHasBinaryLayout || LayoutHash != SavedLayoutHash || RecordSize != SavedRecordSize || BinaryRowBulkData.GetBulkDataSize() != (int64)RowNames.Num() * RecordSize)
+	{
+		UE_LOG(LogDataTable, Error, TEXT("RowStruct of DataTable '%s' doesn't match the layout its binary rows were cooked with, the rows were not loaded!"), *GetPathName());
+		BinaryRowBulkData.RemoveBulkData();
+		return;
+	}
+
+	DATATABLE_CHANGE_SCOPE();
+
+	// All rows go in a single allocation, each one still gets constructed so that it has the struct's defaults for anything that isn't saved
+	const int32 RowAlignment = RowStruct->GetMinAlignment();
+	const int32 RowStride = Align(RowStruct->GetStructureSize(), RowAlignment);
+	RowBlockSize = (SIZE_T)RowStride * RowNames.Num();
+	RowBlock = RowBlockSize > 0 ? (uint8*)FMemory::Malloc(RowBlockSize, RowAlignment) : nullptr;
+
+	const uint8* PackedData = (const uint8*)BinaryRowBulkData.Lock(LOCK_READ_ONLY);
+
+	RowMap.Reserve(RowNames.Num());
+	for (int32 RowIdx = 0; RowIdx < RowNames.Num(); RowIdx++)
+	{
+		uint8* RowData = RowBlock + (SIZE_T)RowIdx * RowStride;
+		RowStruct->InitializeStruct(RowData);
+
+		for (const FBinaryRowField& Field : Fields)
+		{
+			uint8* ValuePtr = RowData + Field.Offset;
+			if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Field.Property))
+			{
+				BoolProperty->SetPropertyValue(ValuePtr, *PackedData != 0);
+			}
+			else
+			{
+				FMemory::Memcpy(ValuePtr, PackedData, Field.PackedSize);
+			}
+			PackedData += Field.PackedSize;
+		}
+
+		RowMap.Add(RowNames[RowIdx], RowData);
+	}
+
+	BinaryRowBulkData.Unlock();
+
+	// The rows hold their own copy now, so the mapping can go
+	BinaryRowBulkData.RemoveBulkData();
+}
+
 void UDataTable::GetPreloadDependencies(TArray<UObject*>& OutDeps)
 {
 	Super::GetPreloadDependencies(OutDeps);
@@ -235,6 +425,8 @@ void UDataTable::Serialize(FStructuredArchiveRecord Record)
 	FArchive& BaseArchive = Record.GetUnderlyingArchive();
 	LLM_SCOPE_BYTAG(DataTable);
 
+	BaseArchive.UsingCustomVersion(FDataTableCustomVersion::GUID);
+
 #if WITH_EDITORONLY_DATA
 	// Make sure and update RowStructName before calling the parent Serialize (which will save the properties)
 	if (BaseArchive.IsSaving() && RowStruct)
@@ -255,15 +447,36 @@ void UDataTable::Serialize(FStructuredArchiveRecord Record)
 		}
 	}
 
+	// Binary rows are only ever cooked, and cooked packages are the only ones filtering editor only data when they are loaded
+	bool bBinaryRows = BaseArchive.IsSaving() && BaseArchive.IsCooking() && BaseArchive.IsFilterEditorOnly() && CanUseBinaryRowStorage();
+	if (BaseArchive.IsFilterEditorOnly() && BaseArchive.CustomVer(FDataTableCustomVersion::GUID) >= FDataTableCustomVersion::BinaryRowStorage)
+	{
+		Record << SA_VALUE(TEXT("BinaryRows"), bBinaryRows);
+	}
+
 	if(BaseArchive.IsLoading())
 	{
 		DATATABLE_CHANGE_SCOPE();
 		EmptyTable();
-		LoadStructData(Record.EnterField(TEXT("Data")));
+		if (bBinaryRows)
+		{
+			LoadBinaryRowData(Record.EnterField(TEXT("BinaryRowData")).EnterRecord());
+		}
+		else
+		{
+			LoadStructData(Record.EnterField(TEXT("Data")));
+		}
 	}
 	else if(BaseArchive.IsSaving())
 	{
-		SaveStructData(Record.EnterField(TEXT("Data")));
+		if (bBinaryRows)
+		{
+			SaveBinaryRowData(Record.EnterField(TEXT("BinaryRowData")).EnterRecord());
+		}
+		else
+		{
+			SaveStructData(Record.EnterField(TEXT("Data")));
+		}
 	}
 }
 
@@ -423,11 +636,18 @@ void UDataTable::EmptyTable()
 	{
 		uint8* RowData = RowIt.Value();
 		EmptyUsingStruct.DestroyStruct(RowData);
-		FMemory::Free(RowData);
+		if (!IsRowInRowBlock(RowData))
+		{
+			FMemory::Free(RowData);
+		}
 	}
 
 	// Finally empty the map
 	RowMap.Empty();
+
+	FMemory::Free(RowBlock);
+	RowBlock = nullptr;
+	RowBlockSize = 0;
 }
 
 void UDataTable::RemoveRow(FName RowName)
@@ -447,7 +667,12 @@ void UDataTable::RemoveRowInternal(FName RowName)
 	if (RowData)
 	{
 		EmptyUsingStruct.DestroyStruct(RowData);
-		FMemory::Free(RowData);
+
+		// Rows in the row block are freed along with it when the table is emptied
+		if (!IsRowInRowBlock(RowData))
+		{
+			FMemory::Free(RowData);
+		}
 	}
 }
 
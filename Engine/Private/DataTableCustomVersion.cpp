@@ -0,0 +1,9 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DataTableCustomVersion.h"
+#include "Serialization/CustomVersion.h"
+
+const FGuid FDataTableCustomVersion::GUID(0xCBDAE448, 0x14CA47D2, 0xAA2DD4B8, 0x7B69F0AF);
+
+// Register the custom version with core
+FCustomVersionRegistration GDataTableCustomVersion(FDataTableCustomVersion::GUID, FDataTableCustomVersion::LatestVersion, TEXT("DataTableVer"));
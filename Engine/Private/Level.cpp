@@ -34,6 +34,8 @@ Level.cpp: Level-related functions
 #include "GameFramework/WorldSettings.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/Texture2D.h"
+#include "Engine/StaticMesh.h"
+#include "Components/StaticMeshComponent.h"
 #include "ContentStreaming.h"
 #include "Engine/AssetUserData.h"
 #include "Engine/LevelScriptBlueprint.h"
@@ -103,6 +105,15 @@ static FAutoConsoleVariableRef CVarOptimizeActorRegistration(
 	ECVF_Default
 );
 
+int32 GParallelComponentRegistrationBatchSize = 0;
+static FAutoConsoleVariableRef CVarParallelComponentRegistrationBatchSize(
+	TEXT("s.ParallelComponentRegistrationBatchSize"),
+	GParallelComponentRegistrationBatchSize,
+	TEXT("Number of actors whose components get the thread safe part of their registration (creating collision meshes from cooked data) done in parallel\n")
+	TEXT("ahead of being registered on the game thread when making a level visible. 0 disables it, and that work is done as each component registers."),
+	ECVF_Default
+);
+
 // RouteActorInit for a single actor generally takes about half the time to complete compared to component initialization
 float GRouteActorInitializationWorkUnitWeighting = 0.5f;
 static FAutoConsoleVariableRef CVarRouteActorInitializationWorkUnitWeighting(
@@ -1694,6 +1705,7 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 		case EIncrementalComponentState::Finalize:
 			IncrementalComponentState = EIncrementalComponentState::Init;
 			CurrentActorIndexForIncrementalUpdate = 0;
+			PreparedActorIndexForIncrementalUpdate = 0;
 			bHasCurrentActorCalledPreRegister = false;
 			bAreComponentsCurrentlyRegistered = true;
 			CreateCluster();
@@ -1724,6 +1736,11 @@ bool ULevel::IncrementalRegisterComponents(bool bPreRegisterComponents, int32 Nu
 
 	while (CurrentActorIndexForIncrementalUpdate < Actors.Num())
 	{
+		if (GParallelComponentRegistrationBatchSize > 0 && CurrentActorIndexForIncrementalUpdate >= PreparedActorIndexForIncrementalUpdate)
+		{
+			PrepareComponentRegistration(FMath::Min(CurrentActorIndexForIncrementalUpdate + GParallelComponentRegistrationBatchSize, Actors.Num()));
+		}
+
 		AActor* Actor = Actors[CurrentActorIndexForIncrementalUpdate];
 		bool bAllComponentsRegistered = true;
 		if (IsValid(Actor))
@@ -1776,12 +1793,52 @@ bool ULevel::IncrementalRegisterComponents(bool bPreRegisterComponents, int32 Nu
 			Context->Process();
 		}
 		CurrentActorIndexForIncrementalUpdate = 0;
+		PreparedActorIndexForIncrementalUpdate = 0;
 		return true;
 	}
 
 	return false;
 }
 
+void ULevel::PrepareComponentRegistration(int32 EndActorIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ULevel::PrepareComponentRegistration);
+
+	// Gather on the game thread, only static meshes are considered as their body setup is shared with the mesh and GetBodySetup has no side effects for them
+	TSet<UBodySetup*> UniqueBodySetups;
+	for (int32 ActorIndex = CurrentActorIndexForIncrementalUpdate; ActorIndex < EndActorIndex; ActorIndex++)
+	{
+		AActor* Actor = Actors[ActorIndex];
+		if (!IsValid(Actor) || (Actor->HasActorRegisteredAllComponents() && GOptimizeActorRegistration != 0))
+		{
+			continue;
+		}
+
+		Actor->ForEachComponent<UStaticMeshComponent>(false, [&UniqueBodySetups](UStaticMeshComponent* Component)
+		{
+			const UStaticMesh* StaticMesh = Component->GetStaticMesh();
+			if (!Component->IsRegistered() && Component->bAutoRegister && StaticMesh && !StaticMesh->IsCompiling() && Component->GetCollisionEnabled() != ECollisionEnabled::NoCollision)
+			{
+				UBodySetup* Setup = Component->GetBodySetup();
+				if (Setup && !Setup->bCreatedPhysicsMeshes)
+				{
+					UniqueBodySetups.Add(Setup);
+				}
+			}
+		});
+	}
+
+	// Same as FPhysScene_Chaos::ProcessDeferredCreatePhysicsState, creating the meshes from cooked data is safe to do in parallel.
+	// Components then find them ready when creating their physics state during registration, whether or not that is deferred.
+	TArray<UBodySetup*> BodySetups = UniqueBodySetups.Array();
+	ParallelFor(TEXT("PrepareComponentRegistration.PF"), BodySetups.Num(), 1, [&BodySetups](int32 Index)
+	{
+		BodySetups[Index]->CreatePhysicsMeshes();
+	});
+
+	PreparedActorIndexForIncrementalUpdate = EndActorIndex;
+}
+
 #if WITH_EDITOR
 bool ULevel::IncrementalRunConstructionScripts(bool bProcessAllActors)
 {
@@ -42,6 +42,7 @@
 #include "ComputeWorkerInterface.h"
 #include "RenderGraphBuilder.h"
 #include "StaticMeshResources.h"
+#include "Algo/Sort.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -792,6 +793,63 @@ static TAutoConsoleVariable<int32> CVarAllowAsyncRenderThreadUpdatesEditor(
 	0,
 	TEXT("Used to control async renderthread updates in the editor."));
 
+static TAutoConsoleVariable<int32> CVarAsyncRenderThreadUpdatesMinBatchSize(
+	TEXT("AsyncRenderThreadUpdatesMinBatchSize"),
+	32,
+	TEXT("If > 0, async renderthread updates are grouped by owning actor so that the components of an actor are always updated together on one thread,\n")
+	TEXT("and the groups are packed into parallel tasks of at least this many components. 0 dispatches every component on its own."));
+
+#if (CSV_PROFILER && !UE_BUILD_SHIPPING)
+CSV_DEFINE_CATEGORY_MODULE(ENGINE_API, EndOfFrameUpdateClasses, true);
+
+static TAutoConsoleVariable<int32> CVarRecordEndOfFrameUpdateClassTimesToCSV(
+	TEXT("csv.RecordEndOfFrameUpdateClassTimes"),
+	0,
+	TEXT("Record the time spent in end of frame updates by component class (ms) when performing CSV capture"));
+#endif
+
+/** Time spent in end of frame updates by component class, merged from the tasks doing them */
+struct FEndOfFrameUpdateClassTimes
+{
+	void Merge(const TMap<const UClass*, uint64>& TaskCycles)
+	{
+		FScopeLock ScopeLock(&CyclesLock);
+		for (const TPair<const UClass*, uint64>& ClassCycles : TaskCycles)
+		{
+			Cycles.FindOrAdd(ClassCycles.Key) += ClassCycles.Value;
+		}
+	}
+
+#if (CSV_PROFILER && !UE_BUILD_SHIPPING)
+	void RecordToCSV() const
+	{
+		for (const TPair<const UClass*, uint64>& ClassCycles : Cycles)
+		{
+			// Use accumulate in case we have more than one world updating
+			FCsvProfiler::Get()->RecordCustomStat(ClassCycles.Key->GetFName(), CSV_CATEGORY_INDEX(EndOfFrameUpdateClasses), FPlatformTime::ToMilliseconds64(ClassCycles.Value), ECsvCustomStatOp::Accumulate);
+		}
+	}
+#endif
+
+	FCriticalSection CyclesLock;
+	TMap<const UClass*, uint64> Cycles;
+};
+
+/** Does the deferred render updates of a component, adding the time they took to its class when ClassCycles is set. */
+static void DoDeferredRenderUpdates(UActorComponent* Component, TMap<const UClass*, uint64>* ClassCycles)
+{
+	if (ClassCycles)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Component->DoDeferredRenderUpdates_Concurrent();
+		ClassCycles->FindOrAdd(Component->GetClass()) += FPlatformTime::Cycles64() - StartCycles;
+	}
+	else
+	{
+		Component->DoDeferredRenderUpdates_Concurrent();
+	}
+}
+
 namespace EComponentMarkedForEndOfFrameUpdateState
 {
 	enum Type
@@ -1075,7 +1133,36 @@ void UWorld::SendAllEndOfFrameUpdates()
 		LocalComponentsThatNeedEndOfFrameUpdate.Num() > FTaskGraphInterface::Get().GetNumWorkerThreads() &&
 		FTaskGraphInterface::Get().GetNumWorkerThreads() > 2;
 
-	auto ParallelWork = [IsUsingParallelNotifyEvents](int32 Index)
+#if (CSV_PROFILER && !UE_BUILD_SHIPPING)
+	const bool bRecordClassTimes = FCsvProfiler::Get()->IsCapturing() && CVarRecordEndOfFrameUpdateClassTimesToCSV.GetValueOnGameThread() != 0;
+#else
+	const bool bRecordClassTimes = false;
+#endif
+	FEndOfFrameUpdateClassTimes ClassTimes;
+
+	// Components of the same actor can share render side state (e.g. leader pose components), keeping them in the same batch means they never
+	// update concurrently, and packing small actors together keeps the per task overhead down
+	static TArray<int32> BatchStarts;
+	const int32 MinBatchSize = CVarAsyncRenderThreadUpdatesMinBatchSize.GetValueOnGameThread();
+	if (MinBatchSize > 0 && LocalComponentsThatNeedEndOfFrameUpdate.Num() > 0)
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_PostTickComponentUpdate_Batch);
+
+		auto GetOwnerKey = [](const UActorComponent* Component) { return Component ? (UPTRINT)Component->GetOwner() : 0; };
+		Algo::Sort(LocalComponentsThatNeedEndOfFrameUpdate, [&GetOwnerKey](const UActorComponent* A, const UActorComponent* B) { return GetOwnerKey(A) < GetOwnerKey(B); });
+
+		BatchStarts.Add(0);
+		for (int32 Index = 1; Index < LocalComponentsThatNeedEndOfFrameUpdate.Num(); Index++)
+		{
+			if (Index - BatchStarts.Last() >= MinBatchSize && GetOwnerKey(LocalComponentsThatNeedEndOfFrameUpdate[Index]) != GetOwnerKey(LocalComponentsThatNeedEndOfFrameUpdate[Index - 1]))
+			{
+				BatchStarts.Add(Index);
+			}
+		}
+	}
+	const int32 NumBatches = MinBatchSize > 0 ? BatchStarts.Num() : LocalComponentsThatNeedEndOfFrameUpdate.Num();
+
+	auto ParallelWork = [IsUsingParallelNotifyEvents, MinBatchSize, bRecordClassTimes, &ClassTimes](int32 BatchIndex)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(DeferredRenderUpdates);
 		FOptionalTaskTagScope Scope(ETaskTag::EParallelGameThread);
@@ -1085,19 +1172,31 @@ void UWorld::SendAllEndOfFrameUpdates()
 			FObjectCacheEventSink::ProcessQueuedNotifyEvents();
 		}
 #endif
-		UActorComponent* NextComponent = LocalComponentsThatNeedEndOfFrameUpdate[Index];
-		if (NextComponent)
+		const int32 BeginIndex = MinBatchSize > 0 ? BatchStarts[BatchIndex] : BatchIndex;
+		const int32 EndIndex = MinBatchSize > 0 ? (BatchIndex + 1 < BatchStarts.Num() ? BatchStarts[BatchIndex + 1] : LocalComponentsThatNeedEndOfFrameUpdate.Num()) : BatchIndex + 1;
+
+		TMap<const UClass*, uint64> BatchClassCycles;
+		for (int32 Index = BeginIndex; Index < EndIndex; Index++)
 		{
-			if (NextComponent->IsRegistered() && !NextComponent->IsTemplate() && IsValid(NextComponent))
+			UActorComponent* NextComponent = LocalComponentsThatNeedEndOfFrameUpdate[Index];
+			if (NextComponent)
 			{
-				NextComponent->DoDeferredRenderUpdates_Concurrent();
+				if (NextComponent->IsRegistered() && !NextComponent->IsTemplate() && IsValid(NextComponent))
+				{
+					DoDeferredRenderUpdates(NextComponent, bRecordClassTimes ? &BatchClassCycles : nullptr);
+				}
+				check(!IsValid(NextComponent) || NextComponent->GetMarkedForEndOfFrameUpdateState() == EComponentMarkedForEndOfFrameUpdateState::Marked);
+				FMarkComponentEndOfFrameUpdateState::Set(NextComponent, INDEX_NONE, EComponentMarkedForEndOfFrameUpdateState::Unmarked);
 			}
-			check(!IsValid(NextComponent) || NextComponent->GetMarkedForEndOfFrameUpdateState() == EComponentMarkedForEndOfFrameUpdateState::Marked);
-			FMarkComponentEndOfFrameUpdateState::Set(NextComponent, INDEX_NONE, EComponentMarkedForEndOfFrameUpdateState::Unmarked);
+		}
+
+		if (BatchClassCycles.Num() > 0)
+		{
+			ClassTimes.Merge(BatchClassCycles);
 		}
 	};
 
-	auto GTWork = [this]()
+	auto GTWork = [this, bRecordClassTimes, &ClassTimes]()
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_PostTickComponentUpdate_ForcedGameThread);
 
@@ -1126,9 +1225,15 @@ void UWorld::SendAllEndOfFrameUpdates()
 		// We are only regenerating render state here, not components
 		FStaticMeshComponentBulkReregisterContext ReregisterContext(Scene, DeferredUpdates, EBulkReregister::RenderState);
 
+		TMap<const UClass*, uint64> GameThreadClassCycles;
 		for (UActorComponent* Component : DeferredUpdates)
 		{
-			Component->DoDeferredRenderUpdates_Concurrent();
+			DoDeferredRenderUpdates(Component, bRecordClassTimes ? &GameThreadClassCycles : nullptr);
+		}
+
+		if (GameThreadClassCycles.Num() > 0)
+		{
+			ClassTimes.Merge(GameThreadClassCycles);
 		}
 	};
 
@@ -1137,7 +1242,7 @@ void UWorld::SendAllEndOfFrameUpdates()
 #if WITH_EDITOR
 		FObjectCacheEventSink::BeginQueueNotifyEvents();
 #endif
-		ParallelForWithPreWork(LocalComponentsThatNeedEndOfFrameUpdate.Num(), ParallelWork, GTWork);
+		ParallelForWithPreWork(NumBatches, ParallelWork, GTWork);
 #if WITH_EDITOR
 		// Any remaining events will be flushed with this call
 		FObjectCacheEventSink::EndQueueNotifyEvents();
@@ -1146,8 +1251,15 @@ void UWorld::SendAllEndOfFrameUpdates()
 	else
 	{
 		GTWork();
-		ParallelFor(LocalComponentsThatNeedEndOfFrameUpdate.Num(), ParallelWork);
+		ParallelFor(NumBatches, ParallelWork);
 	}
+
+#if (CSV_PROFILER && !UE_BUILD_SHIPPING)
+	if (bRecordClassTimes)
+	{
+		ClassTimes.RecordToCSV();
+	}
+#endif
 	
 	for (UMaterialParameterCollectionInstance* ParameterCollectionInstance : ParameterCollectionInstances)
 	{
@@ -1159,6 +1271,7 @@ void UWorld::SendAllEndOfFrameUpdates()
 	bMaterialParameterCollectionInstanceNeedsDeferredUpdate = false;
 			
 	LocalComponentsThatNeedEndOfFrameUpdate.Reset();
+	BatchStarts.Reset();
 
 	EndSendEndOfFrameUpdatesDrawEvent(SendAllEndOfFrameUpdates);
 }
@@ -0,0 +1,195 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Net/RepLayout.h"
+#include "Components/SceneComponent.h"
+#include "Components/SplineComponent.h"
+#include "Components/TimelineComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace UE::Net::Private
+{
+	struct FRepLayoutTestUtil
+	{
+		static const TArray<FRepLayoutCmd>& GetCmds(const FRepLayout& RepLayout)
+		{
+			return RepLayout.Cmds;
+		}
+
+		static int32 GetNumCompareBlocks(const FRepLayout& RepLayout)
+		{
+			int32 NumBlocks = 0;
+			for (const FRepLayoutCompareBlock& Block : RepLayout.CompareBlocks)
+			{
+				NumBlocks += Block.NumCmds > 0 ? 1 : 0;
+			}
+			return NumBlocks;
+		}
+
+		/** Runs a forced compare and returns the resulting changelist, which is empty if nothing changed. */
+		static void CompareProperties(const FRepLayout& RepLayout, FRepChangelistState& ChangelistState, const UObject* Object, TArray<uint16>& OutChanged)
+		{
+			OutChanged.Reset();
+
+			const FReplicationFlags RepFlags;
+			const ERepLayoutResult Result = RepLayout.CompareProperties(nullptr, &ChangelistState, (const uint8*)Object, RepFlags, /*bForceCompare=*/true);
+
+			if (Result == ERepLayoutResult::Success)
+			{
+				const int32 HistoryIndex = (ChangelistState.HistoryEnd - 1) % FRepChangelistState::MAX_CHANGE_HISTORY;
+				OutChanged = ChangelistState.ChangeHistory[HistoryIndex].Changed;
+			}
+		}
+	};
+}
+
+namespace RepLayoutCompareTestsPrivate
+{
+	using namespace UE::Net::Private;
+
+	static void SetUseCompareBlocks(bool bUseCompareBlocks)
+	{
+		IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.UseRepCompareBlocks"));
+		check(CVar);
+		CVar->Set(bUseCompareBlocks, ECVF_SetByCode);
+	}
+
+	// Top level numeric commands (outside of dynamic arrays) that can be invalidated in the shadow buffer to simulate a change
+	static void GatherMutableShadowOffsets(const FRepLayout& RepLayout, TArray<int32>& OutShadowOffsets)
+	{
+		const TArray<FRepLayoutCmd>& Cmds = FRepLayoutTestUtil::GetCmds(RepLayout);
+		for (int32 CmdIndex = 0; CmdIndex < Cmds.Num(); ++CmdIndex)
+		{
+			const FRepLayoutCmd& Cmd = Cmds[CmdIndex];
+			switch (Cmd.Type)
+			{
+				case ERepLayoutCmdType::DynamicArray:
+					CmdIndex = Cmd.EndCmd - 1;
+					break;
+
+				case ERepLayoutCmdType::PropertyFloat:
+				case ERepLayoutCmdType::PropertyInt:
+				case ERepLayoutCmdType::PropertyUInt32:
+				case ERepLayoutCmdType::PropertyUInt64:
+				case ERepLayoutCmdType::PropertyVector:
+				case ERepLayoutCmdType::PropertyVector100:
+				case ERepLayoutCmdType::PropertyVectorQ:
+				case ERepLayoutCmdType::PropertyVectorNormal:
+				case ERepLayoutCmdType::PropertyVector10:
+				case ERepLayoutCmdType::PropertyRotator:
+				case ERepLayoutCmdType::PropertyPlane:
+					OutShadowOffsets.Add(Cmd.ShadowOffset);
+					break;
+
+				default:
+					break;
+			}
+		}
+	}
+
+	// Flips a bit in every Nth mutable property of the shadow state, so the next compare sees those properties as changed
+	static void MutateShadowState(FRepChangelistState& ChangelistState, const TArray<int32>& ShadowOffsets, const int32 Frame, const int32 Stride)
+	{
+		uint8* ShadowData = ChangelistState.StaticBuffer.GetData();
+		for (int32 Index = Frame % Stride; Index < ShadowOffsets.Num(); Index += Stride)
+		{
+			ShadowData[ShadowOffsets[Index]] ^= 1;
+		}
+	}
+
+	/** Compares CompareProperties results and timings with and without the compare plan for the given class. */
+	static void RunCompareBenchmark(FAutomationTestBase& Test, UClass* Class, const int32 NumFrames, const int32 ChangeStride)
+	{
+		UObject* Object = NewObject<UObject>(GetTransientPackage(), Class);
+
+		TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(Class);
+		TSharedPtr<FReplicationChangelistMgr> PlainMgr = RepLayout->CreateReplicationChangelistMgr(Object, ECreateReplicationChangelistMgrFlags::SkipDeltaCustomState);
+		TSharedPtr<FReplicationChangelistMgr> PlannedMgr = RepLayout->CreateReplicationChangelistMgr(Object, ECreateReplicationChangelistMgrFlags::SkipDeltaCustomState);
+
+		FRepChangelistState& PlainState = *PlainMgr->GetRepChangelistState();
+		FRepChangelistState& PlannedState = *PlannedMgr->GetRepChangelistState();
+
+		TArray<int32> ShadowOffsets;
+		GatherMutableShadowOffsets(*RepLayout, ShadowOffsets);
+
+		TArray<uint16> PlainChanged;
+		TArray<uint16> PlannedChanged;
+
+		// Bring both shadow states in sync with the object before comparing anything
+		FRepLayoutTestUtil::CompareProperties(*RepLayout, PlainState, Object, PlainChanged);
+		FRepLayoutTestUtil::CompareProperties(*RepLayout, PlannedState, Object, PlannedChanged);
+
+		// Both modes must produce identical changelists
+		int32 NumMismatches = 0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			MutateShadowState(PlainState, ShadowOffsets, Frame, ChangeStride);
+			MutateShadowState(PlannedState, ShadowOffsets, Frame, ChangeStride);
+
+			SetUseCompareBlocks(false);
+			FRepLayoutTestUtil::CompareProperties(*RepLayout, PlainState, Object, PlainChanged);
+
+			SetUseCompareBlocks(true);
+			FRepLayoutTestUtil::CompareProperties(*RepLayout, PlannedState, Object, PlannedChanged);
+
+			NumMismatches += (PlainChanged != PlannedChanged) ? 1 : 0;
+		}
+
+		Test.TestEqual(FString::Printf(TEXT("%s changelists match with and without compare plan"), *Class->GetName()), NumMismatches, 0);
+
+		auto TimeCompares = [&](FRepChangelistState& State, bool bUseCompareBlocks)
+		{
+			SetUseCompareBlocks(bUseCompareBlocks);
+
+			TArray<uint16> Changed;
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				MutateShadowState(State, ShadowOffsets, Frame, ChangeStride);
+				FRepLayoutTestUtil::CompareProperties(*RepLayout, State, Object, Changed);
+			}
+			return FPlatformTime::Seconds() - StartTime;
+		};
+
+		const double PlainSeconds = TimeCompares(PlainState, false);
+		const double PlannedSeconds = TimeCompares(PlannedState, true);
+
+		Test.AddInfo(FString::Printf(TEXT("%s: %d cmds, %d compare blocks, %d frames. Per property: %.3f ms, compare plan: %.3f ms (%.2fx)"),
+			*Class->GetName(), FRepLayoutTestUtil::GetCmds(*RepLayout).Num(), FRepLayoutTestUtil::GetNumCompareBlocks(*RepLayout), NumFrames,
+			PlainSeconds * 1000.0, PlannedSeconds * 1000.0, PlannedSeconds > 0.0 ? PlainSeconds / PlannedSeconds : 0.0));
+
+		Object->MarkAsGarbage();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRepLayoutComparePlanBenchmark, "Network.RepLayout.ComparePlanBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FRepLayoutComparePlanBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace RepLayoutCompareTestsPrivate;
+
+	IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.UseRepCompareBlocks"));
+	if (!TestNotNull(TEXT("net.UseRepCompareBlocks exists"), CVar))
+	{
+		return false;
+	}
+
+	const bool bOldUseCompareBlocks = CVar->GetBool();
+
+	// Representative layouts: flat top level properties, a replicated struct, and a replicated struct of POD arrays
+	constexpr int32 NumFrames = 20000;
+	constexpr int32 ChangeStride = 8;
+
+	RunCompareBenchmark(*this, USceneComponent::StaticClass(), NumFrames, ChangeStride);
+	RunCompareBenchmark(*this, UTimelineComponent::StaticClass(), NumFrames, ChangeStride);
+	RunCompareBenchmark(*this, USplineComponent::StaticClass(), NumFrames, ChangeStride);
+
+	SetUseCompareBlocks(bOldUseCompareBlocks);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
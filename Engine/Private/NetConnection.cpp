@@ -109,6 +109,11 @@ static int32 GNetCloseTimingDebug = 0;
 static FAutoConsoleVariableRef CVarCloseTimingDebug(TEXT("net.CloseTimingDebug"), GNetCloseTimingDebug,
 	TEXT("Logs the last packet send/receive and TickFlush/TickDispatch times, on connection close - for debugging blocked send/recv paths."));
 
+static int32 GNetMergeBunchesInPlace = 0;
+
+static FAutoConsoleVariableRef CVarNetMergeBunchesInPlace(TEXT("net.MergeBunchesInPlace"), GNetMergeBunchesInPlace,
+	TEXT("When a bunch is merged into the last one sent on its channel, rewrite the header of the last bunch in the send buffer and only append the new bits, instead of popping it and writing the merged bunch again."));
+
 extern int32 GNetDormancyValidate;
 extern bool GbNetReuseReplicatorsForDormantObjects;
 
@@ -1838,6 +1843,8 @@ void UNetConnection::InitSendBuffer()
 	}
 
 	HeaderMarkForPacketInfo.Reset();
+	InPlaceMergeBits = INDEX_NONE;
+	InPlaceMergeChIndex = INDEX_NONE;
 
 	ResetPacketBitCounts();
 
@@ -2115,6 +2122,9 @@ void UNetConnection::FlushNet(bool bIgnoreSimulation)
 
 	check(Driver);
 
+	// A bunch left in the buffer by PopLastStartForMerge that wasn't sent again must not go out, as if it had been popped
+	CancelInPlaceMerge();
+
 	// Update info.
 	ValidateSendBuffer();
 	LastEnd = FBitWriterMark();
@@ -3899,6 +3909,9 @@ void UNetConnection::SetIgnoreReservedChannels(bool bInIgnoreReservedChannels)
 
 void UNetConnection::PrepareWriteBitsToSendBuffer(const int32 SizeInBits, const int32 ExtraSizeInBits)
 {
+	// Anything written after a bunch left in the buffer for merging would end up after it, so pop it first
+	CancelInPlaceMerge();
+
 	ValidateSendBuffer();
 
 #if !UE_BUILD_SHIPPING
@@ -4001,6 +4014,41 @@ int32 UNetConnection::WriteBitsToSendBufferInternal(
 	return RememberedPacketId;
 }
 
+int32 UNetConnection::WriteMergedBunchToSendBufferInternal(
+	const uint8 *	HeaderBits,
+	const int32		HeaderSizeInBits,
+	const uint8 *	BunchBits,
+	const int64		NumMergedBits,
+	const int32		BunchSizeInBits)
+{
+	// LastStart still marks the start of the bunch, so it stays valid for the next merge or pop.
+	// Only the header changed in the bits already written, the bunch size in it is patched along with the rest.
+	appBitsCpy(SendBuffer.GetData(), static_cast<int32>(LastStart.GetNumBits()), const_cast< uint8* >( HeaderBits ), 0, HeaderSizeInBits);
+
+	if ( BunchSizeInBits > NumMergedBits )
+	{
+		SendBuffer.SerializeBitsWithOffset( const_cast< uint8* >( BunchBits ), NumMergedBits, BunchSizeInBits - NumMergedBits );
+	}
+	ValidateSendBuffer();
+
+	const int32 RememberedPacketId = OutPacketId;
+
+	// PopLastStartForMerge removed the whole bunch from the count
+	NumBunchBits += HeaderSizeInBits + BunchSizeInBits;
+
+	// Flush now if we are full
+	if (GetFreeSendBufferBits() == 0
+#if !UE_BUILD_SHIPPING
+		|| CVarForceNetFlush.GetValueOnAnyThread() != 0
+#endif
+		)
+	{
+		FlushNet();
+	}
+
+	return RememberedPacketId;
+}
+
 int32 UNetConnection::WriteBitsToSendBuffer( 
 	const uint8 *	Bits, 
 	const int32		SizeInBits, 
@@ -4038,6 +4086,34 @@ void UNetConnection::PopLastStart()
 	NETWORK_PROFILER(GNetworkProfiler.PopSendBunch(this));
 }
 
+void UNetConnection::PopLastStartForMerge(int64 NumMergedBits)
+{
+	if (!GNetMergeBunchesInPlace)
+	{
+		PopLastStart();
+		return;
+	}
+
+	UE_NET_TRACE_POP_SEND_BUNCH(OutTraceCollector);
+
+	NumBunchBits -= SendBuffer.GetNumBits() - LastStart.GetNumBits();
+	InPlaceMergeBits = NumMergedBits;
+	InPlaceMergeChIndex = LastOut.ChIndex;
+	InPlaceMergeChSequence = LastOut.ChSequence;
+	InPlaceMergeBunchBits = LastOut.GetNumBits();
+	NETWORK_PROFILER(GNetworkProfiler.PopSendBunch(this));
+}
+
+void UNetConnection::CancelInPlaceMerge()
+{
+	if (InPlaceMergeBits != INDEX_NONE)
+	{
+		LastStart.Pop(SendBuffer);
+		InPlaceMergeBits = INDEX_NONE;
+		InPlaceMergeChIndex = INDEX_NONE;
+	}
+}
+
 TSharedPtr<FObjectReplicator> UNetConnection::CreateReplicatorForNewActorChannel(UObject* Object)
 {
 	TSharedPtr<FObjectReplicator> NewReplicator = MakeShareable(new FObjectReplicator());
@@ -4133,9 +4209,28 @@ int32 UNetConnection::SendRawBunch(FOutBunch& Bunch, bool InAllowMerge, const FN
 	const int32 BunchHeaderBits = SendBunchHeader.GetNumBits();
 	const int32 BunchBits = Bunch.GetNumBits();
 
-	// If the bunch does not fit in the current packet, 
-	// flush packet now so that we can report collected stats in the correct scope
-	PrepareWriteBitsToSendBuffer(BunchHeaderBits, BunchBits);
+	// The bunch can be merged in place if it's the one left in the buffer by PopLastStartForMerge, not a partial bunch split from it
+	// or a bunch of another channel, its header is the same size as the one already written and the new bits fit in the packet
+	bool bMergeInPlace = false;
+	const int64 NumMergedBits = InPlaceMergeBits;
+	if (NumMergedBits != INDEX_NONE && Bunch.ChIndex == InPlaceMergeChIndex && Bunch.ChSequence == InPlaceMergeChSequence && Bunch.GetNumBits() == InPlaceMergeBunchBits)
+	{
+		const int64 WrittenHeaderBits = SendBuffer.GetNumBits() - LastStart.GetNumBits() - NumMergedBits;
+		bMergeInPlace = WrittenHeaderBits == BunchHeaderBits && NumMergedBits <= BunchBits && BunchBits - NumMergedBits <= GetFreeSendBufferBits();
+	}
+
+	if (bMergeInPlace)
+	{
+		InPlaceMergeBits = INDEX_NONE;
+		InPlaceMergeChIndex = INDEX_NONE;
+	}
+	else
+	{
+		// Pops the bunch left in the buffer, if any, before writing this one
+		// If the bunch does not fit in the current packet, 
+		// flush packet now so that we can report collected stats in the correct scope
+		PrepareWriteBitsToSendBuffer(BunchHeaderBits, BunchBits);
+	}
 
 	// We want to mark the packet in which we write the data as TimeSensitive
 	// Note: we want to mark the packet as TimeSensitive here, as PrepareWriteBitsToSendBuffer might flush the packet
@@ -4145,7 +4240,14 @@ int32 UNetConnection::SendRawBunch(FOutBunch& Bunch, bool InAllowMerge, const FN
 	UE_NET_TRACE_END_BUNCH(OutTraceCollector, Bunch, Bunch.ChName, 0, BunchHeaderBits, BunchBits, BunchCollector);
 
 	// Write the bits to the buffer and remember the packet id used
-	Bunch.PacketId = WriteBitsToSendBufferInternal(SendBunchHeader.GetData(), BunchHeaderBits, Bunch.GetData(), BunchBits, EWriteBitsDataType::Bunch);
+	if (bMergeInPlace)
+	{
+		Bunch.PacketId = WriteMergedBunchToSendBufferInternal(SendBunchHeader.GetData(), BunchHeaderBits, Bunch.GetData(), NumMergedBits, BunchBits);
+	}
+	else
+	{
+		Bunch.PacketId = WriteBitsToSendBufferInternal(SendBunchHeader.GetData(), BunchHeaderBits, Bunch.GetData(), BunchBits, EWriteBitsDataType::Bunch);
+	}
 
 	// Track channels that wrote data to this packet.
 	FChannelRecordImpl::PushChannelRecord(ChannelRecord, Bunch.PacketId, Bunch.ChIndex);
@@ -5792,6 +5894,104 @@ FAutoConsoleCommandWithWorldAndArgs ForceOnePacketPerBunch(TEXT("net.ForceOnePac
 }));
 
 
+#if !UE_BUILD_SHIPPING
+static void	BenchmarkMergeBunchesInPlace(const TArray<FString>& Args, UWorld* World)
+{
+	int32 NumConnections = 64;
+	int32 NumFrames = 100;
+	int32 NumBunchesPerFrame = 32;
+	int32 NumBitsPerBunch = 64;
+	if (Args.Num() > 0)
+	{
+		LexFromString(NumConnections, *Args[0]);
+	}
+	if (Args.Num() > 1)
+	{
+		LexFromString(NumFrames, *Args[1]);
+	}
+	if (Args.Num() > 2)
+	{
+		LexFromString(NumBunchesPerFrame, *Args[2]);
+	}
+	if (Args.Num() > 3)
+	{
+		LexFromString(NumBitsPerBunch, *Args[3]);
+	}
+	NumConnections = FMath::Max(NumConnections, 1);
+	NumFrames = FMath::Max(NumFrames, 1);
+	NumBitsPerBunch = FMath::Max(NumBitsPerBunch, 1);
+
+	UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	if (!NetDriver || !NetDriver->IsServer())
+	{
+		UE_LOG(LogNet, Warning, TEXT("net.MergeBunchesInPlace.Benchmark must be run on a server"));
+		return;
+	}
+
+	// Small bunches on one channel per connection, merged until the packet is full as when a channel sends many small RPCs in a frame
+	TArray<UChannel*> Channels;
+	for (int32 Index = 0; Index < NumConnections; ++Index)
+	{
+		USimulatedClientNetConnection* Connection = NewObject<USimulatedClientNetConnection>();
+		Connection->InitConnection(NetDriver, USOCK_Open, World->URL, 1000000);
+		Connection->InitSendBuffer();
+		NetDriver->AddClientConnection(Connection);
+
+		if (UChannel* Channel = Connection->CreateChannelByName(NAME_Control, EChannelCreateFlags::OpenedLocally))
+		{
+			Channels.Add(Channel);
+		}
+	}
+
+	TArray<uint8> Payload;
+	Payload.SetNumUninitialized(FMath::DivideAndRoundUp(NumBitsPerBunch, 8));
+	for (int32 Index = 0; Index < Payload.Num(); ++Index)
+	{
+		Payload[Index] = static_cast<uint8>(Index * 151 + 7);
+	}
+
+	auto RunFrames = [&]()
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (UChannel* Channel : Channels)
+			{
+				for (int32 BunchIndex = 0; BunchIndex < NumBunchesPerFrame; ++BunchIndex)
+				{
+					FOutBunch Bunch(Channel, false);
+					Bunch.SerializeBits(Payload.GetData(), NumBitsPerBunch);
+					Channel->SendBunch(&Bunch, true);
+				}
+				Channel->Connection->FlushNet();
+			}
+		}
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumFrames;
+	};
+
+	const int32 PreviousMergeBunchesInPlace = GNetMergeBunchesInPlace;
+	GNetMergeBunchesInPlace = 0;
+	const double PopAndRewriteMs = RunFrames();
+	GNetMergeBunchesInPlace = 1;
+	const double InPlaceMs = RunFrames();
+	GNetMergeBunchesInPlace = PreviousMergeBunchesInPlace;
+
+	UE_LOG(LogNet, Display, TEXT("net.MergeBunchesInPlace.Benchmark: %d connections, %d bunches of %d bits per frame. Pop and rewrite: %.3f ms per frame, in place: %.3f ms per frame"),
+		Channels.Num(), NumBunchesPerFrame, NumBitsPerBunch, PopAndRewriteMs, InPlaceMs);
+
+	for (UChannel* Channel : Channels)
+	{
+		UNetConnection* Connection = Channel->Connection;
+		Connection->Close();
+		Connection->MarkAsGarbage();
+	}
+}
+
+FAutoConsoleCommandWithWorldAndArgs BenchmarkMergeBunchesInPlaceCmd(TEXT("net.MergeBunchesInPlace.Benchmark"),
+	TEXT("Measures building packets of small merged bunches on simulated connections, with and without net.MergeBunchesInPlace. Args: NumConnections NumFrames NumBunchesPerFrame NumBitsPerBunch"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(BenchmarkMergeBunchesInPlace));
+#endif
+
 // ----------------------------------------------------------------
 
 
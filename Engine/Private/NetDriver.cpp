@@ -51,6 +51,7 @@
 #include "Net/NetSubObjectRegistryGetter.h"
 #include "Net/NetworkGranularMemoryLogging.h"
 #include "UObject/Stack.h"
+#include "Async/ParallelFor.h"
 #if UE_WITH_IRIS
 #include "Iris/IrisConfig.h"
 #include "Iris/Core/IrisDebugging.h"
@@ -149,6 +150,7 @@ DEFINE_STAT(STAT_PacketReservedHandshake);
 DECLARE_CYCLE_STAT(TEXT("NetDriver AddClientConnection"), Stat_NetDriverAddClientConnection, STATGROUP_Net);
 DECLARE_CYCLE_STAT(TEXT("NetDriver ProcessRemoteFunction"), STAT_NetProcessRemoteFunc, STATGROUP_Net);
 DECLARE_CYCLE_STAT(TEXT("Process Prioritized Actors Time"), STAT_NetProcessPrioritizedActorsTime, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Parallel Prioritize Actors Time"), STAT_NetParallelPrioritizeActorsTime, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("NetDriver TickFlush"), STAT_NetTickFlush, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("NetDriver TickFlush GatherStats"), STAT_NetTickFlushGatherStats, STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("NetDriver TickFlush GatherStatsPerfCounters"), STAT_NetTickFlushGatherStatsPerfCounters, STATGROUP_Game);
@@ -389,6 +391,29 @@ static TAutoConsoleVariable<float> CVarNetDebugDrawCullDistance(
 	TEXT("Max world units an actor can be away from the local view to draw its dormancy status. Zero disables culling"),
 	ECVF_Default);
 
+static int32 GNetParallelPrioritizeActors = 0;
+static FAutoConsoleVariableRef CVarNetParallelPrioritizeActors(
+	TEXT("net.ParallelPrioritizeActors"),
+	GNetParallelPrioritizeActors,
+	TEXT("If enabled, ServerReplicateActors computes relevancy and priority lists for all ticked connections in parallel before replicating to them.\n")
+	TEXT("Channel creation and sending remain serialized on the game thread. Requires IsNetRelevantFor, GetNetPriority and GetNetDormancy overrides to be thread safe."),
+	ECVF_Default);
+
+static int32 GNetParallelPrioritizeActorsMinConnections = 4;
+static FAutoConsoleVariableRef CVarNetParallelPrioritizeActorsMinConnections(
+	TEXT("net.ParallelPrioritizeActorsMinConnections"),
+	GNetParallelPrioritizeActorsMinConnections,
+	TEXT("Minimum number of connections ticked in a frame before net.ParallelPrioritizeActors goes wide."),
+	ECVF_Default);
+
+static int32 GNetTimeBucketedConsiderList = 0;
+static FAutoConsoleVariableRef CVarNetTimeBucketedConsiderList(
+	TEXT("net.TimeBucketedConsiderList"),
+	GNetTimeBucketedConsiderList,
+	TEXT("If enabled, the network object list keeps active objects in buckets by NextUpdateTime so building the consider list only visits the objects due for an update,\n")
+	TEXT("instead of every active object each frame."),
+	ECVF_Default);
+
 static TAutoConsoleVariable<int32> CVarUseAdaptiveNetUpdateFrequency(
 	TEXT( "net.UseAdaptiveNetUpdateFrequency" ), 
 	0, 
@@ -901,6 +926,8 @@ void UNetDriver::CancelAdaptiveReplication(FNetworkObjectInfo& InNetworkActor)
 				InNetworkActor.NextUpdateTime = FMath::Min(InNetworkActor.NextUpdateTime, (double)NewUpdateTime);
 				InNetworkActor.OptimalNetUpdateDelta = ExpectedNetDelay;
 				// TODO: we really need a way to cancel the throttling completely. OptimalNetUpdateDelta is going to be recalculated based on LastNetReplicateTime.
+
+				GetNetworkObjectList().ScheduleUpdate(Actor);
 			}
 		}
 	}
@@ -4198,6 +4225,7 @@ void UNetDriver::ForceNetUpdate(AActor* Actor)
 	if (FNetworkObjectInfo* NetActor = FindNetworkObjectInfo(Actor))
 	{
 		NetActor->NextUpdateTime = World ? (World->TimeSeconds - 0.01f) : 0.0;
+		GetNetworkObjectList().ScheduleUpdate(Actor);
 	}
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 }
@@ -4217,6 +4245,7 @@ void UNetDriver::ForceAllActorsNetUpdateTime(float NetUpdateTimeOffset, TFunctio
 					// Only allow the next update to be sooner than the current one
 					const double NewUpdateTime = World->TimeSeconds + NetUpdateTimeOffset * FMath::FRand();
 					NetActorInfo->NextUpdateTime = FMath::Min(NetActorInfo->NextUpdateTime, NewUpdateTime);
+					GetNetworkObjectList().ScheduleUpdate(*It);
 				}
 			}
 		}
@@ -4904,13 +4933,13 @@ void UNetDriver::ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectI
 
 	TArray<AActor*> ActorsToRemove;
 
-	for ( const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : GetNetworkObjectList().GetActiveObjects() )
+	auto ConsiderObject = [&]( const TSharedPtr<FNetworkObjectInfo>& ObjectInfo )
 	{
 		FNetworkObjectInfo* ActorInfo = ObjectInfo.Get();
 
 		if ( !ActorInfo->bPendingNetUpdate && World->TimeSeconds <= ActorInfo->NextUpdateTime )
 		{
-			continue;		// It's not time for this actor to perform an update, skip it
+			return;		// It's not time for this actor to perform an update, skip it
 		}
 
 		AActor* Actor = ActorInfo->Actor;
@@ -4922,13 +4951,13 @@ void UNetDriver::ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectI
 			// If this is happening, it means code is not destructing Actors properly, and that's not OK.
 			UE_LOG( LogNet, Warning, TEXT( "Actor %s was found in the NetworkObjectList, but is PendingKillPending" ), *Actor->GetName() );
 			ActorsToRemove.Add( Actor );
-			continue;
+			return;
 		}
 
 		if ( Actor->GetRemoteRole() == ROLE_None )
 		{
 			ActorsToRemove.Add( Actor );
-			continue;
+			return;
 		}
 
 		// This actor may belong to a different net driver, make sure this is the correct one
@@ -4938,20 +4967,20 @@ void UNetDriver::ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectI
 			UE_LOG(LogNetTraffic, Error, TEXT("Actor %s in wrong network actors list! (Has net driver '%s', expected '%s')"),
 					*Actor->GetName(), *Actor->GetNetDriverName().ToString(), *NetDriverName.ToString());
 
-			continue;
+			return;
 		}
 
 		// Verify the actor is actually initialized (it might have been intentionally spawn deferred until a later frame)
 		if ( !Actor->IsActorInitialized() )
 		{
-			continue;
+			return;
 		}
 
 		// Don't send actors that may still be streaming in or out
 		ULevel* Level = Actor->GetLevel();
 		if ( Level->HasVisibilityChangeRequestPending() || Level->bIsAssociatingLevel )
 		{
-			continue;
+			return;
 		}
 
 		if ( IsDormInitialStartupActor(Actor) )
@@ -4962,7 +4991,7 @@ void UNetDriver::ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectI
 			NumInitiallyDormant++;
 			ActorsToRemove.Add( Actor );
 			//UE_LOG(LogNetTraffic, Log, TEXT("Skipping Actor %s - its initially dormant!"), *Actor->GetName() );
-			continue;
+			return;
 		}
 
 		checkSlow( Actor->NeedsLoadForClient() ); // We have no business sending this unless the client can load
@@ -5024,6 +5053,28 @@ void UNetDriver::ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectI
 
 		// Call PreReplication on all actors that will be considered
 		Actor->CallPreReplication( this );
+	};
+
+	FNetworkObjectList& NetworkObjectList = GetNetworkObjectList();
+	NetworkObjectList.SetUpdateScheduleEnabled( GNetTimeBucketedConsiderList != 0 );
+
+	if ( NetworkObjectList.IsUpdateScheduleEnabled() )
+	{
+		// Only visit the objects whose NextUpdateTime has passed, or that are pending a net update
+		TArray<TSharedPtr<FNetworkObjectInfo>> DueObjects;
+		NetworkObjectList.GatherDueActiveObjects( World->TimeSeconds, DueObjects );
+
+		for ( const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : DueObjects )
+		{
+			ConsiderObject( ObjectInfo );
+		}
+	}
+	else
+	{
+		for ( const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : NetworkObjectList.GetActiveObjects() )
+		{
+			ConsiderObject( ObjectInfo );
+		}
 	}
 
 	for ( AActor* Actor : ActorsToRemove )
@@ -5252,6 +5303,142 @@ int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connec
 	return FinalSortedCount;
 }
 
+/** Per connection output of the parallel prioritization pass. Filled on a worker thread and consumed on the game thread. */
+struct FPrioritizedConnectionActors
+{
+	TArray<FNetViewer> ConnectionViewers;
+	TArray<FActorPriority> PriorityList;
+	TArray<FActorPriority*> PriorityActors;
+
+	/** Channels that are no longer relevant to their owner and must be closed before replicating */
+	TArray<UActorChannel*> ChannelsToClose;
+
+	/** Channels that want to go dormant once all their properties have been replicated */
+	TArray<UActorChannel*> ChannelsToStartDormancy;
+
+	int32 DeletedCount = 0;
+	bool bPrioritized = false;
+};
+
+// Fills OutViewers with the viewers a connection should consider (this connection and children of this connection)
+static void GatherConnectionViewers( UNetConnection* Connection, const float DeltaSeconds, TArray<FNetViewer>& OutViewers )
+{
+	OutViewers.Reset();
+	new( OutViewers )FNetViewer( Connection, DeltaSeconds );
+	for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
+	{
+		if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
+		{
+			new( OutViewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
+		}
+	}
+}
+
+void UNetDriver::ServerReplicateActors_PrioritizeActorsForConnection( UNetConnection* Connection, const TArray<FNetworkObjectInfo*>& ConsiderList, FPrioritizedConnectionActors& OutPrioritized ) const
+{
+	SCOPE_CYCLE_COUNTER( STAT_NetPrioritizeActorsTime );
+
+	// This mirrors ServerReplicateActors_PrioritizeActors, but may run concurrently for several connections.
+	// It only reads shared state: NetTag is not used (SentTemporaries are tested directly), and channel
+	// closing / dormancy changes are recorded in OutPrioritized and applied later on the game thread.
+
+	const TArray<FNetViewer>& ConnectionViewers = OutPrioritized.ConnectionViewers;
+
+	// Make weak ptr once for IsActorDormant call
+	TWeakObjectPtr<UNetConnection> WeakConnection(Connection);
+
+	const int32 MaxSortedActors = ConsiderList.Num() + Connection->GetDestroyedStartupOrDormantActorGUIDs().Num();
+
+	// PriorityActors points into PriorityList, so it must never reallocate
+	OutPrioritized.PriorityList.Reset( MaxSortedActors );
+	OutPrioritized.PriorityActors.Reset( MaxSortedActors );
+	OutPrioritized.ChannelsToClose.Reset();
+	OutPrioritized.ChannelsToStartDormancy.Reset();
+	OutPrioritized.DeletedCount = 0;
+
+	AGameNetworkManager* const NetworkManager = World->NetworkManager;
+	const bool bLowNetBandwidth = NetworkManager ? NetworkManager->IsInLowBandwidthMode() : false;
+
+	for ( FNetworkObjectInfo* ActorInfo : ConsiderList )
+	{
+		AActor* Actor = ActorInfo->Actor;
+
+		UActorChannel* Channel = Connection->FindActorChannelRef( ActorInfo->WeakActor );
+
+		// Skip actor if not relevant and theres no channel already.
+		if ( !Channel )
+		{
+			if ( !IsLevelInitializedForActor( Actor, Connection ) )
+			{
+				continue;
+			}
+
+			if ( !IsActorRelevantToConnection( Actor, ConnectionViewers ) )
+			{
+				continue;
+			}
+		}
+
+		UNetConnection* PriorityConnection = Connection;
+
+		if ( Actor->bOnlyRelevantToOwner )
+		{
+			bool bHasNullViewTarget = false;
+
+			PriorityConnection = IsActorOwnedByAndRelevantToConnection( Actor, ConnectionViewers, bHasNullViewTarget );
+
+			if ( PriorityConnection == nullptr )
+			{
+				if ( !bHasNullViewTarget && Channel != NULL && ElapsedTime - Channel->RelevantTime >= RelevantTimeout )
+				{
+					OutPrioritized.ChannelsToClose.Add( Channel );
+				}
+
+				continue;
+			}
+		}
+		else if ( GSetNetDormancyEnabled != 0 )
+		{
+			if ( IsActorDormant( ActorInfo, WeakConnection ) )
+			{
+				continue;
+			}
+
+			if ( ShouldActorGoDormant( Actor, ConnectionViewers, Channel, ElapsedTime, bLowNetBandwidth ) )
+			{
+				CA_ASSUME(Channel);
+				OutPrioritized.ChannelsToStartDormancy.Add( Channel );
+			}
+		}
+
+		// Skip temporary actors that were already sent to this connection
+		if ( Connection->SentTemporaries.Num() > 0 && Connection->SentTemporaries.Contains( Actor ) )
+		{
+			continue;
+		}
+
+		OutPrioritized.PriorityList.Emplace( PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth );
+	}
+
+	// Add in deleted actors
+	for ( auto It = Connection->GetDestroyedStartupOrDormantActorGUIDs().CreateConstIterator(); It; ++It )
+	{
+		FActorDestructionInfo& DInfo = *DestroyedStartupOrDormantActors.FindChecked( *It );
+		OutPrioritized.PriorityList.Emplace( Connection, &DInfo, ConnectionViewers );
+		OutPrioritized.DeletedCount++;
+	}
+
+	for ( FActorPriority& ActorPriority : OutPrioritized.PriorityList )
+	{
+		OutPrioritized.PriorityActors.Add( &ActorPriority );
+	}
+
+	// Sort by priority
+	Algo::SortBy( OutPrioritized.PriorityActors, &FActorPriority::Priority, TGreater<>() );
+
+	OutPrioritized.bPrioritized = true;
+}
+
 int32 UNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated )
 {
 	TInterval<int32> ActorsIndexRange(0, FinalSortedCount);
@@ -5821,6 +6008,43 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 		OnPreConsiderListUpdateOverride.Execute({ DeltaSeconds, nullptr, bCPUSaturated }, Updated, ConsiderList);
 	}
 
+	// Optionally compute the relevancy and priority lists of every ticked connection up front on worker threads.
+	// Channel creation and sending still happen serially in the loop below.
+	TArray<FPrioritizedConnectionActors> ParallelPrioritizedConnections;
+
+	bool bParallelPrioritize = GNetParallelPrioritizeActors != 0 && !OnProcessConsiderListOverride.IsBound() && NumClientsToTick >= GNetParallelPrioritizeActorsMinConnections;
+#if NET_DEBUG_RELEVANT_ACTORS
+	bParallelPrioritize = bParallelPrioritize && !DebugRelevantActors;
+#endif
+
+	if (bParallelPrioritize)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_NetParallelPrioritizeActorsTime);
+
+		ParallelPrioritizedConnections.SetNum(NumClientsToTick);
+
+		// Viewers are gathered on the game thread, since GetPlayerViewPoint is not safe to call from workers
+		for (int32 i = 0; i < NumClientsToTick; i++)
+		{
+			UNetConnection* Connection = ClientConnections[i];
+			if (Connection->ViewTarget)
+			{
+				check(World == Connection->OwningActor->GetWorld());
+				check(World == Connection->ViewTarget->GetWorld());
+				GatherConnectionViewers(Connection, DeltaSeconds, ParallelPrioritizedConnections[i].ConnectionViewers);
+			}
+		}
+
+		ParallelFor(NumClientsToTick, [this, &ConsiderList, &ParallelPrioritizedConnections](int32 Index)
+		{
+			FPrioritizedConnectionActors& Prioritized = ParallelPrioritizedConnections[Index];
+			if (Prioritized.ConnectionViewers.Num() > 0)
+			{
+				ServerReplicateActors_PrioritizeActorsForConnection(ClientConnections[Index], ConsiderList, Prioritized);
+			}
+		});
+	}
+
 	for ( int32 i=0; i < ClientConnections.Num(); i++ )
 	{
 		UNetConnection* Connection = ClientConnections[i];
@@ -5874,17 +6098,19 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 			const int32 LocalNumSaturated = GNumSaturatedConnections;
 
+			FPrioritizedConnectionActors* ParallelPrioritized = ParallelPrioritizedConnections.IsValidIndex(i) && ParallelPrioritizedConnections[i].bPrioritized ? &ParallelPrioritizedConnections[i] : nullptr;
+
 			// Make a list of viewers this connection should consider (this connection and children of this connection)
 			TArray<FNetViewer>& ConnectionViewers = WorldSettings->ReplicationViewers;
 
-			ConnectionViewers.Reset();
-			new( ConnectionViewers )FNetViewer( Connection, DeltaSeconds );
-			for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
+			if (ParallelPrioritized)
 			{
-				if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
-				{
-					new( ConnectionViewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
-				}
+				// Reuse the viewers the priority list was built against
+				ConnectionViewers = ParallelPrioritized->ConnectionViewers;
+			}
+			else
+			{
+				GatherConnectionViewers(Connection, DeltaSeconds, ConnectionViewers);
 			}
 
 			// send ClientAdjustment if necessary
@@ -5911,7 +6137,31 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 				OnProcessConsiderListOverride.Execute( { DeltaSeconds, Connection, bCPUSaturated }, Updated, ConsiderList );
 			}
 
-			if (!bProcessConsiderListIsBound)
+			if (ParallelPrioritized)
+			{
+				// Apply the channel changes the worker deferred, then replicate serially as usual
+				for (UActorChannel* Channel : ParallelPrioritized->ChannelsToClose)
+				{
+					Channel->Close(EChannelCloseReason::Relevancy);
+				}
+
+				for (UActorChannel* Channel : ParallelPrioritized->ChannelsToStartDormancy)
+				{
+					Channel->StartBecomingDormant();
+				}
+
+				const int32 FinalSortedCount = ParallelPrioritized->PriorityActors.Num();
+				FActorPriority** PriorityActors = ParallelPrioritized->PriorityActors.GetData();
+
+				GetMetrics()->SetInt(UE::Net::Metric::PrioritizedActors, FinalSortedCount);
+				GetMetrics()->SetInt(UE::Net::Metric::NumRelevantDeletedActors, ParallelPrioritized->DeletedCount);
+
+				TInterval<int32> ActorsIndexRange(0, FinalSortedCount);
+				const int32 LastProcessedActor = ServerReplicateActors_ProcessPrioritizedActorsRange(Connection, ConnectionViewers, PriorityActors, ActorsIndexRange, Updated);
+
+				ServerReplicateActors_MarkRelevantActors(Connection, ConnectionViewers, LastProcessedActor, FinalSortedCount, PriorityActors);
+			}
+			else if (!bProcessConsiderListIsBound)
 			{
 				FActorPriority* PriorityList = NULL;
 				FActorPriority** PriorityActors = NULL;
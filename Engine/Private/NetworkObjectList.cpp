@@ -16,6 +16,17 @@ namespace UE::Net::Private
 		TEXT("When true, network object list will maintain a set of dormant actors per connnection per level."),
 		ECVF_Default);
 
+	/** Number of buckets of the update schedule timer wheel, must be a power of two */
+	static constexpr int32 NumUpdateScheduleBuckets = 256;
+
+	/** Time covered by each bucket of the update schedule, objects scheduled further than NumUpdateScheduleBuckets ticks ahead wrap around */
+	static constexpr double UpdateScheduleTickDuration = 1.0 / 60.0;
+
+	static int64 GetUpdateScheduleTick(double Time)
+	{
+		return static_cast<int64>(FMath::FloorToDouble(Time / UpdateScheduleTickDuration));
+	}
+
 	static const TCHAR* LexToString(ENetSubObjectStatus SubObjectStatus)
 	{
 		switch (SubObjectStatus)
@@ -104,6 +115,11 @@ TSharedPtr<FNetworkObjectInfo>* FNetworkObjectList::FindOrAdd(AActor* const Acto
 			NetworkObjectInfo = &AllNetworkObjects[AllNetworkObjects.Emplace(new FNetworkObjectInfo(Actor))];
 			ActiveNetworkObjects.Add(*NetworkObjectInfo);
 
+			if (bUpdateScheduleEnabled)
+			{
+				ObjectsToSchedule.Add(*NetworkObjectInfo);
+			}
+
 			UE_LOG(LogNetDormancy, VeryVerbose, TEXT("FNetworkObjectList::Add: Adding actor. Actor: %s, Total: %i, Active: %i, NetDriverName: %s"), *Actor->GetName(), AllNetworkObjects.Num(), ActiveNetworkObjects.Num(), *NetDriver->NetDriverName.ToString());
 
 			if (OutWasAdded)
@@ -313,6 +329,11 @@ bool FNetworkObjectList::MarkActiveInternal(const TSharedPtr<FNetworkObjectInfo>
 		// Put this object back on the active list
 		ActiveNetworkObjects.Add(ObjectInfo);
 
+		if (bUpdateScheduleEnabled)
+		{
+			ObjectsToSchedule.Add(ObjectInfo);
+		}
+
 		UE_LOG(LogNetDormancy, Log, TEXT("FNetworkObjectList::MarkDormant: Actor is no longer dormant on all connections. Actor: %s. Total: %i, Active: %i, Connection: %s"), *Actor->GetName(), AllNetworkObjects.Num(), ActiveNetworkObjects.Num(), *Connection->GetName());
 
 		if (UE::Net::Private::bTrackDormantObjectsByLevel)
@@ -457,6 +478,11 @@ void FNetworkObjectList::OnPostSeamlessTravel()
 		// Add the saved object info back into the active list
 		AllNetworkObjects.Add(SeamlessTravelingActorInfo);
 		ActiveNetworkObjects.Add(SeamlessTravelingActorInfo);
+
+		if (bUpdateScheduleEnabled)
+		{
+			ObjectsToSchedule.Add(SeamlessTravelingActorInfo);
+		}
 	}
 
 	SeamlessTravelingObjects.Empty();
@@ -469,6 +495,11 @@ void FNetworkObjectList::HandleConnectionAdded()
 	for (auto It = ObjectsDormantOnAllConnections.CreateIterator(); It; ++It)
 	{
 		ActiveNetworkObjects.Add(*It);
+
+		if (bUpdateScheduleEnabled)
+		{
+			ObjectsToSchedule.Add(*It);
+		}
 	}
 
 	ObjectsDormantOnAllConnections.Empty();
@@ -482,6 +513,7 @@ void FNetworkObjectList::ResetDormancyState()
 	FullyDormantObjectsByLevel.Empty();
 
 	ActiveNetworkObjects = AllNetworkObjects;
+	bRebuildUpdateSchedule = bUpdateScheduleEnabled;
 
 	for (auto It = AllNetworkObjects.CreateIterator(); It; ++It)
 	{
@@ -525,6 +557,153 @@ void FNetworkObjectList::Reset()
 	NumDormantObjectsPerConnection.Empty();
 	FullyDormantObjectsByLevel.Empty();
 	DormantObjectsPerConnection.Empty();
+
+	UpdateScheduleBuckets.Empty();
+	ObjectsToSchedule.Empty();
+	bRebuildUpdateSchedule = bUpdateScheduleEnabled;
+}
+
+void FNetworkObjectList::SetUpdateScheduleEnabled(bool bEnabled)
+{
+	if (bEnabled == bUpdateScheduleEnabled)
+	{
+		return;
+	}
+
+	bUpdateScheduleEnabled = bEnabled;
+	UpdateScheduleBuckets.Empty();
+	ObjectsToSchedule.Empty();
+	bRebuildUpdateSchedule = bEnabled;
+}
+
+bool FNetworkObjectList::IsActiveObject(const TSharedPtr<FNetworkObjectInfo>& ObjectInfo) const
+{
+	const TSharedPtr<FNetworkObjectInfo>* ActiveObjectInfo = ActiveNetworkObjects.Find(ObjectInfo->Actor);
+	return ActiveObjectInfo && *ActiveObjectInfo == ObjectInfo;
+}
+
+void FNetworkObjectList::AddToUpdateSchedule(const TSharedPtr<FNetworkObjectInfo>& ObjectInfo)
+{
+	using namespace UE::Net::Private;
+
+	FNetworkObjectInfo* NetworkObjectInfo = ObjectInfo.Get();
+
+	// Objects pending a net update are due regardless of their NextUpdateTime
+	const int64 Tick = NetworkObjectInfo->bPendingNetUpdate ? NextUpdateScheduleTick : FMath::Max(NextUpdateScheduleTick, GetUpdateScheduleTick(NetworkObjectInfo->NextUpdateTime));
+
+	// Zero is never used so a default constructed entry is always stale
+	if (++LastUpdateScheduleSerial == 0)
+	{
+		++LastUpdateScheduleSerial;
+	}
+
+	NetworkObjectInfo->UpdateScheduleSerial = LastUpdateScheduleSerial;
+	UpdateScheduleBuckets[Tick & (NumUpdateScheduleBuckets - 1)].Add({ ObjectInfo, LastUpdateScheduleSerial });
+}
+
+void FNetworkObjectList::ScheduleUpdate(AActor* const Actor)
+{
+	if (bUpdateScheduleEnabled)
+	{
+		if (TSharedPtr<FNetworkObjectInfo>* InfoPtr = ActiveNetworkObjects.Find(Actor))
+		{
+			ObjectsToSchedule.Add(*InfoPtr);
+		}
+	}
+}
+
+void FNetworkObjectList::ScheduleUpdate(const TSharedPtr<FNetworkObjectInfo>& ObjectInfo)
+{
+	if (bUpdateScheduleEnabled && ObjectInfo.IsValid())
+	{
+		ObjectsToSchedule.Add(ObjectInfo);
+	}
+}
+
+void FNetworkObjectList::GatherDueActiveObjects(double CurrentTime, TArray<TSharedPtr<FNetworkObjectInfo>>& OutDueObjects)
+{
+	using namespace UE::Net::Private;
+
+	if (!ensure(bUpdateScheduleEnabled))
+	{
+		return;
+	}
+
+	const int64 CurrentTick = GetUpdateScheduleTick(CurrentTime);
+
+	if (bRebuildUpdateSchedule)
+	{
+		bRebuildUpdateSchedule = false;
+
+		UpdateScheduleBuckets.Reset();
+		UpdateScheduleBuckets.SetNum(NumUpdateScheduleBuckets);
+		ObjectsToSchedule.Reset();
+		NextUpdateScheduleTick = CurrentTick;
+
+		for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : ActiveNetworkObjects)
+		{
+			AddToUpdateSchedule(ObjectInfo);
+		}
+	}
+
+	// Objects returned by the previous call may have been given a new NextUpdateTime or flagged bPendingNetUpdate since, so they are scheduled only now
+	for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : ObjectsToSchedule)
+	{
+		if (IsActiveObject(ObjectInfo))
+		{
+			AddToUpdateSchedule(ObjectInfo);
+		}
+	}
+	ObjectsToSchedule.Reset();
+
+	// If more ticks went by than there are buckets, visiting the last NumUpdateScheduleBuckets ticks covers every bucket once
+	const int64 FirstTick = FMath::Max(NextUpdateScheduleTick, CurrentTick - NumUpdateScheduleBuckets + 1);
+
+	for (int64 Tick = FirstTick; Tick <= CurrentTick; ++Tick)
+	{
+		const int32 BucketIndex = static_cast<int32>(Tick & (NumUpdateScheduleBuckets - 1));
+		TArray<FScheduledUpdate>& Bucket = UpdateScheduleBuckets[BucketIndex];
+
+		int32 NumKept = 0;
+		for (int32 Index = 0; Index < Bucket.Num(); ++Index)
+		{
+			FScheduledUpdate& ScheduledUpdate = Bucket[Index];
+			FNetworkObjectInfo* NetworkObjectInfo = ScheduledUpdate.ObjectInfo.Get();
+
+			// Stale entries are left behind when an object is scheduled again, or becomes dormant or removed
+			if (NetworkObjectInfo->UpdateScheduleSerial != ScheduledUpdate.Serial || !IsActiveObject(ScheduledUpdate.ObjectInfo))
+			{
+				continue;
+			}
+
+			if (NetworkObjectInfo->bPendingNetUpdate || NetworkObjectInfo->NextUpdateTime < CurrentTime)
+			{
+				OutDueObjects.Add(ScheduledUpdate.ObjectInfo);
+				ObjectsToSchedule.Add(MoveTemp(ScheduledUpdate.ObjectInfo));
+				continue;
+			}
+
+			// Objects due on a later lap of the wheel, or later during the current tick, stay where they are. Others had their NextUpdateTime pushed back.
+			const int64 UpdateTick = GetUpdateScheduleTick(NetworkObjectInfo->NextUpdateTime);
+			if (UpdateTick >= CurrentTick && (UpdateTick & (NumUpdateScheduleBuckets - 1)) == BucketIndex)
+			{
+				if (NumKept != Index)
+				{
+					Bucket[NumKept] = MoveTemp(ScheduledUpdate);
+				}
+				++NumKept;
+			}
+			else
+			{
+				ObjectsToSchedule.Add(MoveTemp(ScheduledUpdate.ObjectInfo));
+			}
+		}
+
+		Bucket.SetNum(NumKept, EAllowShrinking::No);
+	}
+
+	// The current tick isn't over, its bucket is visited again on the next call
+	NextUpdateScheduleTick = CurrentTick;
 }
 
 void FNetworkObjectInfo::CountBytes(FArchive& Ar) const
@@ -543,6 +722,15 @@ void FNetworkObjectList::CountBytes(FArchive& Ar) const
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("ObjectsDormantOnAllConnections", ObjectsDormantOnAllConnections.CountBytes(Ar));
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("NumDormantObjectsPerConnection", NumDormantObjectsPerConnection.CountBytes(Ar));
 
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("UpdateSchedule",
+		UpdateScheduleBuckets.CountBytes(Ar);
+		for (const TArray<FScheduledUpdate>& Bucket : UpdateScheduleBuckets)
+		{
+			Bucket.CountBytes(Ar);
+		}
+		ObjectsToSchedule.CountBytes(Ar);
+	);
+
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("FullyDormantObjectsByLevel",
 		FullyDormantObjectsByLevel.CountBytes(Ar);
 		for (const TPair<FName, FNetworkObjectSet>& LevelPair : FullyDormantObjectsByLevel)
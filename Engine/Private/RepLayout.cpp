@@ -78,6 +78,14 @@ int32 GShareInitialCompareState = 0;
 static FAutoConsoleVariableRef CVarShareInitialCompareState(TEXT("net.ShareInitialCompareState"), GShareInitialCompareState,
 	TEXT("If true and net.ShareShadowState is enabled, attempt to also share initial replication compares across connections."));
 
+bool GbUseRepCompareBlocks = true;
+static FAutoConsoleVariableRef CVarUseRepCompareBlocks(TEXT("net.UseRepCompareBlocks"), GbUseRepCompareBlocks,
+	TEXT("If true, CompareProperties uses the compare plan of each FRepLayout to skip runs of unchanged POD properties with a single memory compare, only comparing property by property inside runs that differ."));
+
+int32 GRepCompareBlockMaxBytes = 64;
+static FAutoConsoleVariableRef CVarRepCompareBlockMaxBytes(TEXT("net.RepCompareBlockMaxBytes"), GRepCompareBlockMaxBytes,
+	TEXT("Maximum size in bytes of a single compare plan run. Smaller runs narrow the per property fallback when a run has changed. Only affects layouts created afterwards, 0 disables compare plans."));
+
 bool GbTrackNetSerializeObjectReferences = false;
 static FAutoConsoleVariableRef CVarTrackNetSerializeObjectReferences(TEXT("net.TrackNetSerializeObjectReferences"), GbTrackNetSerializeObjectReferences, TEXT("If true, we will create small layouts for Net Serialize Structs if they have Object Properties. This can prevent some Shadow State GC crashes."));
 
@@ -1315,6 +1323,7 @@ struct FComparePropertiesSharedParams
 	const bool bChangedNetOwner = false;
 	const bool bForceCustomPropsActive = false;
 	const bool bForceCompareProperties = false;
+	const TArray<FRepLayoutCompareBlock>* const CompareBlocks = nullptr;
 #if (WITH_PUSH_VALIDATION_SUPPORT || USE_NETWORK_PROFILER)
 	TBitArray<> PropertiesCompared;
 	TBitArray<> PropertiesChanged;
@@ -1628,6 +1637,24 @@ static uint16 CompareProperties_r(
 
 		UE_LOG(LogRepCompares, VeryVerbose, TEXT("CompareProperties_r: CmdIndex: %d CmdType: %s Property: %s"), CmdIndex, LexToString(Cmd.Type), *GetNameSafe(Cmd.Property));
 
+		if (SharedParams.CompareBlocks && !SharedParams.bForceFail)
+		{
+			// If this command starts a run of POD commands and none of its bytes changed, skip the whole run.
+			// Otherwise fall through and compare the commands one at a time.
+			const FRepLayoutCompareBlock& Block = (*SharedParams.CompareBlocks)[CmdIndex];
+			if (Block.NumCmds > 1)
+			{
+				checkSlow(CmdIndex + Block.NumCmds <= CmdEnd);
+
+				if (FMemory::Memcmp(ShadowData.Data, Data.Data, Block.NumBytes) == 0)
+				{
+					Handle = static_cast<uint16>(Handle + Block.NumCmds - 1);
+					CmdIndex += Block.NumCmds - 1;		// The -1 to handle the ++ in the for loop
+					continue;
+				}
+			}
+		}
+
 		if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
 		{
 			FComparePropertiesStackParams NewStackParams{
@@ -1788,7 +1815,8 @@ ERepLayoutResult FRepLayout::CompareProperties(
 		.bIsNetworkProfilerActive = UE_RepLayout_Private::IsNetworkProfilerComparisonTrackingEnabled(),
 		.bChangedNetOwner = RepState && RepState->RepFlags.bNetOwner != RepFlags.bNetOwner,
 		.bForceCustomPropsActive = !!RepFlags.bClientReplay,
-		.bForceCompareProperties = bForceCompare
+		.bForceCompareProperties = bForceCompare,
+		.CompareBlocks = (GbUseRepCompareBlocks && CompareBlocks.Num() > 0) ? &CompareBlocks : nullptr
 	};
 
 	FComparePropertiesStackParams StackParams
@@ -6384,6 +6412,7 @@ void FRepLayout::InitFromClass(
 	}
 
 	BuildShadowOffsets<ERepBuildType::Class>(InObjectClass, Parents, Cmds, ShadowDataBufferSize);
+	BuildCompareBlocks();
 
 	Owner = InObjectClass;
 }
@@ -7101,6 +7130,98 @@ void FRepLayout::BuildHandleToCmdIndexTable_r(
 	}
 }
 
+// Whether identical bytes always mean identical values for this command, and the command owns all of its bytes
+// (bitfield bools share their byte with other properties, and object / string types hold indirections).
+static bool CanCompareCmdAsMemory(const FRepLayoutCmd& Cmd)
+{
+	switch (Cmd.Type)
+	{
+		case ERepLayoutCmdType::PropertyNativeBool:
+		case ERepLayoutCmdType::PropertyByte:
+		case ERepLayoutCmdType::PropertyFloat:
+		case ERepLayoutCmdType::PropertyInt:
+		case ERepLayoutCmdType::PropertyName:
+		case ERepLayoutCmdType::PropertyUInt32:
+		case ERepLayoutCmdType::PropertyUInt64:
+		case ERepLayoutCmdType::PropertyVector:
+		case ERepLayoutCmdType::PropertyVector100:
+		case ERepLayoutCmdType::PropertyVectorQ:
+		case ERepLayoutCmdType::PropertyVectorNormal:
+		case ERepLayoutCmdType::PropertyVector10:
+		case ERepLayoutCmdType::PropertyPlane:
+		case ERepLayoutCmdType::PropertyRotator:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+void FRepLayout::BuildCompareBlocks()
+{
+	CompareBlocks.Reset();
+
+	const int32 MaxBlockBytes = FMath::Min(GRepCompareBlockMaxBytes, (int32)MAX_uint16);
+	if (MaxBlockBytes <= 0)
+	{
+		return;
+	}
+
+	TArray<FRepLayoutCompareBlock> NewCompareBlocks;
+	NewCompareBlocks.SetNum(Cmds.Num());
+
+	bool bHasBlocks = false;
+
+	for (int32 CmdIndex = 0; CmdIndex < Cmds.Num();)
+	{
+		const FRepLayoutCmd& FirstCmd = Cmds[CmdIndex];
+		if (!CanCompareCmdAsMemory(FirstCmd))
+		{
+			++CmdIndex;
+			continue;
+		}
+
+		int32 NumBytes = FirstCmd.ElementSize;
+		int32 EndIndex = CmdIndex + 1;
+
+		// Runs never cross parents, array boundaries (DynamicArray and Return commands end them), or padding,
+		// so they always fit in the command range CompareProperties_r is working on.
+		for (; EndIndex < Cmds.Num(); ++EndIndex)
+		{
+			const FRepLayoutCmd& PrevCmd = Cmds[EndIndex - 1];
+			const FRepLayoutCmd& Cmd = Cmds[EndIndex];
+
+			if (!CanCompareCmdAsMemory(Cmd) ||
+				Cmd.ParentIndex != FirstCmd.ParentIndex ||
+				Cmd.Offset != PrevCmd.Offset + PrevCmd.ElementSize ||
+				Cmd.ShadowOffset != PrevCmd.ShadowOffset + PrevCmd.ElementSize ||
+				NumBytes + Cmd.ElementSize > MaxBlockBytes)
+			{
+				break;
+			}
+
+			NumBytes += Cmd.ElementSize;
+		}
+
+		const int32 NumCmds = EndIndex - CmdIndex;
+
+		// A single command gains nothing from a memory compare
+		if (NumCmds > 1)
+		{
+			NewCompareBlocks[CmdIndex].NumCmds = static_cast<uint16>(NumCmds);
+			NewCompareBlocks[CmdIndex].NumBytes = static_cast<uint16>(NumBytes);
+			bHasBlocks = true;
+		}
+
+		CmdIndex = EndIndex;
+	}
+
+	if (bHasBlocks)
+	{
+		CompareBlocks = MoveTemp(NewCompareBlocks);
+	}
+}
+
 bool FSendingRepState::HasAnyPendingRetirements() const
 {
 	for (const FPropertyRetirement& PropRet : Retirement)
@@ -18,10 +18,12 @@
 #include "EngineUtils.h"
 #include "ReplayNetConnection.h"
 #include "Engine/DemoNetDriver.h"
+#include "Serialization/MemoryWriter.h"
 #include "UObject/Package.h"
 
 extern TAutoConsoleVariable<int32> CVarWithLevelStreamingFixes;
 extern TAutoConsoleVariable<int32> CVarWithDeltaCheckpoints;
+extern TAutoConsoleVariable<int32> CVarCheckpointSerializeAsync;
 extern TAutoConsoleVariable<int32> CVarWithGameSpecificFrameData;
 extern TAutoConsoleVariable<int32> CVarEnableCheckpoints;
 extern TAutoConsoleVariable<float> CVarCheckpointUploadDelayInSeconds;
@@ -33,6 +35,40 @@ extern TAutoConsoleVariable<float> CVarDemoMinRecordHz;
 
 CSV_DECLARE_CATEGORY_EXTERN(Demo);
 
+namespace ReplayHelperPrivate
+{
+	/** Versions and flags of the checkpoint archive, applied to the memory writers serializing parts of a checkpoint for it */
+	struct FCheckpointArchiveState
+	{
+		explicit FCheckpointArchiveState(const FArchive& CheckpointArchive)
+			: UEVer(CheckpointArchive.UEVer())
+			, LicenseeUEVer(CheckpointArchive.LicenseeUEVer())
+			, EngineVer(CheckpointArchive.EngineVer())
+			, CustomVersions(CheckpointArchive.GetCustomVersions())
+			, bIsPersistent(CheckpointArchive.IsPersistent())
+			, bForceUnicode(CheckpointArchive.IsForcingUnicode())
+		{
+		}
+
+		void Apply(FArchive& Writer) const
+		{
+			Writer.SetUEVer(UEVer);
+			Writer.SetLicenseeUEVer(LicenseeUEVer);
+			Writer.SetEngineVer(EngineVer);
+			Writer.SetCustomVersions(CustomVersions);
+			Writer.SetIsPersistent(bIsPersistent);
+			Writer.SetForceUnicode(bForceUnicode);
+		}
+
+		FPackageFileVersion UEVer;
+		int32 LicenseeUEVer;
+		FEngineVersionBase EngineVer;
+		FCustomVersionContainer CustomVersions;
+		bool bIsPersistent;
+		bool bForceUnicode;
+	};
+}
+
 FReplayHelper::FReplayHelper()
 	: CurrentLevelIndex(0)
 	, DemoFrameNum(0)
@@ -980,8 +1016,15 @@ void FReplayHelper::TickCheckpoint(UNetConnection* Connection)
 			{
 				SCOPED_NAMED_EVENT(FReplayHelper_SerializeGuidCache, FColor::Green);
 
-				// Save the current guid cache
-				bExecuteNextState = SerializeGuidCache(Connection, Params, CheckpointArchive);
+				// Save the current guid cache, or only check it when a task serializes it
+				if (CheckpointSaveContext.AsyncCheckpointData.IsValid())
+				{
+					bExecuteNextState = SnapshotGuidCache(Connection, Params);
+				}
+				else
+				{
+					bExecuteNextState = SerializeGuidCache(Connection, Params, CheckpointArchive);
+				}
 				if (bExecuteNextState)
 				{
 					CheckpointSaveContext.CheckpointSaveState = ECheckpointSaveState::SerializeNetFieldExportGroupMap;
@@ -998,13 +1041,27 @@ void FReplayHelper::TickCheckpoint(UNetConnection* Connection)
 					SCOPED_NAMED_EVENT(FReplayHelper_SerializeNetFieldExportGroupMap, FColor::Green);
 
 					// Save the compatible rep layout map
-					if (bDeltaCheckpoint)
+					auto SerializeNetFieldExports = [PackageMapClient, bDeltaCheckpoint](FArchive& Ar)
+					{
+						if (bDeltaCheckpoint)
+						{
+							PackageMapClient->SerializeNetFieldExportDelta(Ar);
+						}
+						else
+						{
+							PackageMapClient->SerializeNetFieldExportGroupMap(Ar);
+						}
+					};
+
+					if (FAsyncCheckpointData* AsyncData = CheckpointSaveContext.AsyncCheckpointData.Get())
 					{
-						PackageMapClient->SerializeNetFieldExportDelta(*CheckpointArchive);
+						FMemoryWriter Writer(AsyncData->NetFieldExportData);
+						ReplayHelperPrivate::FCheckpointArchiveState(*CheckpointArchive).Apply(Writer);
+						SerializeNetFieldExports(Writer);
 					}
 					else
 					{
-						PackageMapClient->SerializeNetFieldExportGroupMap(*CheckpointArchive);
+						SerializeNetFieldExports(*CheckpointArchive);
 					}
 
 					CheckpointSaveContext.CheckpointSaveState = ECheckpointSaveState::SerializeDemoFrameFromQueuedDemoPackets;
@@ -1020,19 +1077,6 @@ void FReplayHelper::TickCheckpoint(UNetConnection* Connection)
 				{
 					SCOPED_NAMED_EVENT(FReplayHelper_SerializeDemoFrameFromQueuedDemoPackets, FColor::Green);
 
-					// Write offset
-					if (CheckpointSaveContext.bWriteCheckpointOffset)
-					{
-						const FArchivePos CurrentPosition = CheckpointArchive->Tell();
-						FArchivePos Offset = CurrentPosition - (CheckpointSaveContext.CheckpointOffset + sizeof(FArchivePos));
-						CheckpointArchive->Seek(CheckpointSaveContext.CheckpointOffset);
-						*CheckpointArchive << Offset;
-						CheckpointArchive->Seek(CurrentPosition);
-					}
-
-					// Get the size of the guid data saved
-					CheckpointSaveContext.GuidCacheSize = CheckpointArchive->TotalSize();
-
 					// This will cause the entire name list to be written out again.
 					// Note, WriteDemoFrame will set this to 0 so we guard the value.
 					// This is because when checkpoint amortization is enabled, it's possible for new levels to stream
@@ -1040,9 +1084,45 @@ void FReplayHelper::TickCheckpoint(UNetConnection* Connection)
 					// streaming archive next frame.
 					TGuardValue<uint32> NumLevelsAddedThisFrameGuard(NumLevelsAddedThisFrame, AllLevelStatuses.Num());
 
-					// Write out all of the queued up packets generated while saving the checkpoint
-					WriteDemoFrame(Connection, *CheckpointArchive, QueuedCheckpointPackets, static_cast<float>(LastCheckpointTime), EWriteDemoFrameFlags::SkipGameSpecific);
+					if (FAsyncCheckpointData* AsyncData = CheckpointSaveContext.AsyncCheckpointData.Get())
+					{
+						{
+							FMemoryWriter Writer(AsyncData->DemoFrameHeaderData);
+							ReplayHelperPrivate::FCheckpointArchiveState(*CheckpointArchive).Apply(Writer);
+							WriteDemoFrameHeader(Connection, Writer, static_cast<float>(LastCheckpointTime), EWriteDemoFrameFlags::SkipGameSpecific);
+						}
+
+						// The queued up packets hold the replicated state of the checkpoint actors, the task writes them after the guid cache
+						AsyncData->DemoFramePackets = MoveTemp(QueuedCheckpointPackets);
+						AsyncData->bLevelStreamingFixes = HasLevelStreamingFixes();
+
+						LaunchAsyncCheckpointTask(*CheckpointArchive);
+
+						CheckpointSaveContext.CheckpointSaveState = ECheckpointSaveState::AppendAsyncCheckpointData;
+					}
+					else
+					{
+						WriteCheckpointOffset(*CheckpointArchive, CheckpointArchive->Tell());
+
+						// Get the size of the guid data saved
+						CheckpointSaveContext.GuidCacheSize = CheckpointArchive->TotalSize();
+
+						// Write out all of the queued up packets generated while saving the checkpoint
+						WriteDemoFrame(Connection, *CheckpointArchive, QueuedCheckpointPackets, static_cast<float>(LastCheckpointTime), EWriteDemoFrameFlags::SkipGameSpecific);
+
+						CheckpointSaveContext.CheckpointSaveState = ECheckpointSaveState::Finalize;
+					}
+				}
+			}
+			break;
+
+			case ECheckpointSaveState::AppendAsyncCheckpointData:
+			{
+				SCOPED_NAMED_EVENT(FReplayHelper_AppendAsyncCheckpointData, FColor::Green);
 
+				bExecuteNextState = AppendAsyncCheckpointData(Params, CheckpointArchive);
+				if (bExecuteNextState)
+				{
 					CheckpointSaveContext.CheckpointSaveState = ECheckpointSaveState::Finalize;
 				}
 			}
@@ -1085,8 +1165,6 @@ void FReplayHelper::TickCheckpoint(UNetConnection* Connection)
 // Serialize as many net guids as fit into a single frame (if time boxed) from previously made snapshot
 bool FReplayHelper::SerializeGuidCache(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive)
 {
-	check(Connection);
-
 	if (CheckpointSaveContext.NextAmortizedItem == 0) // is the first iteration?
 	{
 		CheckpointSaveContext.NetGuidsCountPos = CheckpointArchive->Tell();
@@ -1101,48 +1179,108 @@ bool FReplayHelper::SerializeGuidCache(UNetConnection* Connection, const FRepAct
 
 	while (CheckpointSaveContext.NextAmortizedItem < CheckpointSaveContext.NetGuidCacheSnapshot.Num())
 	{
-		FNetworkGUID& NetworkGUID = CheckpointSaveContext.NetGuidCacheSnapshot[CheckpointSaveContext.NextAmortizedItem].NetGuid;
-		FNetGuidCacheObject& CacheObject = CheckpointSaveContext.NetGuidCacheSnapshot[CheckpointSaveContext.NextAmortizedItem].NetGuidCacheObject;
+		FNetGuidCacheItem& Item = CheckpointSaveContext.NetGuidCacheSnapshot[CheckpointSaveContext.NextAmortizedItem];
 
-		const UObject* Object = CacheObject.Object.Get();
+		// Amortized checkpoints serialize the snapshot over several frames, skip objects destroyed or renamed since then
+		const UObject* Object = Item.Object.Get();
 
-		if (Object && (NetworkGUID.IsStatic() || Object->IsNameStableForNetworking()))
+		if (Object && (Item.NetGuid.IsStatic() || Object->IsNameStableForNetworking()))
 		{
-			*CheckpointArchive << NetworkGUID;
-			*CheckpointArchive << CacheObject.OuterGUID;
+			SerializeGuidCacheItem(*CheckpointArchive, Item, CheckpointSaveContext.NameTableMap, Connection);
+			++CheckpointSaveContext.NumNetGuidsForRecording;
+		}
 
-			uint32* NametableIndex = CheckpointSaveContext.NameTableMap.Find(CacheObject.PathName);
-			if (NametableIndex == nullptr)
-			{
-				uint8 bExported = 1;
-				*CheckpointArchive << bExported;
+		++CheckpointSaveContext.NextAmortizedItem;
 
-				FString PathName = CacheObject.PathName.ToString();
-				GEngine->NetworkRemapPath(Connection, PathName, false);
+		if (Params.CheckpointMaxUploadTimePerFrame > 0 && (FPlatformTime::Seconds() >= Deadline))
+		{
+			break;
+		}
+	}
 
-				*CheckpointArchive << PathName;
+	const bool bCompleted = (CheckpointSaveContext.NextAmortizedItem == CheckpointSaveContext.NetGuidCacheSnapshot.Num());
+	if (bCompleted)
+	{
+		FArchivePos Pos = CheckpointArchive->Tell();
+		CheckpointArchive->Seek(CheckpointSaveContext.NetGuidsCountPos);
+		*CheckpointArchive << CheckpointSaveContext.NumNetGuidsForRecording;
+		CheckpointArchive->Seek(Pos);
+	}
 
-				uint32 TableIndex = CheckpointSaveContext.NameTableMap.Num();
-				
-				CheckpointSaveContext.NameTableMap.Add(CacheObject.PathName, TableIndex);
-			}
-			else
-			{
-				uint8 bExported = 0;
-				*CheckpointArchive << bExported;
+	return bCompleted;
+}
 
-				uint32 TableIndex = *NametableIndex;
+void FReplayHelper::SerializeGuidCacheItem(FArchive& Ar, FNetGuidCacheItem& Item, TMap<FName, uint32>& NameTableMap, UNetConnection* Connection)
+{
+	Ar << Item.NetGuid;
+	Ar << Item.OuterGUID;
 
-				CheckpointArchive->SerializeIntPacked(TableIndex);
-			}
+	if (const uint32* NametableIndex = NameTableMap.Find(Item.PathName))
+	{
+		uint8 bExported = 0;
+		Ar << bExported;
+
+		uint32 TableIndex = *NametableIndex;
 
-			uint8 Flags = 0;
-			Flags |= CacheObject.bNoLoad ? (1 << 0) : 0;
-			Flags |= CacheObject.bIgnoreWhenMissing ? (1 << 1) : 0;
+		Ar.SerializeIntPacked(TableIndex);
+	}
+	else
+	{
+		// SnapshotGuidCache already remapped the path when the item is serialized on a worker thread
+		if (Item.RemappedPathName.IsEmpty())
+		{
+			check(IsInGameThread());
+
+			Item.RemappedPathName = Item.PathName.ToString();
+			GEngine->NetworkRemapPath(Connection, Item.RemappedPathName, false);
+		}
 
-			*CheckpointArchive << Flags;
+		uint8 bExported = 1;
+		Ar << bExported;
 
-			++CheckpointSaveContext.NumNetGuidsForRecording;
+		Ar << Item.RemappedPathName;
+
+		uint32 TableIndex = NameTableMap.Num();
+
+		NameTableMap.Add(Item.PathName, TableIndex);
+	}
+
+	Ar << Item.Flags;
+}
+
+// Checkpoint saving step.
+// Check as many items of the snapshot as fit into a single frame (if time boxed), and keep the ones SerializeGuidCache would serialize for the checkpoint task
+bool FReplayHelper::SnapshotGuidCache(UNetConnection* Connection, const FRepActorsCheckpointParams& Params)
+{
+	FAsyncCheckpointData& AsyncData = *CheckpointSaveContext.AsyncCheckpointData;
+
+	FCheckpointStepHelper StepHelper(ECheckpointSaveState::SerializeGuidCache, Params.StartCheckpointTime, &CheckpointSaveContext.NextAmortizedItem, CheckpointSaveContext.NetGuidCacheSnapshot.Num());
+
+	const double Deadline = Params.StartCheckpointTime + Params.CheckpointMaxUploadTimePerFrame;
+
+	while (CheckpointSaveContext.NextAmortizedItem < CheckpointSaveContext.NetGuidCacheSnapshot.Num())
+	{
+		FNetGuidCacheItem& Item = CheckpointSaveContext.NetGuidCacheSnapshot[CheckpointSaveContext.NextAmortizedItem];
+
+		// Same check as SerializeGuidCache, done when the item is reached so that both paths record the same objects
+		const UObject* Object = Item.Object.Get();
+
+		if (Object && (Item.NetGuid.IsStatic() || Object->IsNameStableForNetworking()))
+		{
+			// Remapping needs the game thread, do it for the item which will export the path name
+			if (!AsyncData.NameTableMap.Contains(Item.PathName))
+			{
+				bool bIsAlreadyExported = false;
+				AsyncData.ExportedPathNames.Add(Item.PathName, &bIsAlreadyExported);
+
+				if (!bIsAlreadyExported)
+				{
+					Item.RemappedPathName = Item.PathName.ToString();
+					GEngine->NetworkRemapPath(Connection, Item.RemappedPathName, false);
+				}
+			}
+
+			AsyncData.NetGuidCacheItems.Add(MoveTemp(Item));
 		}
 
 		++CheckpointSaveContext.NextAmortizedItem;
@@ -1156,15 +1294,96 @@ bool FReplayHelper::SerializeGuidCache(UNetConnection* Connection, const FRepAct
 	const bool bCompleted = (CheckpointSaveContext.NextAmortizedItem == CheckpointSaveContext.NetGuidCacheSnapshot.Num());
 	if (bCompleted)
 	{
-		FArchivePos Pos = CheckpointArchive->Tell();
-		CheckpointArchive->Seek(CheckpointSaveContext.NetGuidsCountPos);
-		*CheckpointArchive << CheckpointSaveContext.NumNetGuidsForRecording;
-		CheckpointArchive->Seek(Pos);
+		CheckpointSaveContext.NetGuidCacheSnapshot.Empty();
+		AsyncData.ExportedPathNames.Empty();
 	}
 
 	return bCompleted;
 }
 
+// Serialize the guid cache, the rep layout map and the demo frame of the checkpoint on a worker thread.
+// The task only uses the data gathered on the game thread, which it shares so that it can outlive the checkpoint context.
+void FReplayHelper::LaunchAsyncCheckpointTask(const FArchive& CheckpointArchive)
+{
+	const ReplayHelperPrivate::FCheckpointArchiveState ArchiveState(CheckpointArchive);
+
+	CheckpointSaveContext.AsyncCheckpointTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [AsyncData = CheckpointSaveContext.AsyncCheckpointData.ToSharedRef(), ArchiveState]
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FReplayHelper::AsyncCheckpointTask);
+
+		FMemoryWriter Writer(AsyncData->Data);
+		ArchiveState.Apply(Writer);
+
+		// Same layout as SerializeGuidCache
+		const FArchivePos NetGuidsCountPos = Writer.Tell();
+		Writer << AsyncData->NumNetGuids;
+
+		for (FNetGuidCacheItem& Item : AsyncData->NetGuidCacheItems)
+		{
+			SerializeGuidCacheItem(Writer, Item, AsyncData->NameTableMap, nullptr);
+			++AsyncData->NumNetGuids;
+		}
+
+		const FArchivePos Pos = Writer.Tell();
+		Writer.Seek(NetGuidsCountPos);
+		Writer << AsyncData->NumNetGuids;
+		Writer.Seek(Pos);
+
+		Writer.Serialize(AsyncData->NetFieldExportData.GetData(), AsyncData->NetFieldExportData.Num());
+
+		AsyncData->DemoFrameOffset = Writer.Tell();
+		Writer.Serialize(AsyncData->DemoFrameHeaderData.GetData(), AsyncData->DemoFrameHeaderData.Num());
+		WriteDemoFramePackets(Writer, AsyncData->DemoFramePackets, AsyncData->bLevelStreamingFixes);
+	});
+}
+
+// Checkpoint saving step.
+// Append the data serialized by the checkpoint task once it completed
+bool FReplayHelper::AppendAsyncCheckpointData(const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive)
+{
+	if (!CheckpointSaveContext.AsyncCheckpointTask.IsCompleted())
+	{
+		// Amortized checkpoints check back next frame, others are saved in a single frame
+		if (Params.CheckpointMaxUploadTimePerFrame > 0)
+		{
+			return false;
+		}
+
+		SCOPED_NAMED_EVENT(FReplayHelper_WaitForAsyncCheckpointTask, FColor::Red);
+		CheckpointSaveContext.AsyncCheckpointTask.Wait();
+	}
+
+	FAsyncCheckpointData& AsyncData = *CheckpointSaveContext.AsyncCheckpointData;
+
+	WriteCheckpointOffset(*CheckpointArchive, CheckpointArchive->Tell() + AsyncData.DemoFrameOffset);
+
+	// Get the size of the guid data saved
+	CheckpointSaveContext.GuidCacheSize = CheckpointArchive->TotalSize() + AsyncData.DemoFrameOffset;
+
+	CheckpointArchive->Serialize(AsyncData.Data.GetData(), AsyncData.Data.Num());
+
+	CheckpointSaveContext.NameTableMap = MoveTemp(AsyncData.NameTableMap);
+	CheckpointSaveContext.NumNetGuidsForRecording = AsyncData.NumNetGuids;
+
+	CheckpointSaveContext.AsyncCheckpointTask = UE::Tasks::FTask();
+	CheckpointSaveContext.AsyncCheckpointData.Reset();
+
+	return true;
+}
+
+// Rewrite the offset written after the checkpoint actors, so that it points to the demo frame of the checkpoint
+void FReplayHelper::WriteCheckpointOffset(FArchive& CheckpointArchive, FArchivePos DemoFramePos)
+{
+	if (CheckpointSaveContext.bWriteCheckpointOffset)
+	{
+		const FArchivePos CurrentPosition = CheckpointArchive.Tell();
+		FArchivePos Offset = DemoFramePos - (CheckpointSaveContext.CheckpointOffset + sizeof(FArchivePos));
+		CheckpointArchive.Seek(CheckpointSaveContext.CheckpointOffset);
+		CheckpointArchive << Offset;
+		CheckpointArchive.Seek(CurrentPosition);
+	}
+}
+
 bool FReplayHelper::SerializeDeletedStartupActors(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive)
 {
 	check(Connection);
@@ -1331,6 +1550,12 @@ void FReplayHelper::WriteDemoFrame(UNetConnection* Connection, FArchive& Ar, TAr
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Replay write frame time"), STAT_ReplayWriteDemoFrame, STATGROUP_Net);
 
+	WriteDemoFrameHeader(Connection, Ar, FrameTime, Flags);
+	WriteDemoFramePackets(Ar, QueuedPackets, HasLevelStreamingFixes());
+}
+
+void FReplayHelper::WriteDemoFrameHeader(UNetConnection* Connection, FArchive& Ar, float FrameTime, EWriteDemoFrameFlags Flags)
+{
 	check(Connection);
 
 	Ar << CurrentLevelIndex;
@@ -1395,10 +1620,13 @@ void FReplayHelper::WriteDemoFrame(UNetConnection* Connection, FArchive& Ar, TAr
 			Ar << Data;
 		}
 	}
+}
 
+void FReplayHelper::WriteDemoFramePackets(FArchive& Ar, TArray<FQueuedDemoPacket>& QueuedPackets, bool bLevelStreamingFixes)
+{
 	for (FQueuedDemoPacket& DemoPacket : QueuedPackets)
 	{
-		if (HasLevelStreamingFixes())
+		if (bLevelStreamingFixes)
 		{
 			ensureAlways(DemoPacket.SeenLevelIndex);
 			Ar.SerializeIntPacked(DemoPacket.SeenLevelIndex);
@@ -1409,7 +1637,7 @@ void FReplayHelper::WriteDemoFrame(UNetConnection* Connection, FArchive& Ar, TAr
 
 	QueuedPackets.Empty();
 
-	if (HasLevelStreamingFixes())
+	if (bLevelStreamingFixes)
 	{
 		uint32 EndCountUnsigned = 0;
 		Ar.SerializeIntPacked(EndCountUnsigned);
@@ -1521,7 +1749,12 @@ void FReplayHelper::CacheNetGuids(UNetConnection* Connection)
 			// Do not add guids we would filter out in the serialize step
 			if (NetworkGUID.IsValid() && CacheObject.Object.Get() && (NetworkGUID.IsStatic() || CacheObject.Object->IsNameStableForNetworking()))
 			{
-				CheckpointSaveContext.NetGuidCacheSnapshot.Add({ NetworkGUID, CacheObject });
+				FNetGuidCacheItem& Item = CheckpointSaveContext.NetGuidCacheSnapshot.AddDefaulted_GetRef();
+				Item.NetGuid = NetworkGUID;
+				Item.Object = CacheObject.Object;
+				Item.OuterGUID = CacheObject.OuterGUID;
+				Item.PathName = CacheObject.PathName;
+				Item.Flags = (CacheObject.bNoLoad ? (1 << 0) : 0) | (CacheObject.bIgnoreWhenMissing ? (1 << 1) : 0);
 
 				CacheObject.bDirtyForReplay = false;
 
@@ -1530,6 +1763,13 @@ void FReplayHelper::CacheNetGuids(UNetConnection* Connection)
 		}
 
 		UE_LOG(LogDemo, Verbose, TEXT("CacheNetGuids: %d, %.1f ms"), NumValues, (FPlatformTime::Seconds() - StartTime) * 1000);
+
+		// The rest of the checkpoint is serialized by a task, from the data the game thread gathers in the next states
+		if (CVarCheckpointSerializeAsync.GetValueOnGameThread())
+		{
+			CheckpointSaveContext.AsyncCheckpointData = MakeShared<FAsyncCheckpointData>();
+			CheckpointSaveContext.AsyncCheckpointData->NameTableMap = MoveTemp(CheckpointSaveContext.NameTableMap);
+		}
 	}
 }
 
@@ -1663,10 +1903,36 @@ void FReplayHelper::FCheckpointSaveStateContext::CountBytes(FArchive& Ar) const
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("DeltaCheckpointData", DeltaCheckpointData.CountBytes(Ar));
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("DeltaChannelCloseKeys", DeltaChannelCloseKeys.CountBytes(Ar));
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("NetGuidCacheSnapshot", NetGuidCacheSnapshot.CountBytes(Ar));
+
+	// The checkpoint task writes into the async data while it runs
+	if (AsyncCheckpointData.IsValid() && AsyncCheckpointTask.IsCompleted())
+	{
+		GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("AsyncCheckpointData", AsyncCheckpointData->CountBytes(Ar));
+	}
+
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("CheckpointDeletedNetStartupActors", CheckpointDeletedNetStartupActors.CountBytes(Ar));
 	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("NameTableMap", NameTableMap.CountBytes(Ar));
 }
 
+void FReplayHelper::FAsyncCheckpointData::CountBytes(FArchive& Ar) const
+{
+	GRANULAR_NETWORK_MEMORY_TRACKING_INIT(Ar, "FAsyncCheckpointData::CountBytes");
+
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("NetGuidCacheItems", NetGuidCacheItems.CountBytes(Ar));
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("NameTableMap", NameTableMap.CountBytes(Ar));
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("ExportedPathNames", ExportedPathNames.CountBytes(Ar));
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("NetFieldExportData", NetFieldExportData.CountBytes(Ar));
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("DemoFrameHeaderData", DemoFrameHeaderData.CountBytes(Ar));
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("DemoFramePackets",
+		DemoFramePackets.CountBytes(Ar);
+		for (const FQueuedDemoPacket& QueuedPacket : DemoFramePackets)
+		{
+			QueuedPacket.CountBytes(Ar);
+		}
+	);
+	GRANULAR_NETWORK_MEMORY_TRACKING_TRACK("Data", Data.CountBytes(Ar));
+}
+
 void FReplayHelper::Serialize(FArchive& Ar)
 {
 	GRANULAR_NETWORK_MEMORY_TRACKING_INIT(Ar, "FReplayHelper::Serialize");
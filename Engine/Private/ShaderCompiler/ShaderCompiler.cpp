@@ -51,6 +51,7 @@
 #include "Serialization/MemoryReader.h"
 #include "Serialization/NameAsStringProxyArchive.h"
 #include "ShaderCodeLibrary.h"
+#include "ShaderJobDiskCache.h"
 #include "ShaderPlatformCachedIniValue.h"
 #include "StaticBoundShaderState.h"
 #include "StereoRenderUtils.h"
@@ -769,12 +770,33 @@ private:
 
 	void InternalSetPriority(FShaderCommonCompileJob* Job, EShaderCompileJobPriority InPriority);
 
-	/** Looks for or adds an entry for the given hash in the cache.  Returns cached output if it exists, or may initialize DDC request if one has been issued. */
-	FShaderJobCacheRef FindOrAdd(const FJobInputHash& Hash, EShaderCompileJobPriority JobPriority, const bool bCheckDDC, TPimplPtr<UE::DerivedData::FRequestOwner>& InoutRequestOwner, FJobCachedOutput*& OutCachedOutput);
+	/** Output read from the disk cache before taking JobLock, since reading and validating it can take a while */
+	struct FDiskCacheOutput
+	{
+		FSharedBuffer Output;
+		FJobOutputHash OutputHash;
+	};
+
+	/**
+	 * Looks for or adds an entry for the given hash in the cache.  Returns cached output if it exists, or may initialize DDC request if one has been issued.
+	 * DiskCacheOutput is the result of ReadFromDiskCache for this hash, if any.
+	 */
+	FShaderJobCacheRef FindOrAdd(const FJobInputHash& Hash, EShaderCompileJobPriority JobPriority, const bool bCheckDDC, TPimplPtr<UE::DerivedData::FRequestOwner>& InoutRequestOwner, FJobCachedOutput*& OutCachedOutput, FDiskCacheOutput* DiskCacheOutput = nullptr);
 
 	/** Find an existing item in the cache. */
 	FShaderJobData* Find(const FJobInputHash& Hash);
 
+#if WITH_EDITOR
+	/**
+	 * Reads the output for the given input hash from the disk cache, unless the job cache already has it or a job for it is in flight.
+	 * Follows the same rules as the per shader DDC (bCheckDDC and -noshaderddc). Must be called without JobLock held.
+	 */
+	FDiskCacheOutput ReadFromDiskCache(const FJobInputHash& Hash, const bool bCheckDDC);
+
+	/** Adds an output read by ReadFromDiskCache to the cache for JobData. */
+	void AddFromDiskCache(FShaderJobData& JobData, FDiskCacheOutput&& DiskCacheOutput, FJobCachedOutput*& OutCachedOutput);
+#endif
+
 	/** Add a reference to a duplicate job (to the DuplicateJobs array) */
 	void AddDuplicateJob(FShaderCommonCompileJob* DuplicateJob);
 
@@ -973,6 +995,11 @@ private:
 
 	/** Statistics - allocated memory. If the number is non-zero, we can trust it as accurate. Otherwise, recalculate. */
 	uint64 CurrentlyAllocatedMemory = 0;
+
+#if WITH_EDITOR
+	/** Persistent tier queried before the DDC, and filled with the outputs of jobs compiled by this process. */
+	TUniquePtr<FShaderJobDiskCache> DiskCache;
+#endif
 };
 
 static FShaderJobData& GetShaderJobData(const FShaderJobCacheRef& CacheRef)
@@ -986,9 +1013,10 @@ FShaderJobData* FShaderJobDataMap::Find(const FShaderJobData::FJobInputHash& Key
 	// Search for key with linear probing
 	for (uint32 TableIndex = GetTypeHash(Key) & HashTableMask; HashTable[TableIndex] != INDEX_NONE; TableIndex = (TableIndex + 1) & HashTableMask)
 	{
-		if ((*this)[TableIndex].InputHash == Key)
+		const int32 ItemIndex = HashTable[TableIndex];
+		if ((*this)[ItemIndex].InputHash == Key)
 		{
-			return &(*this)[TableIndex];
+			return &(*this)[ItemIndex];
 		}
 	}
 	return nullptr;
@@ -1604,6 +1632,13 @@ void FShaderJobCache::SubmitJob(FShaderCommonCompileJob* Job)
 
 		const bool bCheckDDC = GShaderCompilerPerShaderDDCGlobal || !(Job->bIsDefaultMaterial || Job->bIsGlobalShader);
 
+#if WITH_EDITOR
+		FDiskCacheOutput DiskCacheOutput = Job->RequestOwner ? FDiskCacheOutput() : ReadFromDiskCache(InputHash, bCheckDDC);
+		FDiskCacheOutput* DiskCacheOutputPtr = &DiskCacheOutput;
+#else
+		FDiskCacheOutput* DiskCacheOutputPtr = nullptr;
+#endif
+
 		// We don't use a scope here, because we need to release this lock before calling ProcessFinishedJob, which needs to acquire
 		// CompileQueueSection.  It's not safe to acquire CompileQueueSection where JobLock is locked first, as it will cause
 		// deadlocks due to FShaderCompileThreadRunnable::CompilingLoop calling GetPendingJobs, which acquires those two locks in
@@ -1624,7 +1659,7 @@ void FShaderJobCache::SubmitJob(FShaderCommonCompileJob* Job)
 		check(Job->JobIndex != INDEX_NONE);
 
 		FSharedBuffer* ExistingOutput;
-		FShaderJobCacheRef JobCacheRef = FindOrAdd(InputHash, Job->Priority, bCheckDDC, Job->RequestOwner, ExistingOutput);
+		FShaderJobCacheRef JobCacheRef = FindOrAdd(InputHash, Job->Priority, bCheckDDC, Job->RequestOwner, ExistingOutput, DiskCacheOutputPtr);
 
 		// see if there are already cached results for this job
 		if (ExistingOutput)
@@ -4678,6 +4713,16 @@ void FShaderCompilerStats::WriteStatSummary()
 		{
 			UE_LOG(LogShaderCompilers, Display, TEXT("RAM used: %s, no memory limit set"), *FText::AsMemory(Counters.CacheMemUsed, &SizeFormattingOptions, nullptr, EMemoryUnitStandard::IEC).ToString());
 		}
+
+		if (Counters.TotalCacheDiskQueries > 0)
+		{
+			UE_LOG(LogShaderCompilers, Display, TEXT("Disk cache queries %s, among them hits %s (%.2f%%), disk used: %s of %s budget"),
+				*FormatNumber(Counters.TotalCacheDiskQueries),
+				*FormatNumber(Counters.TotalCacheDiskHits),
+				100.0 * static_cast<double>(Counters.TotalCacheDiskHits) / static_cast<double>(Counters.TotalCacheDiskQueries),
+				*FText::AsMemory(Counters.CacheDiskUsed, &SizeFormattingOptions, nullptr, EMemoryUnitStandard::IEC).ToString(),
+				*FText::AsMemory(Counters.CacheDiskBudget, &SizeFormattingOptions, nullptr, EMemoryUnitStandard::IEC).ToString());
+		}
 	}
 
 	const double TotalTimeAtLeastOneJobWasInFlight = GetTimeShaderCompilationWasActive();
@@ -4898,6 +4943,16 @@ void FShaderCompilerStats::GatherAnalytics(const FString& BaseName, TArray<FAnal
 			FString AttrName = BaseName + ChildName + TEXT("MemBudget");
 			Attributes.Emplace(MoveTemp(AttrName), Counters.CacheMemBudget);
 		}
+
+		{
+			FString AttrName = BaseName + ChildName + TEXT("DiskHits");
+			Attributes.Emplace(MoveTemp(AttrName), Counters.TotalCacheDiskHits);
+		}
+
+		{
+			FString AttrName = BaseName + ChildName + TEXT("DiskUsed");
+			Attributes.Emplace(MoveTemp(AttrName), Counters.CacheDiskUsed);
+		}
 	}
 
 	MaterialCounters.GatherAnalytics(Attributes);
@@ -10735,7 +10790,16 @@ namespace
 }
 #endif
 
-FShaderJobCacheRef FShaderJobCache::FindOrAdd(const FJobInputHash& Hash, EShaderCompileJobPriority JobPriority, const bool bCheckDDC, TPimplPtr<UE::DerivedData::FRequestOwner>& InoutRequestOwner, FJobCachedOutput*& OutCachedOutput)
+#if WITH_EDITOR
+/** If NoShaderDDC then don't check for a material the first time we encounter it to simulate a cold DDC */
+static bool IsNoShaderDDC()
+{
+	static bool bNoShaderDDC = FParse::Param(FCommandLine::Get(), TEXT("noshaderddc"));
+	return bNoShaderDDC;
+}
+#endif
+
+FShaderJobCacheRef FShaderJobCache::FindOrAdd(const FJobInputHash& Hash, EShaderCompileJobPriority JobPriority, const bool bCheckDDC, TPimplPtr<UE::DerivedData::FRequestOwner>& InoutRequestOwner, FJobCachedOutput*& OutCachedOutput, FDiskCacheOutput* DiskCacheOutput)
 {
 	LLM_SCOPE_BYTAG(ShaderCompiler);
 
@@ -10769,14 +10833,16 @@ FShaderJobCacheRef FShaderJobCache::FindOrAdd(const FJobInputHash& Hash, EShader
 		OutCachedOutput = &(*CannedOutput)->JobOutput;
 	}
 #if WITH_EDITOR
+	else if (JobData.JobInFlight == nullptr && !InoutRequestOwner && DiskCacheOutput && !DiskCacheOutput->Output.IsNull())
+	{
+		UE_LOG(LogShaderCompilers, UE_SHADERCACHE_LOG_LEVEL, TEXT("Found a disk cache result for job with ihash %s."), *LexToString(Hash));
+		AddFromDiskCache(JobData, MoveTemp(*DiskCacheOutput), OutCachedOutput);
+	}
 	else
 	{
-		// If NoShaderDDC then don't check for a material the first time we encounter it to simulate a cold DDC
-		static bool bNoShaderDDC = FParse::Param(FCommandLine::Get(), TEXT("noshaderddc"));
-
 		// If we didn't find it in memory search the DDC if it's enabled.
 		// Don't search if this isn't the first job with this hash (JobInFlight already set), or there's already a request in flight.
-		const bool bCachePerShaderDDC = IsShaderJobCacheDDCEnabled() && bCheckDDC && !bNoShaderDDC;
+		const bool bCachePerShaderDDC = IsShaderJobCacheDDCEnabled() && bCheckDDC && !IsNoShaderDDC();
 		if (bCachePerShaderDDC && (JobData.JobInFlight == nullptr) && !InoutRequestOwner)
 		{
 			TRACE_COUNTER_INCREMENT(Shaders_JobCacheDDCRequests);
@@ -10995,6 +11061,57 @@ FShaderJobCacheRef FShaderJobCache::FindOrAdd(const FJobInputHash& Hash, EShader
 	return JobCacheRef;
 }
 
+#if WITH_EDITOR
+FShaderJobCache::FDiskCacheOutput FShaderJobCache::ReadFromDiskCache(const FJobInputHash& Hash, const bool bCheckDDC)
+{
+	FDiskCacheOutput DiskCacheOutput;
+	if (!DiskCache || !bCheckDDC || IsNoShaderDDC())
+	{
+		return DiskCacheOutput;
+	}
+
+	// Only read from disk if the output is needed, a quick look under the read lock is much cheaper than the read
+	{
+		FReadScopeLock ReadLock(JobLock);
+		const FShaderJobData* JobData = InputHashToJobData.Find(Hash);
+		if (JobData && (JobData->HasOutput() || JobData->JobInFlight != nullptr))
+		{
+			return DiskCacheOutput;
+		}
+	}
+
+	DiskCacheOutput.Output = DiskCache->Find(Hash, DiskCacheOutput.OutputHash);
+	return DiskCacheOutput;
+}
+
+void FShaderJobCache::AddFromDiskCache(FShaderJobData& JobData, FDiskCacheOutput&& DiskCacheOutput, FJobCachedOutput*& OutCachedOutput)
+{
+	const FJobOutputHash& OutputHash = DiskCacheOutput.OutputHash;
+
+	// Outputs are deduplicated, another input hash may already have brought this one back into memory
+	FStoredOutput** ExistingStoredOutput = Outputs.Find(OutputHash);
+	FStoredOutput* StoredOutput = ExistingStoredOutput ? *ExistingStoredOutput : nullptr;
+	if (StoredOutput == nullptr)
+	{
+		const uint64 OutputsOriginalSize = Outputs.GetAllocatedSize();
+
+		StoredOutput = new FStoredOutput();
+		StoredOutput->JobOutput = MoveTemp(DiskCacheOutput.Output);
+		Outputs.Add(OutputHash, StoredOutput);
+		CurrentlyAllocatedMemory += StoredOutput->GetAllocatedSize() + Outputs.GetAllocatedSize() - OutputsOriginalSize;
+	}
+
+	// Increment refcount of output whether or not we created it above
+	StoredOutput->AddRef();
+	StoredOutput->NumHits++;
+
+	JobData.OutputHash = OutputHash;
+	JobData.bOutputFromDDC = false;
+
+	OutCachedOutput = &StoredOutput->JobOutput;
+}
+#endif
+
 FShaderJobData* FShaderJobCache::Find(const FJobInputHash& Hash)
 {
 	check(ShaderCompiler::IsJobCacheEnabled());
@@ -11046,6 +11163,13 @@ FShaderJobCache::FShaderJobCache(FCriticalSection& InCompileQueueSection)
 #endif
 
 	CurrentlyAllocatedMemory = sizeof(*this) + InputHashToJobData.GetAllocatedSize() + Outputs.GetAllocatedSize();
+
+#if WITH_EDITOR
+	if (ShaderCompiler::IsJobCacheEnabled() && FShaderJobDiskCache::IsEnabled())
+	{
+		DiskCache = MakeUnique<FShaderJobDiskCache>(FPaths::ProjectSavedDir() / TEXT("ShaderJobCache"));
+	}
+#endif
 }
 
 FShaderJobCache::~FShaderJobCache()
@@ -11212,6 +11336,11 @@ void FShaderJobCache::AddJobOutput(FShaderJobData& JobData, const FShaderCommonC
 	}
 
 #if WITH_EDITOR
+	if (DiskCache && !bDiscardCacheOutputs)
+	{
+		DiskCache->Add(Hash, OutputHash, Contents);
+	}
+
 	const bool bCachePerShaderDDC = IsShaderJobCacheDDCEnabled() && bAddToDDC;
 
 	if (bCachePerShaderDDC)
@@ -11268,6 +11397,15 @@ void FShaderJobCache::GetStats(FShaderCompilerStats& OutStats) const
 	OutStats.Counters.UniqueCacheOutputs = Outputs.Num();
 	OutStats.Counters.CacheMemUsed = GetAllocatedMemory();
 	OutStats.Counters.CacheMemBudget = GetCurrentMemoryBudget();
+#if WITH_EDITOR
+	if (DiskCache)
+	{
+		OutStats.Counters.TotalCacheDiskQueries = DiskCache->GetNumQueries();
+		OutStats.Counters.TotalCacheDiskHits = DiskCache->GetNumHits();
+		OutStats.Counters.CacheDiskUsed = DiskCache->GetSize();
+		OutStats.Counters.CacheDiskBudget = DiskCache->GetBudget();
+	}
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
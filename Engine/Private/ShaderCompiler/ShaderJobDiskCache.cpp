@@ -0,0 +1,433 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShaderJobDiskCache.h"
+
+#if WITH_EDITOR
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ShaderCompiler.h"
+
+static bool GShaderCompilerJobCacheDisk = true;
+static FAutoConsoleVariableRef CVarShaderCompilerJobCacheDisk(
+	TEXT("r.ShaderCompiler.JobCache.Disk"),
+	GShaderCompilerJobCacheDisk,
+	TEXT("If true, shader job outputs are also stored on disk (in Saved/ShaderJobCache) keyed by their input hash, so they can be reused by later editor sessions and cooks without compiling them again."),
+	ECVF_ReadOnly
+);
+
+static int32 GShaderCompilerJobCacheDiskMaxSizeMB = 4096;
+static FAutoConsoleVariableRef CVarShaderCompilerJobCacheDiskMaxSizeMB(
+	TEXT("r.ShaderCompiler.JobCache.DiskMaxSizeMB"),
+	GShaderCompilerJobCacheDiskMaxSizeMB,
+	TEXT("Size limit of the shader job outputs stored on disk (4GB by default), the least recently used ones are removed past it. If 0, the size is unlimited."),
+	ECVF_Default
+);
+
+namespace ShaderJobDiskCache
+{
+	static constexpr uint32 IndexMagic = 0x534A4443;
+	/** Bump when the index layout or the serialized job outputs change in a way the input hash doesn't account for. */
+	static constexpr uint32 IndexVersion = 1;
+
+	/** Number of entries added or used before the index is saved again, so little is lost if the process doesn't exit cleanly. */
+	static constexpr int32 SaveInterval = 1024;
+
+	/** Percentage of the budget outputs are trimmed to once over it, so we don't have to trim again for every new output. */
+	static constexpr uint64 TrimTargetPercent = 80;
+
+	struct FIndexHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 NumEntries;
+	};
+
+	struct FIndexEntry
+	{
+		FBlake3Hash::ByteArray InputHash;
+		FBlake3Hash::ByteArray OutputHash;
+		int64 LastUsedTime;
+		uint64 OutputSize;
+	};
+
+	static_assert(sizeof(FIndexHeader) == 16 && sizeof(FIndexEntry) == 80, "The index is read and written as is, its layout can't depend on padding.");
+
+	/** Reads a whole file, through a memory mapping where the platform supports it. */
+	static FSharedBuffer ReadFile(const FString& Path)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		if (TUniquePtr<IMappedFileHandle> MappedFile = TUniquePtr<IMappedFileHandle>(PlatformFile.OpenMapped(*Path)))
+		{
+			if (MappedFile->GetFileSize() == 0)
+			{
+				return FSharedBuffer();
+			}
+			if (TUniquePtr<IMappedFileRegion> MappedRegion = TUniquePtr<IMappedFileRegion>(MappedFile->MapRegion()))
+			{
+				// Copy out of the mapping rather than keeping it alive with the buffer, cached outputs can live for a long
+				// time and there may be many thousands of them
+				return FSharedBuffer::Clone(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize());
+			}
+		}
+
+		TArray64<uint8> Data;
+		if (FFileHelper::LoadFileToArray(Data, *Path, FILEREAD_Silent) && Data.Num() > 0)
+		{
+			return MakeSharedBufferFromArray(MoveTemp(Data));
+		}
+		return FSharedBuffer();
+	}
+
+	/** Writes to a temporary file first and moves it in place, so other processes never see partially written files. */
+	static bool WriteFile(const FString& Path, FMemoryView Data)
+	{
+		const FString TempPath = FString::Printf(TEXT("%s.%u.tmp"), *Path, FPlatformProcess::GetCurrentProcessId());
+		if (FFileHelper::SaveArrayToFile(TArrayView64<const uint8>(static_cast<const uint8*>(Data.GetData()), Data.GetSize()), *TempPath)
+			&& IFileManager::Get().Move(*Path, *TempPath, true, true, false, true))
+		{
+			return true;
+		}
+
+		IFileManager::Get().Delete(*TempPath, false, true, true);
+		return false;
+	}
+}
+
+FShaderJobDiskCache::FShaderJobDiskCache(const FString& InCacheDirectory)
+	: CacheDirectory(InCacheDirectory)
+	, IndexPath(InCacheDirectory / TEXT("Index.bin"))
+	, WritePipe(TEXT("ShaderJobDiskCache"))
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FShaderJobDiskCache::LoadIndex);
+
+	IndexLoadTime = FDateTime::UtcNow().GetTicks();
+	if (LoadIndex(Entries, Outputs, 0))
+	{
+		for (const TPair<FBlake3Hash, FOutputInfo>& Output : Outputs)
+		{
+			TotalOutputSize += Output.Value.Size;
+		}
+
+		UE_LOG(LogShaderCompilers, Display, TEXT("Loaded %d shader job outputs for %d input hashes (%.1f MB) from '%s'."),
+			Outputs.Num(), Entries.Num(), static_cast<double>(TotalOutputSize) / (1024.0 * 1024.0), *CacheDirectory);
+	}
+}
+
+FShaderJobDiskCache::~FShaderJobDiskCache()
+{
+	Flush();
+}
+
+bool FShaderJobDiskCache::IsEnabled()
+{
+	return GShaderCompilerJobCacheDisk;
+}
+
+FString FShaderJobDiskCache::GetOutputPath(const FBlake3Hash& OutputHash) const
+{
+	const FString HashString = LexToString(OutputHash);
+	return CacheDirectory / TEXT("Outputs") / HashString.Left(2) / HashString + TEXT(".bin");
+}
+
+bool FShaderJobDiskCache::LoadIndex(TMap<FBlake3Hash, FEntry>& OutEntries, TMap<FBlake3Hash, FOutputInfo>& OutOutputs, int64 MinLastUsedTime) const
+{
+	using namespace ShaderJobDiskCache;
+
+	const FSharedBuffer IndexData = ReadFile(IndexPath);
+	if (IndexData.GetSize() < sizeof(FIndexHeader))
+	{
+		return false;
+	}
+
+	const FIndexHeader& Header = *static_cast<const FIndexHeader*>(IndexData.GetData());
+	if (Header.Magic != IndexMagic || Header.Version != IndexVersion || IndexData.GetSize() != sizeof(FIndexHeader) + Header.NumEntries * sizeof(FIndexEntry))
+	{
+		UE_LOG(LogShaderCompilers, Display, TEXT("Discarding shader job disk cache index '%s', it is outdated or corrupted."), *IndexPath);
+		return false;
+	}
+
+	const FIndexEntry* IndexEntries = reinterpret_cast<const FIndexEntry*>(static_cast<const uint8*>(IndexData.GetData()) + sizeof(FIndexHeader));
+	OutEntries.Reserve(OutEntries.Num() + static_cast<int32>(Header.NumEntries));
+	for (uint64 EntryIndex = 0; EntryIndex < Header.NumEntries; ++EntryIndex)
+	{
+		const FIndexEntry& IndexEntry = IndexEntries[EntryIndex];
+		if (IndexEntry.LastUsedTime < MinLastUsedTime)
+		{
+			continue;
+		}
+
+		const FBlake3Hash InputHash(IndexEntry.InputHash);
+		if (OutEntries.Contains(InputHash))
+		{
+			continue;
+		}
+
+		FEntry& Entry = OutEntries.Add(InputHash);
+		Entry.OutputHash = FBlake3Hash(IndexEntry.OutputHash);
+		Entry.LastUsedTime = IndexEntry.LastUsedTime;
+
+		FOutputInfo& OutputInfo = OutOutputs.FindOrAdd(Entry.OutputHash);
+		OutputInfo.Size = IndexEntry.OutputSize;
+		++OutputInfo.NumReferences;
+	}
+
+	return true;
+}
+
+void FShaderJobDiskCache::SaveIndexLocked()
+{
+	using namespace ShaderJobDiskCache;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FShaderJobDiskCache::SaveIndex);
+
+	// Other processes sharing the directory (cook workers, other editors) may have saved entries since we loaded the index
+	TMap<FBlake3Hash, FEntry> SavedEntries;
+	TMap<FBlake3Hash, FOutputInfo> SavedOutputs;
+	if (LoadIndex(SavedEntries, SavedOutputs, IndexLoadTime))
+	{
+		for (const TPair<FBlake3Hash, FEntry>& SavedEntry : SavedEntries)
+		{
+			if (!Entries.Contains(SavedEntry.Key))
+			{
+				AddEntryLocked(SavedEntry.Key, SavedEntry.Value.OutputHash, SavedOutputs[SavedEntry.Value.OutputHash].Size, SavedEntry.Value.LastUsedTime);
+			}
+		}
+	}
+
+	TrimToBudgetLocked();
+
+	TArray64<uint8> IndexData;
+	IndexData.SetNumUninitialized(sizeof(FIndexHeader) + Entries.Num() * sizeof(FIndexEntry));
+
+	FIndexHeader& Header = *reinterpret_cast<FIndexHeader*>(IndexData.GetData());
+	Header.Magic = IndexMagic;
+	Header.Version = IndexVersion;
+	Header.NumEntries = Entries.Num();
+
+	FIndexEntry* IndexEntry = reinterpret_cast<FIndexEntry*>(IndexData.GetData() + sizeof(FIndexHeader));
+	for (const TPair<FBlake3Hash, FEntry>& Entry : Entries)
+	{
+		FMemory::Memcpy(IndexEntry->InputHash, Entry.Key.GetBytes(), sizeof(FBlake3Hash::ByteArray));
+		FMemory::Memcpy(IndexEntry->OutputHash, Entry.Value.OutputHash.GetBytes(), sizeof(FBlake3Hash::ByteArray));
+		IndexEntry->LastUsedTime = Entry.Value.LastUsedTime;
+		IndexEntry->OutputSize = Outputs[Entry.Value.OutputHash].Size;
+		++IndexEntry;
+	}
+
+	const int64 SaveTime = FDateTime::UtcNow().GetTicks();
+	if (!WriteFile(IndexPath, MakeMemoryView(IndexData)))
+	{
+		UE_LOG(LogShaderCompilers, Warning, TEXT("Could not write the shader job disk cache index '%s'."), *IndexPath);
+		return;
+	}
+
+	// Everything used before now is in memory already, only merge what other processes save from here on.
+	// Re-reading our own entries would bring back the ones trimmed since, whose outputs were deleted.
+	IndexLoadTime = SaveTime;
+	NumUnsavedChanges = 0;
+}
+
+void FShaderJobDiskCache::AddEntryLocked(const FBlake3Hash& InputHash, const FBlake3Hash& OutputHash, uint64 OutputSize, int64 LastUsedTime)
+{
+	FEntry& Entry = Entries.Add(InputHash);
+	Entry.OutputHash = OutputHash;
+	Entry.LastUsedTime = LastUsedTime;
+
+	FOutputInfo& OutputInfo = Outputs.FindOrAdd(OutputHash);
+	if (OutputInfo.NumReferences++ == 0)
+	{
+		OutputInfo.Size = OutputSize;
+		TotalOutputSize += OutputSize;
+	}
+}
+
+void FShaderJobDiskCache::RemoveEntryLocked(const FBlake3Hash& InputHash)
+{
+	FEntry Entry;
+	if (!Entries.RemoveAndCopyValue(InputHash, Entry))
+	{
+		return;
+	}
+
+	FOutputInfo& OutputInfo = Outputs.FindChecked(Entry.OutputHash);
+	if (--OutputInfo.NumReferences == 0)
+	{
+		TotalOutputSize -= OutputInfo.Size;
+		Outputs.Remove(Entry.OutputHash);
+		IFileManager::Get().Delete(*GetOutputPath(Entry.OutputHash), false, true, true);
+	}
+}
+
+void FShaderJobDiskCache::TrimToBudgetLocked()
+{
+	const uint64 Budget = GetBudget();
+	if (Budget == 0 || TotalOutputSize <= Budget)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FShaderJobDiskCache::Trim);
+
+	const uint64 SizeBefore = TotalOutputSize;
+	const uint64 TargetSize = Budget * ShaderJobDiskCache::TrimTargetPercent / 100;
+
+	TArray<TPair<int64, FBlake3Hash>> EntriesByLastUse;
+	EntriesByLastUse.Reserve(Entries.Num());
+	for (const TPair<FBlake3Hash, FEntry>& Entry : Entries)
+	{
+		EntriesByLastUse.Emplace(Entry.Value.LastUsedTime, Entry.Key);
+	}
+	EntriesByLastUse.Sort([](const TPair<int64, FBlake3Hash>& A, const TPair<int64, FBlake3Hash>& B) { return A.Key < B.Key; });
+
+	for (int32 Index = 0; Index < EntriesByLastUse.Num() && TotalOutputSize > TargetSize; ++Index)
+	{
+		RemoveEntryLocked(EntriesByLastUse[Index].Value);
+	}
+
+	UE_LOG(LogShaderCompilers, Display, TEXT("Shader job disk cache over budget, reduced from %.1lf to %.1lf MB."),
+		static_cast<double>(SizeBefore) / (1024.0 * 1024.0), static_cast<double>(TotalOutputSize) / (1024.0 * 1024.0));
+}
+
+FSharedBuffer FShaderJobDiskCache::Find(const FBlake3Hash& InputHash, FBlake3Hash& OutOutputHash)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FShaderJobDiskCache::Find);
+
+	FBlake3Hash OutputHash;
+	{
+		FScopeLock Lock(&IndexLock);
+		++NumQueries;
+
+		const FEntry* Entry = Entries.Find(InputHash);
+		if (Entry == nullptr)
+		{
+			return FSharedBuffer();
+		}
+		OutputHash = Entry->OutputHash;
+	}
+
+	// Outputs are validated against their hash, files can get truncated or modified outside of our control
+	FSharedBuffer Output = ShaderJobDiskCache::ReadFile(GetOutputPath(OutputHash));
+	const bool bValid = !Output.IsNull() && FBlake3::HashBuffer(Output.GetData(), Output.GetSize()) == OutputHash;
+
+	FScopeLock Lock(&IndexLock);
+	FEntry* Entry = Entries.Find(InputHash);
+	if (!bValid)
+	{
+		UE_LOG(LogShaderCompilers, Verbose, TEXT("Shader job disk cache output %s for ihash %s is missing or corrupted, discarding it."), *LexToString(OutputHash), *LexToString(InputHash));
+		if (Entry && Entry->OutputHash == OutputHash)
+		{
+			RemoveEntryLocked(InputHash);
+			++NumUnsavedChanges;
+		}
+		return FSharedBuffer();
+	}
+
+	if (Entry)
+	{
+		Entry->LastUsedTime = FDateTime::UtcNow().GetTicks();
+		++NumUnsavedChanges;
+	}
+	++NumHits;
+
+	OutOutputHash = OutputHash;
+	return Output;
+}
+
+void FShaderJobDiskCache::Add(const FBlake3Hash& InputHash, const FBlake3Hash& OutputHash, const FSharedBuffer& Output)
+{
+	{
+		FScopeLock Lock(&IndexLock);
+		const FEntry* Entry = Entries.Find(InputHash);
+		if (Entry && Entry->OutputHash == OutputHash)
+		{
+			return;
+		}
+	}
+
+	WritePipe.Launch(TEXT("ShaderJobDiskCache.Write"), [this, InputHash, OutputHash, Output]()
+	{
+		WriteOutput(InputHash, OutputHash, Output);
+	});
+}
+
+void FShaderJobDiskCache::WriteOutput(const FBlake3Hash& InputHash, const FBlake3Hash& OutputHash, const FSharedBuffer& Output)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FShaderJobDiskCache::WriteOutput);
+
+	bool bOutputStored;
+	{
+		FScopeLock Lock(&IndexLock);
+		bOutputStored = Outputs.Contains(OutputHash);
+	}
+
+	// Many inputs share the same output, and another process may have written it already
+	const FString OutputPath = GetOutputPath(OutputHash);
+	if (!bOutputStored && IFileManager::Get().FileSize(*OutputPath) != static_cast<int64>(Output.GetSize()))
+	{
+		if (!ShaderJobDiskCache::WriteFile(OutputPath, Output.GetView()))
+		{
+			UE_LOG(LogShaderCompilers, Verbose, TEXT("Could not write shader job disk cache output '%s'."), *OutputPath);
+			return;
+		}
+	}
+
+	FScopeLock Lock(&IndexLock);
+	if (const FEntry* Entry = Entries.Find(InputHash))
+	{
+		if (Entry->OutputHash == OutputHash)
+		{
+			return;
+		}
+		RemoveEntryLocked(InputHash);
+	}
+	AddEntryLocked(InputHash, OutputHash, Output.GetSize(), FDateTime::UtcNow().GetTicks());
+
+	TrimToBudgetLocked();
+
+	if (++NumUnsavedChanges >= ShaderJobDiskCache::SaveInterval)
+	{
+		SaveIndexLocked();
+	}
+}
+
+void FShaderJobDiskCache::Flush()
+{
+	WritePipe.WaitUntilEmpty();
+
+	FScopeLock Lock(&IndexLock);
+	if (NumUnsavedChanges > 0)
+	{
+		SaveIndexLocked();
+	}
+}
+
+uint64 FShaderJobDiskCache::GetNumQueries() const
+{
+	FScopeLock Lock(&IndexLock);
+	return NumQueries;
+}
+
+uint64 FShaderJobDiskCache::GetNumHits() const
+{
+	FScopeLock Lock(&IndexLock);
+	return NumHits;
+}
+
+uint64 FShaderJobDiskCache::GetSize() const
+{
+	FScopeLock Lock(&IndexLock);
+	return TotalOutputSize;
+}
+
+uint64 FShaderJobDiskCache::GetBudget() const
+{
+	return static_cast<uint64>(FMath::Max(GShaderCompilerJobCacheDiskMaxSizeMB, 0)) * 1024ULL * 1024ULL;
+}
+
+#endif // WITH_EDITOR
@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+
+#include "Hash/Blake3.h"
+#include "Memory/SharedBuffer.h"
+#include "Tasks/Pipe.h"
+
+/**
+ * Persistent on-disk tier of FShaderJobCache, so that job outputs survive editor restarts and repeat cooks.
+ *
+ * Outputs are content addressed, stored as one file per output hash. The index mapping job input hashes to output hashes
+ * is memory mapped and loaded on construction, and written back (merged with whatever other processes sharing the directory
+ * saved in the meantime) periodically and on destruction. Once the outputs exceed the size budget the least recently used
+ * entries are removed, along with any output no longer referenced by an entry.
+ *
+ * Find can be called from any thread, outputs are written on a background pipe so Add doesn't block on IO.
+ */
+class FShaderJobDiskCache
+{
+public:
+	explicit FShaderJobDiskCache(const FString& InCacheDirectory);
+	~FShaderJobDiskCache();
+
+	/** Whether r.ShaderCompiler.JobCache.Disk is enabled. */
+	static bool IsEnabled();
+
+	/** Reads the output stored for the given input hash. Returns a null buffer if there is none or it couldn't be read. */
+	FSharedBuffer Find(const FBlake3Hash& InputHash, FBlake3Hash& OutOutputHash);
+
+	/** Stores the output of a job. The output is written asynchronously and can be found once that's done. */
+	void Add(const FBlake3Hash& InputHash, const FBlake3Hash& OutputHash, const FSharedBuffer& Output);
+
+	/** Waits for pending writes and saves the index if it changed. */
+	void Flush();
+
+	uint64 GetNumQueries() const;
+	uint64 GetNumHits() const;
+
+	/** Total size of the outputs on disk and the budget they are trimmed to, in bytes. */
+	uint64 GetSize() const;
+	uint64 GetBudget() const;
+
+private:
+	struct FEntry
+	{
+		FBlake3Hash OutputHash;
+		int64 LastUsedTime = 0;
+	};
+
+	struct FOutputInfo
+	{
+		uint64 Size = 0;
+		int32 NumReferences = 0;
+	};
+
+	FString GetOutputPath(const FBlake3Hash& OutputHash) const;
+
+	/** Reads the index file into OutEntries and OutOutputs. Entries last used before MinLastUsedTime are skipped. */
+	bool LoadIndex(TMap<FBlake3Hash, FEntry>& OutEntries, TMap<FBlake3Hash, FOutputInfo>& OutOutputs, int64 MinLastUsedTime) const;
+
+	/** Merges in entries saved by other processes, trims to the budget and writes the index. Called with IndexLock held. */
+	void SaveIndexLocked();
+
+	/** Called with IndexLock held. */
+	void AddEntryLocked(const FBlake3Hash& InputHash, const FBlake3Hash& OutputHash, uint64 OutputSize, int64 LastUsedTime);
+	void RemoveEntryLocked(const FBlake3Hash& InputHash);
+	void TrimToBudgetLocked();
+
+	/** Writes the output file if needed and registers the entry, runs on WritePipe. */
+	void WriteOutput(const FBlake3Hash& InputHash, const FBlake3Hash& OutputHash, const FSharedBuffer& Output);
+
+	FString CacheDirectory;
+	FString IndexPath;
+
+	mutable FCriticalSection IndexLock;
+	TMap<FBlake3Hash, FEntry> Entries;
+	TMap<FBlake3Hash, FOutputInfo> Outputs;
+	uint64 TotalOutputSize = 0;
+
+	/** Time the index was last loaded or saved, entries saved by other processes after that are merged when saving. */
+	int64 IndexLoadTime = 0;
+
+	/** Entries added or used since the index was last saved. */
+	int32 NumUnsavedChanges = 0;
+
+	uint64 NumQueries = 0;
+	uint64 NumHits = 0;
+
+	UE::Tasks::FPipe WritePipe;
+};
+
+#endif // WITH_EDITOR
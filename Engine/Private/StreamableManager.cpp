@@ -336,6 +336,12 @@ TStreamableHandleContextDataTypeID FStreamableHandleContextDataBase::AllocateCla
 	return Result;
 }
 
+TStreamableHandleContextDataTypeIDStorage& FStreamableBatchLoadStats::TypeIdCrossModuleStorage()
+{
+	static TStreamableHandleContextDataTypeIDStorage Id;
+	return Id;
+}
+
 
 FStreamableHandle::FStreamableHandle()
 	: bLoadCompleted(false)
@@ -344,6 +350,7 @@ FStreamableHandle::FStreamableHandle()
 	, bStalled(false)
 	, bReleaseWhenLoaded(false)
 	, bIsCombinedHandle(false)
+	, bIsBatchLoad(false)
 	, Priority(0)
 	, StreamablesLoading(0)
 	, OwningManager(nullptr)
@@ -927,6 +934,27 @@ void FStreamableHandle::AsyncLoadCallbackWrapper(const FName& PackageName, UPack
 
 namespace UE::StreamableManager::Private
 {
+	void UpdateBatchLoadPercentiles(FStreamableBatchLoadStats& BatchStats)
+	{
+		if (BatchStats.Latencies.Num() == 0)
+		{
+			return;
+		}
+
+		TArray<float> SortedLatencies = BatchStats.Latencies;
+		SortedLatencies.Sort();
+
+		auto GetPercentile = [&SortedLatencies](float Fraction)
+		{
+			return SortedLatencies[FMath::Min(FMath::FloorToInt32(Fraction * SortedLatencies.Num()), SortedLatencies.Num() - 1)];
+		};
+
+		BatchStats.LatencyP50 = GetPercentile(0.5f);
+		BatchStats.LatencyP90 = GetPercentile(0.9f);
+		BatchStats.LatencyP99 = GetPercentile(0.99f);
+		BatchStats.LatencyMax = SortedLatencies.Last();
+	}
+
 	// Internal helper for executing delegates. This avoids code duplication by allowing the delegate to be moved or copied when deferred depending on which overload of ExecuteDelegate is called.
 	template<typename InStreamableDelegate>
 	void ExecuteDelegateInternal(InStreamableDelegate&& Delegate, TSharedPtr<FStreamableHandle> AssociatedHandle, InStreamableDelegate&& CancelDelegate)
@@ -1070,6 +1098,12 @@ struct FStreamable
 	/** If this object failed to load, don't try again */
 	bool bLoadFailed = false;
 
+	/** If handles that didn't make the outstanding request are waiting on it, see FStreamableManager::RequestAsyncLoadBatch */
+	bool bRequestJoined = false;
+
+	/** Handle the latest async load request was made for, its callback is bound to this handle */
+	TWeakPtr<FStreamableHandle> RequestHandle;
+
 
 	void FreeHandles()
 	{
@@ -1277,7 +1311,7 @@ FStreamable* FStreamableManager::FindStreamable(const FSoftObjectPath& Target) c
 	return Existing;
 }
 
-FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetName, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle)
+FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetName, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle, bool bJoinInFlightRequest)
 {
 	check(IsInGameThread());
 	UE_LOG(LogStreamableManager, Verbose, TEXT("Asynchronous load %s"), *InTargetName.ToString());
@@ -1343,44 +1377,63 @@ FStreamable* FStreamableManager::StreamInternal(const FSoftObjectPath& InTargetN
 			}
 			Existing->bAsyncLoadRequestOutstanding = false;
 		}
-		else
+		else if (bJoinInFlightRequest && Existing->bAsyncLoadRequestOutstanding
+			&& Existing->LoadingHandles.ContainsByPredicate([Existing](const TSharedRef<FStreamableHandle>& LoadingHandle) { return Existing->RequestHandle.HasSameObject(&LoadingHandle.Get()); }))
 		{
-			// We always queue a new request in case the existing one gets cancelled
-			FString Package = TargetName.ToString();
-			int32 FirstDot = Package.Find(TEXT("."), ESearchCase::CaseSensitive);
-			if (FirstDot != INDEX_NONE)
-			{
-				Package.LeftInline(FirstDot,EAllowShrinking::No);
-			}
+			// The handle that made the request in flight is still waiting on it, and its callback completes every handle waiting on this streamable.
+			// If it gets canceled first, RemoveReferencedAsset makes a new request for the handles left.
+			UE_LOG(LogStreamableManager, Verbose, TEXT("     Joining request in flight %s"), *TargetName.ToString());
+			Existing->bRequestJoined = true;
 
-			FPackagePath PackagePath;
-			if (!FPackagePath::TryFromPackageName(Package, PackagePath))
+			if (TSharedPtr<FStreamableBatchLoadStats> BatchStats = Handle->FindFirstContextDataOfType<FStreamableBatchLoadStats>())
 			{
-				UE_LOG(LogStreamableManager, Error, TEXT("Failed attempt to load %s; it is not a valid LongPackageName"), *Package);
-				Existing->bLoadFailed = true;
-				Existing->bAsyncLoadRequestOutstanding = false;
+				BatchStats->NumJoinedInFlight++;
 			}
-			else
-			{
-				Existing->bLoadFailed = false;
-				Existing->bAsyncLoadRequestOutstanding = true;
+		}
+		else
+		{
+			// We always queue a new request in case the existing one gets cancelled
+			RequestAsyncLoadForStreamable(TargetName, Existing, Priority, Handle);
+		}
+	}
+	return Existing;
+}
+
+void FStreamableManager::RequestAsyncLoadForStreamable(const FSoftObjectPath& TargetName, FStreamable* Existing, TAsyncLoadPriority Priority, TSharedRef<FStreamableHandle> Handle)
+{
+	FString Package = TargetName.ToString();
+	int32 FirstDot = Package.Find(TEXT("."), ESearchCase::CaseSensitive);
+	if (FirstDot != INDEX_NONE)
+	{
+		Package.LeftInline(FirstDot,EAllowShrinking::No);
+	}
+
+	FPackagePath PackagePath;
+	if (!FPackagePath::TryFromPackageName(Package, PackagePath))
+	{
+		UE_LOG(LogStreamableManager, Error, TEXT("Failed attempt to load %s; it is not a valid LongPackageName"), *Package);
+		Existing->bLoadFailed = true;
+		Existing->bAsyncLoadRequestOutstanding = false;
+	}
+	else
+	{
+		Existing->bLoadFailed = false;
+		Existing->bAsyncLoadRequestOutstanding = true;
+		Existing->RequestHandle = Handle;
 #if UE_WITH_PACKAGE_ACCESS_TRACKING
-				UE_TRACK_REFERENCING_PACKAGE_SCOPED(Handle->GetReferencerPackage(), Handle->GetRefencerPackageOp());
+		UE_TRACK_REFERENCING_PACKAGE_SCOPED(Handle->GetReferencerPackage(), Handle->GetRefencerPackageOp());
 #endif
 #if WITH_EDITOR
-				FCookLoadScope CookLoadScope(Handle->GetCookLoadType());
+		FCookLoadScope CookLoadScope(Handle->GetCookLoadType());
 #endif
-				// This may overwrite an existing request id, this is intentional - see comment above re: cancellation
-				Existing->RequestId = LoadPackageAsync(PackagePath,
-					NAME_None /* PackageNameToCreate */,
-					FLoadPackageAsyncDelegate::CreateSP(Handle, &FStreamableHandle::AsyncLoadCallbackWrapper, TargetName),
-					PKG_None /* InPackageFlags */,
-					INDEX_NONE /* InPIEInstanceID */,
-					Priority /* InPackagePriority */);
-			}
-		}
+		// This may overwrite an existing request id, this is intentional - see comment in StreamInternal re: cancellation
+		Existing->RequestId = LoadPackageAsync(PackagePath,
+			NAME_None /* PackageNameToCreate */,
+			FLoadPackageAsyncDelegate::CreateSP(Handle, &FStreamableHandle::AsyncLoadCallbackWrapper, TargetName),
+			PKG_None /* InPackageFlags */,
+			INDEX_NONE /* InPIEInstanceID */,
+			Priority /* InPackagePriority */);
 	}
-	return Existing;
 }
 
 TSharedPtr<FStreamableHandle> FStreamableManager::RequestAsyncLoad(TArray<FSoftObjectPath> TargetsToStream, FStreamableDelegate DelegateToCall, TAsyncLoadPriority Priority, bool bManageActiveHandle, bool bStartStalled, FString DebugName)
@@ -1513,6 +1566,28 @@ TSharedPtr<FStreamableHandle> FStreamableManager::RequestAsyncLoad(const FSoftOb
 	return RequestAsyncLoad(TargetToStream, FStreamableDelegate::CreateLambda( MoveTemp( Callback ) ), Priority, bManageActiveHandle, bStartStalled, MoveTemp(DebugName));
 }
 
+TSharedPtr<FStreamableHandle> FStreamableManager::RequestAsyncLoadBatch(TArray<FSoftObjectPath> TargetsToStream, FStreamableDelegate DelegateToCall, TAsyncLoadPriority Priority, bool bManageActiveHandle, FString DebugName)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FStreamableManager::RequestAsyncLoadBatch);
+
+	// Validates and deduplicates the targets, the handle starts stalled so the stats can be added before any target completes
+	TSharedPtr<FStreamableHandle> NewRequest = RequestAsyncLoad(MoveTemp(TargetsToStream), MoveTemp(DelegateToCall), Priority, bManageActiveHandle, true, MoveTemp(DebugName));
+	if (NewRequest.IsValid())
+	{
+		TSharedPtr<FStreamableBatchLoadStats> BatchStats = MakeShared<FStreamableBatchLoadStats>();
+		BatchStats->NumTargets = NewRequest->RequestedAssets.Num();
+		BatchStats->RequestTime = FPlatformTime::Seconds();
+		BatchStats->Latencies.Reserve(BatchStats->NumTargets);
+		NewRequest->AddContextData(BatchStats);
+		NewRequest->bIsBatchLoad = true;
+
+		NewRequest->bStalled = false;
+		StartHandleRequests(NewRequest.ToSharedRef(), true);
+	}
+
+	return NewRequest;
+}
+
 TSharedPtr<FStreamableHandle> FStreamableManager::RequestSyncLoad(TArray<FSoftObjectPath> TargetsToStream, bool bManageActiveHandle, FString DebugName)
 {
 	// If in async loading thread or from callback always do sync as recursive tick is unsafe
@@ -1541,18 +1616,25 @@ TSharedPtr<FStreamableHandle> FStreamableManager::RequestSyncLoad(const FSoftObj
 	return RequestSyncLoad(TArray<FSoftObjectPath>{TargetToStream}, bManageActiveHandle, MoveTemp(DebugName));
 }
 
-void FStreamableManager::StartHandleRequests(TSharedRef<FStreamableHandle> Handle)
+void FStreamableManager::StartHandleRequests(TSharedRef<FStreamableHandle> Handle, bool bJoinInFlightRequests)
 {
 	TRACE_LOADTIME_REQUEST_GROUP_SCOPE(TEXT("StreamableManager - %s"), *Handle->GetDebugName());
 
 	TArray<FStreamable *> ExistingStreamables;
 	ExistingStreamables.Reserve(Handle->RequestedAssets.Num());
 
+	TSharedPtr<FStreamableBatchLoadStats> BatchStats = bJoinInFlightRequests ? Handle->FindFirstContextDataOfType<FStreamableBatchLoadStats>() : nullptr;
+
 	for (int32 i = 0; i < Handle->RequestedAssets.Num(); i++)
 	{
-		FStreamable* Existing = StreamInternal(Handle->RequestedAssets[i], Handle->Priority, Handle);
+		FStreamable* Existing = StreamInternal(Handle->RequestedAssets[i], Handle->Priority, Handle, bJoinInFlightRequests);
 		check(Existing);
 
+		if (BatchStats.IsValid() && Existing->Target)
+		{
+			BatchStats->NumAlreadyLoaded++;
+		}
+
 		ExistingStreamables.Add(Existing);
 		Existing->AddLoadingRequest(Handle);
 	}
@@ -1687,6 +1769,7 @@ void FStreamableManager::AsyncLoadCallback(FSoftObjectPath TargetName, UPackage*
 		if (Existing->bAsyncLoadRequestOutstanding)
 		{
 			Existing->bAsyncLoadRequestOutstanding = false;
+			Existing->bRequestJoined = false;
 			if (!Existing->Target)
 			{
 				FindInMemory(TargetName, Existing, Package);
@@ -1727,14 +1810,30 @@ void FStreamableManager::CheckCompletedRequests(const FSoftObjectPath& Target, s
 	TArray<TSharedRef<FStreamableHandle>> HandlesToComplete;
 	TArray<TSharedRef<FStreamableHandle>> HandlesToRelease;
 
+	const double CurrentTime = FPlatformTime::Seconds();
+
 	for (TSharedRef<FStreamableHandle>& Handle : Existing->LoadingHandles)
 	{
 		ensure(Handle->WasCanceled() || Handle->OwningManager == this);
 
+		TSharedPtr<FStreamableBatchLoadStats> BatchStats = Handle->bIsBatchLoad ? Handle->FindFirstContextDataOfType<FStreamableBatchLoadStats>() : nullptr;
+		if (BatchStats.IsValid())
+		{
+			BatchStats->Latencies.Add(static_cast<float>(CurrentTime - BatchStats->RequestTime));
+		}
+
 		// Decrement related requests, and call delegate if all are done and request is still active
 		Handle->StreamablesLoading--;
 		if (Handle->StreamablesLoading == 0)
 		{
+			if (BatchStats.IsValid())
+			{
+				UE::StreamableManager::Private::UpdateBatchLoadPercentiles(*BatchStats);
+				UE_LOG(LogStreamableManager, Verbose, TEXT("Batch %s loaded %d targets (%d already loaded, %d joined in flight), latency p50 %.3fs p90 %.3fs p99 %.3fs max %.3fs"),
+					*Handle->GetDebugName(), BatchStats->NumTargets, BatchStats->NumAlreadyLoaded, BatchStats->NumJoinedInFlight,
+					BatchStats->LatencyP50, BatchStats->LatencyP90, BatchStats->LatencyP99, BatchStats->LatencyMax);
+			}
+
 			if (Handle->bReleaseWhenLoaded)
 			{
 				HandlesToRelease.Add(Handle);
@@ -1788,6 +1887,12 @@ void FStreamableManager::RemoveReferencedAsset(const FSoftObjectPath& Target, TS
 				// All requests cancelled, remove loading flag
 				Existing->bAsyncLoadRequestOutstanding = false;
 			}
+			else if (Existing->bAsyncLoadRequestOutstanding && Existing->bRequestJoined && Existing->RequestHandle.HasSameObject(&Handle.Get()))
+			{
+				// Handles that joined this handle's request won't be called back by it any more, make a new request for them
+				TSharedRef<FStreamableHandle> NewRequestHandle = Existing->LoadingHandles[0];
+				RequestAsyncLoadForStreamable(Target, Existing, NewRequestHandle->GetPriority(), NewRequestHandle);
+			}
 		}
 	}
 }
@@ -8,6 +8,68 @@ AsyncTextureStreaming.cpp: Definitions of classes used for texture streaming asy
 #include "RHI.h"
 #include "Streaming/StreamingManagerTexture.h"
 #include "Engine/Level.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+
+static int32 GParallelRenderAssetMipCalculation = 1;
+static FAutoConsoleVariableRef CVarStreamingParallelMipCalculation(
+	TEXT("r.Streaming.ParallelMipCalculation"),
+	GParallelRenderAssetMipCalculation,
+	TEXT("Whether the streaming async task uses a ParallelFor to compute the wanted mips, the budget and the load requests of the render assets."),
+	ECVF_Default);
+
+namespace AsyncRenderAssetStreamingPrivate
+{
+	/** Below this many assets per packet, the ParallelFor overhead isn't worth it. */
+	constexpr int32 MinAssetsPerPacket = 1024;
+
+	/** An asset can't take part in more rounds of TryDropMips than its number of missing mips plus its number of mips, each stored in an int8. */
+	constexpr int32 MaxDropMipsRounds = 256;
+
+	static int32 GetNumPackets(int32 NumAssets, bool bAllowParallel = true)
+	{
+		if (!bAllowParallel || !GParallelRenderAssetMipCalculation || NumAssets < 2 * MinAssetsPerPacket)
+		{
+			return 1;
+		}
+		const int32 MaxNumPackets = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads()) * 2;
+		return FMath::Clamp(NumAssets / MinAssetsPerPacket, 1, MaxNumPackets);
+	}
+
+	/** Calls Body(PacketIndex, StartIndex, EndIndex) for NumPackets contiguous ranges covering [0, NumAssets), in order when there is a single packet. */
+	template <typename BodyType>
+	static void ForEachPacket(int32 NumAssets, int32 NumPackets, BodyType&& Body)
+	{
+		ParallelFor(TEXT("RenderAssetStreamingMipCalc"), NumPackets, 1, [NumAssets, NumPackets, &Body](int32 PacketIndex)
+		{
+			const int32 StartIndex = (int32)((int64)NumAssets * PacketIndex / NumPackets);
+			const int32 EndIndex = (int32)((int64)NumAssets * (PacketIndex + 1) / NumPackets);
+			Body(PacketIndex, StartIndex, EndIndex);
+		}, NumPackets > 1 ? EParallelForFlags::BackgroundPriority : EParallelForFlags::ForceSingleThread);
+	}
+
+	/** Memory freed by an asset in the given round of TryDropMips. The first rounds only consume its missing mips. */
+	FORCEINLINE int64 GetDropMipsRoundMemDelta(const FStreamingRenderAsset& StreamingRenderAsset, int32 NumMissingMips, int32 BudgetedMips, int32 Round)
+	{
+		if (Round < NumMissingMips || !StreamingRenderAsset.RenderAsset)
+		{
+			return 0;
+		}
+		const int32 NumMips = BudgetedMips - (Round - NumMissingMips);
+		return StreamingRenderAsset.GetSize(NumMips) - StreamingRenderAsset.GetSize(NumMips - 1);
+	}
+
+	/** Maps a float to an unsigned integer with the same ordering. */
+	FORCEINLINE uint32 GetOrderedFloatBits(float Value)
+	{
+		// Fold -0 into 0, as they compare equal.
+		const float NormalizedValue = Value == 0.f ? 0.f : Value;
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &NormalizedValue, sizeof(Bits));
+		return (Bits & 0x80000000u) ? ~Bits : (Bits | 0x80000000u);
+	}
+}
 
 void FAsyncRenderAssetStreamingData::Init(
 	TArray<FStreamingViewInfo> InViewInfos,
@@ -511,6 +573,212 @@ void FRenderAssetStreamingMipCalcTask::TryKeepMips(TArray<int32>& PrioritizedRen
 	}
 }
 
+void FRenderAssetStreamingMipCalcTask::TryDropMipsInRounds(TArray<int32>& PrioritizedRenderAssets, int64& MemoryBudgeted, const int64 InMemoryBudget)
+{
+	using namespace AsyncRenderAssetStreamingPrivate;
+
+	TArray<FStreamingRenderAsset>& StreamingRenderAssets = StreamingManager.AsyncUnsafeStreamingRenderAssets;
+	const int32 NumCandidates = PrioritizedRenderAssets.Num();
+	if (MemoryBudgeted <= InMemoryBudget || !NumCandidates || IsAborted())
+	{
+		return;
+	}
+
+	// TryDropMips goes through the assets in rounds, from the lowest priority up, where each asset either consumes one of its missing mips or drops one mip.
+	// Without the mesh retention heuristic, what an asset frees in a round doesn't depend on the other assets, so we can sum up the memory freed by every round,
+	// find the round where the budget is met and the asset where it is met within that round, then apply the drops of all assets at once.
+	FDropMipsCandidates& Candidates = DropMipsCandidates;
+	Candidates.SetNum(NumCandidates);
+
+	const int32 NumPackets = GetNumPackets(NumCandidates);
+	TArray<TArray<int64, TInlineAllocator<32>>, TInlineAllocator<64>> PacketRoundsMemDelta;
+	PacketRoundsMemDelta.SetNum(NumPackets);
+
+	ForEachPacket(NumCandidates, NumPackets, [&](int32 PacketIndex, int32 StartIndex, int32 EndIndex)
+	{
+		TArray<int64, TInlineAllocator<32>>& RoundsMemDelta = PacketRoundsMemDelta[PacketIndex];
+		for (int32 PriorityIndex = StartIndex; PriorityIndex < EndIndex && !IsAborted(); ++PriorityIndex)
+		{
+			const int32 AssetIndex = PrioritizedRenderAssets[PriorityIndex];
+			Candidates.NumRounds[PriorityIndex] = 0;
+			if (AssetIndex == INDEX_NONE) continue;
+
+			const FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
+			const int32 MinAllowedMips = FMath::Max(StreamingRenderAsset.MinAllowedMips, StreamingRenderAsset.NumForcedMips);
+			const int32 NumMissingMips = FMath::Max<int32>(StreamingRenderAsset.NumMissingMips, 0);
+			const int32 BudgetedMips = StreamingRenderAsset.BudgetedMips;
+			if (BudgetedMips <= MinAllowedMips) continue;
+
+			const int32 NumRounds = NumMissingMips + BudgetedMips - MinAllowedMips;
+			check(NumRounds <= MaxDropMipsRounds);
+			Candidates.NumMissingMips[PriorityIndex] = (int8)NumMissingMips;
+			Candidates.BudgetedMips[PriorityIndex] = (int8)BudgetedMips;
+			Candidates.NumRounds[PriorityIndex] = (int16)NumRounds;
+
+			if (RoundsMemDelta.Num() < NumRounds)
+			{
+				RoundsMemDelta.SetNumZeroed(NumRounds);
+			}
+			for (int32 Round = NumMissingMips; Round < NumRounds; ++Round)
+			{
+				RoundsMemDelta[Round] += GetDropMipsRoundMemDelta(StreamingRenderAsset, NumMissingMips, BudgetedMips, Round);
+			}
+		}
+	});
+
+	if (IsAborted())
+	{
+		return;
+	}
+
+	TArray<int64, TInlineAllocator<32>> RoundsMemDelta;
+	for (const TArray<int64, TInlineAllocator<32>>& PacketRounds : PacketRoundsMemDelta)
+	{
+		if (RoundsMemDelta.Num() < PacketRounds.Num())
+		{
+			RoundsMemDelta.SetNumZeroed(PacketRounds.Num());
+		}
+		for (int32 Round = 0; Round < PacketRounds.Num(); ++Round)
+		{
+			RoundsMemDelta[Round] += PacketRounds[Round];
+		}
+	}
+
+	// Find the number of complete rounds, and whether the budget is met within the next one.
+	const int64 MemoryToFree = MemoryBudgeted - InMemoryBudget;
+	int64 MemoryFreed = 0;
+	int32 NumCompleteRounds = RoundsMemDelta.Num();
+	int32 LastRound = INDEX_NONE;
+	for (int32 Round = 0; Round < RoundsMemDelta.Num(); ++Round)
+	{
+		if (MemoryFreed + RoundsMemDelta[Round] >= MemoryToFree)
+		{
+			NumCompleteRounds = Round;
+			LastRound = Round;
+			break;
+		}
+
+		MemoryFreed += RoundsMemDelta[Round];
+
+		// TryDropMips stops after a round that didn't free anything.
+		if (RoundsMemDelta[Round] == 0)
+		{
+			NumCompleteRounds = Round + 1;
+			break;
+		}
+	}
+
+	// In the last round, only the lowest priority assets drop, until the budget is met.
+	int32 LastRoundFirstPriorityIndex = NumCandidates;
+	if (LastRound != INDEX_NONE)
+	{
+		TArray<int64, TInlineAllocator<64>> PacketLastRoundMemDelta;
+		PacketLastRoundMemDelta.SetNumZeroed(NumPackets);
+		ForEachPacket(NumCandidates, NumPackets, [&](int32 PacketIndex, int32 StartIndex, int32 EndIndex)
+		{
+			int64 MemDelta = 0;
+			for (int32 PriorityIndex = StartIndex; PriorityIndex < EndIndex; ++PriorityIndex)
+			{
+				if (LastRound < Candidates.NumRounds[PriorityIndex])
+				{
+					MemDelta += GetDropMipsRoundMemDelta(StreamingRenderAssets[PrioritizedRenderAssets[PriorityIndex]], Candidates.NumMissingMips[PriorityIndex], Candidates.BudgetedMips[PriorityIndex], LastRound);
+				}
+			}
+			PacketLastRoundMemDelta[PacketIndex] = MemDelta;
+		});
+
+		int64 MemoryLeftToFree = MemoryToFree - MemoryFreed;
+		for (int32 PacketIndex = NumPackets - 1; PacketIndex >= 0 && LastRoundFirstPriorityIndex == NumCandidates; --PacketIndex)
+		{
+			if (MemoryLeftToFree > PacketLastRoundMemDelta[PacketIndex])
+			{
+				MemoryLeftToFree -= PacketLastRoundMemDelta[PacketIndex];
+				continue;
+			}
+
+			const int32 StartIndex = (int32)((int64)NumCandidates * PacketIndex / NumPackets);
+			const int32 EndIndex = (int32)((int64)NumCandidates * (PacketIndex + 1) / NumPackets);
+			LastRoundFirstPriorityIndex = StartIndex;
+			for (int32 PriorityIndex = EndIndex - 1; PriorityIndex >= StartIndex; --PriorityIndex)
+			{
+				if (MemoryLeftToFree <= 0)
+				{
+					LastRoundFirstPriorityIndex = PriorityIndex + 1;
+					break;
+				}
+				if (LastRound < Candidates.NumRounds[PriorityIndex])
+				{
+					MemoryLeftToFree -= GetDropMipsRoundMemDelta(StreamingRenderAssets[PrioritizedRenderAssets[PriorityIndex]], Candidates.NumMissingMips[PriorityIndex], Candidates.BudgetedMips[PriorityIndex], LastRound);
+				}
+			}
+		}
+	}
+
+	TArray<int64, TInlineAllocator<64>> PacketMemoryFreed;
+	PacketMemoryFreed.SetNumZeroed(NumPackets);
+	ForEachPacket(NumCandidates, NumPackets, [&](int32 PacketIndex, int32 StartIndex, int32 EndIndex)
+	{
+		int64 MemDelta = 0;
+		for (int32 PriorityIndex = StartIndex; PriorityIndex < EndIndex; ++PriorityIndex)
+		{
+			const int32 NumRounds = FMath::Min<int32>(Candidates.NumRounds[PriorityIndex], NumCompleteRounds + (PriorityIndex >= LastRoundFirstPriorityIndex ? 1 : 0));
+			if (NumRounds <= 0) continue;
+
+			FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[PrioritizedRenderAssets[PriorityIndex]];
+			const int32 NumMissingMipsUsed = FMath::Min<int32>(NumRounds, Candidates.NumMissingMips[PriorityIndex]);
+			StreamingRenderAsset.NumMissingMips -= (int8)NumMissingMipsUsed;
+			for (int32 DropIndex = NumMissingMipsUsed; DropIndex < NumRounds; ++DropIndex)
+			{
+				MemDelta += StreamingRenderAsset.DropOneMip_Async();
+			}
+
+			if (NumRounds == Candidates.NumRounds[PriorityIndex])
+			{
+				// Don't try this one again.
+				PrioritizedRenderAssets[PriorityIndex] = INDEX_NONE;
+			}
+		}
+		PacketMemoryFreed[PacketIndex] = MemDelta;
+	});
+
+	for (int64 MemDelta : PacketMemoryFreed)
+	{
+		MemoryBudgeted -= MemDelta;
+	}
+}
+
+void FRenderAssetStreamingMipCalcTask::SortByRetentionPriority(TArray<int32>& RenderAssetIndices)
+{
+	using namespace AsyncRenderAssetStreamingPrivate;
+
+	const TArray<FStreamingRenderAsset>& StreamingRenderAssets = StreamingManager.AsyncUnsafeStreamingRenderAssets;
+	const int32 Num = RenderAssetIndices.Num();
+
+	// Pack the retention priority and the normalized screen size in a single key so the sort doesn't touch the assets.
+	RetentionSortKeys.SetNumUninitialized(Num, EAllowShrinking::No);
+	ForEachPacket(Num, GetNumPackets(Num), [&](int32 PacketIndex, int32 StartIndex, int32 EndIndex)
+	{
+		for (int32 Index = StartIndex; Index < EndIndex; ++Index)
+		{
+			const int32 AssetIndex = RenderAssetIndices[Index];
+			const FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
+			RetentionSortKeys[Index].Key = ((uint64)(uint32)StreamingRenderAsset.RetentionPriority << 32) | GetOrderedFloatBits(StreamingRenderAsset.NormalizedScreenSize);
+			RetentionSortKeys[Index].AssetIndex = AssetIndex;
+		}
+	});
+
+	// Bigger retention priority first, see FCompareRenderAssetByRetentionPriority.
+	Algo::Sort(RetentionSortKeys, [](const FRetentionSortKey& A, const FRetentionSortKey& B)
+	{
+		return A.Key > B.Key || (A.Key == B.Key && A.AssetIndex > B.AssetIndex);
+	});
+
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		RenderAssetIndices[Index] = RetentionSortKeys[Index].AssetIndex;
+	}
+}
+
 void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async()
 {
 	//*************************************
@@ -531,24 +799,56 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async()
 	int64 MemoryUsedByNonTextures = 0;
 	int64 MemoryUsed = 0;
 
-	for (FStreamingRenderAsset& StreamingRenderAsset : StreamingRenderAssets)
 	{
-		if (IsAborted()) break;
+		struct FPacketTotals
+		{
+			int64 MemoryBudgeted = 0;
+			int64 MeshMemoryBudgeted = 0;
+			int64 MemoryUsedByNonTextures = 0;
+			int64 MemoryUsed = 0;
+			int32 NumAssets = 0;
+			int32 NumMeshes = 0;
+		};
+
+		const int32 NumPackets = AsyncRenderAssetStreamingPrivate::GetNumPackets(StreamingRenderAssets.Num());
+		TArray<FPacketTotals, TInlineAllocator<64>> PacketTotals;
+		PacketTotals.SetNum(NumPackets);
+
+		AsyncRenderAssetStreamingPrivate::ForEachPacket(StreamingRenderAssets.Num(), NumPackets, [&](int32 PacketIndex, int32 StartIndex, int32 EndIndex)
+		{
+			FPacketTotals Totals;
+			for (int32 AssetIndex = StartIndex; AssetIndex < EndIndex; ++AssetIndex)
+			{
+				if (IsAborted()) break;
 
-		const int64 AssetMemBudgeted = StreamingRenderAsset.UpdateRetentionPriority_Async(Settings.bPrioritizeMeshLODRetention);
-		const int32 AssetMemUsed = StreamingRenderAsset.GetSize(StreamingRenderAsset.ResidentMips);
-		MemoryUsed += AssetMemUsed;
+				FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
+				const int64 AssetMemBudgeted = StreamingRenderAsset.UpdateRetentionPriority_Async(Settings.bPrioritizeMeshLODRetention);
+				const int32 AssetMemUsed = StreamingRenderAsset.GetSize(StreamingRenderAsset.ResidentMips);
+				Totals.MemoryUsed += AssetMemUsed;
 
-		if (StreamingRenderAsset.IsTexture())
-		{
-			MemoryBudgeted += AssetMemBudgeted;
-			++NumAssets;
-		}
-		else
+				if (StreamingRenderAsset.IsTexture())
+				{
+					Totals.MemoryBudgeted += AssetMemBudgeted;
+					++Totals.NumAssets;
+				}
+				else
+				{
+					Totals.MeshMemoryBudgeted += AssetMemBudgeted;
+					Totals.MemoryUsedByNonTextures += AssetMemUsed;
+					++Totals.NumMeshes;
+				}
+			}
+			PacketTotals[PacketIndex] = Totals;
+		});
+
+		for (const FPacketTotals& Totals : PacketTotals)
 		{
-			MeshMemoryBudgeted += AssetMemBudgeted;
-			MemoryUsedByNonTextures += AssetMemUsed;
-			++NumMeshes;
+			MemoryBudgeted += Totals.MemoryBudgeted;
+			MeshMemoryBudgeted += Totals.MeshMemoryBudgeted;
+			MemoryUsedByNonTextures += Totals.MemoryUsedByNonTextures;
+			MemoryUsed += Totals.MemoryUsed;
+			NumAssets += Totals.NumAssets;
+			NumMeshes += Totals.NumMeshes;
 		}
 	}
 
@@ -686,8 +986,8 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async()
 		}
 
 		// Sort texture/mesh, having those that should be dropped first.
-		PrioritizedRenderAssets.Sort(FCompareRenderAssetByRetentionPriority(StreamingRenderAssets));
-		PrioritizedMeshes.Sort(FCompareRenderAssetByRetentionPriority(StreamingRenderAssets));
+		SortByRetentionPriority(PrioritizedRenderAssets);
+		SortByRetentionPriority(PrioritizedMeshes);
 
 
 		if (Settings.bUsePerTextureBias && AllowPerRenderAssetMipBiasChanges())
@@ -707,10 +1007,22 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async()
 		// Drop WantedMip until in budget.
 		//*************************************
 
-		TryDropMips(PrioritizedRenderAssets, MemoryBudgeted, MemoryBudget);
-		if (bUseSeparatePoolForMeshes)
+		// The mesh LOD retention heuristic makes each drop depend on the previous ones, which needs the sequential passes.
+		if (GParallelRenderAssetMipCalculation && !Settings.bPrioritizeMeshLODRetention)
 		{
-			TryDropMips(PrioritizedMeshes, MeshMemoryBudgeted, MeshMemoryBudget);
+			TryDropMipsInRounds(PrioritizedRenderAssets, MemoryBudgeted, MemoryBudget);
+			if (bUseSeparatePoolForMeshes)
+			{
+				TryDropMipsInRounds(PrioritizedMeshes, MeshMemoryBudgeted, MeshMemoryBudget);
+			}
+		}
+		else
+		{
+			TryDropMips(PrioritizedRenderAssets, MemoryBudgeted, MemoryBudget);
+			if (bUseSeparatePoolForMeshes)
+			{
+				TryDropMips(PrioritizedMeshes, MeshMemoryBudgeted, MeshMemoryBudget);
+			}
 		}
 	}
 
@@ -750,8 +1062,8 @@ void FRenderAssetStreamingMipCalcTask::UpdateBudgetedMips_Async()
 		}
 
 		// Sort texture/mesh, having those that should be dropped first.
-		PrioritizedRenderAssets.Sort(FCompareRenderAssetByRetentionPriority(StreamingRenderAssets));
-		PrioritizedMeshes.Sort(FCompareRenderAssetByRetentionPriority(StreamingRenderAssets));
+		SortByRetentionPriority(PrioritizedRenderAssets);
+		SortByRetentionPriority(PrioritizedMeshes);
 
 		TryKeepMips(PrioritizedRenderAssets, MemoryBudgeted, MemoryBudget);
 		if (bUseSeparatePoolForMeshes)
@@ -794,47 +1106,72 @@ void FRenderAssetStreamingMipCalcTask::UpdateLoadAndCancelationRequests_Async()
 	int64 StreamOutMemoryBudget = TempMemoryBudget;
 	int64 StreamInMemoryBudget = TempMemoryBudget;
 
-	TArray<int32> PrioritizedRenderAssets;
-	PrioritizedRenderAssets.Empty(StreamingRenderAssets.Num());
-	for (int32 AssetIndex = 0; AssetIndex < StreamingRenderAssets.Num() && !IsAborted(); ++AssetIndex)
+	struct FPacketRequests
 	{
-		FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
-		const bool bWasMissingTooManyMips = StreamingRenderAsset.IsMissingTooManyMips();
-
-		// If we need to change the number of resident mips.
-		if (StreamingRenderAsset.UpdateLoadOrderPriority_Async(Settings))
+		TArray<int32> PrioritizedRenderAssets;
+		TArray<int32> CancelationRequests;
+		int64 StreamOutMemoryUsed = 0;
+		int64 StreamInMemoryUsed = 0;
+	};
+
+	const int32 NumPackets = AsyncRenderAssetStreamingPrivate::GetNumPackets(StreamingRenderAssets.Num());
+	TArray<FPacketRequests, TInlineAllocator<64>> PacketRequests;
+	PacketRequests.SetNum(NumPackets);
+
+	// Each packet gathers the requests of a contiguous range of assets, so that appending them in order gives the same result as a single pass.
+	AsyncRenderAssetStreamingPrivate::ForEachPacket(StreamingRenderAssets.Num(), NumPackets, [&](int32 PacketIndex, int32 StartIndex, int32 EndIndex)
+	{
+		FPacketRequests& Packet = PacketRequests[PacketIndex];
+		for (int32 AssetIndex = StartIndex; AssetIndex < EndIndex && !IsAborted(); ++AssetIndex)
 		{
-			// If there is no pending update, kick one if the budget allows it.
-			if (StreamingRenderAsset.RequestedMips == StreamingRenderAsset.ResidentMips)
+			FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
+			const bool bWasMissingTooManyMips = StreamingRenderAsset.IsMissingTooManyMips();
+
+			// If we need to change the number of resident mips.
+			if (StreamingRenderAsset.UpdateLoadOrderPriority_Async(Settings))
 			{
-				PrioritizedRenderAssets.Add(AssetIndex);
+				// If there is no pending update, kick one if the budget allows it.
+				if (StreamingRenderAsset.RequestedMips == StreamingRenderAsset.ResidentMips)
+				{
+					Packet.PrioritizedRenderAssets.Add(AssetIndex);
+				}
+				// Otherwise, if the update is trying to load too many, too few, or unload required MIPs, (try to) cancel it.
+				else if (
+					// If marked as missing too many MIPs, a high priority request was created so be more aggressive on canceling it.
+					StreamingRenderAsset.RequestedMips > FMath::Max<int32>(StreamingRenderAsset.ResidentMips, StreamingRenderAsset.WantedMips + (bWasMissingTooManyMips ? 0 : 1)) ||
+					// If too many missing MIPs, cancel existing request if it is not loading enough so a high priority one can be created.
+					// Otherwise, only cancel if it is trying to unload resident MIPs.
+					StreamingRenderAsset.RequestedMips < (StreamingRenderAsset.IsMissingTooManyMips() ? StreamingRenderAsset.WantedMips : FMath::Min<int32>(StreamingRenderAsset.ResidentMips, StreamingRenderAsset.WantedMips)))
+				{
+					Packet.CancelationRequests.Add(AssetIndex);
+				}
 			}
-			// Otherwise, if the update is trying to load too many, too few, or unload required MIPs, (try to) cancel it.
-			else if (
-				// If marked as missing too many MIPs, a high priority request was created so be more aggressive on canceling it.
-				StreamingRenderAsset.RequestedMips > FMath::Max<int32>(StreamingRenderAsset.ResidentMips, StreamingRenderAsset.WantedMips + (bWasMissingTooManyMips ? 0 : 1)) ||
-				// If too many missing MIPs, cancel existing request if it is not loading enough so a high priority one can be created.
-				// Otherwise, only cancel if it is trying to unload resident MIPs.
-				StreamingRenderAsset.RequestedMips < (StreamingRenderAsset.IsMissingTooManyMips() ? StreamingRenderAsset.WantedMips : FMath::Min<int32>(StreamingRenderAsset.ResidentMips, StreamingRenderAsset.WantedMips)))
+
+			// Reduce the stream in/out budgets from pending updates.
+			const int64 TempMemoryUsed = StreamingRenderAsset.GetSize(StreamingRenderAsset.RequestedMips);
+			if (StreamingRenderAsset.RequestedMips < StreamingRenderAsset.ResidentMips)
 			{
-				CancelationRequests.Add(AssetIndex);
+				// Here we assume that the stream out complete before new stream in requests start, so it doesn't affect stream in budget.
+				Packet.StreamOutMemoryUsed += TempMemoryUsed;
+			}
+			else if (StreamingRenderAsset.RequestedMips > StreamingRenderAsset.ResidentMips)
+			{
+				// If there is a pending stream in, remove the temporary memory from both stream in and stream out budget.
+				// When the request was made, there were possibly stream out issued at the same time to free memory in case of budget limit.
+				Packet.StreamInMemoryUsed += TempMemoryUsed;
+				Packet.StreamOutMemoryUsed += TempMemoryUsed;
 			}
 		}
+	});
 
-		// Reduce the stream in/out budgets from pending updates.
-		const int64 TempMemoryUsed = StreamingRenderAsset.GetSize(StreamingRenderAsset.RequestedMips);
-		if (StreamingRenderAsset.RequestedMips < StreamingRenderAsset.ResidentMips)
-		{
-			// Here we assume that the stream out complete before new stream in requests start, so it doesn't affect stream in budget.
-			StreamOutMemoryBudget -= TempMemoryUsed;
-		}
-		else if (StreamingRenderAsset.RequestedMips > StreamingRenderAsset.ResidentMips)
-		{
-			// If there is a pending stream in, remove the temporary memory from both stream in and stream out budget.
-			// When the request was made, there were possibly stream out issued at the same time to free memory in case of budget limit.
-			StreamInMemoryBudget -= TempMemoryUsed;
-			StreamOutMemoryBudget -= TempMemoryUsed;
-		}
+	TArray<int32> PrioritizedRenderAssets;
+	PrioritizedRenderAssets.Empty(StreamingRenderAssets.Num());
+	for (FPacketRequests& Packet : PacketRequests)
+	{
+		PrioritizedRenderAssets.Append(Packet.PrioritizedRenderAssets);
+		CancelationRequests.Append(Packet.CancelationRequests);
+		StreamOutMemoryBudget -= Packet.StreamOutMemoryUsed;
+		StreamInMemoryBudget -= Packet.StreamInMemoryUsed;
 	}
 
 	PrioritizedRenderAssets.Sort(FCompareRenderAssetByLoadOrderPriority(StreamingRenderAssets));
@@ -879,14 +1216,26 @@ void FRenderAssetStreamingMipCalcTask::UpdatePendingStreamingStatus_Async()
 
 	PendingUpdateDirties.Empty();
 
-	for (int32 AssetIndex = 0; AssetIndex < StreamingRenderAssets.Num() && !IsAborted(); ++AssetIndex)
+	const int32 NumPackets = AsyncRenderAssetStreamingPrivate::GetNumPackets(StreamingRenderAssets.Num());
+	TArray<TArray<int32>, TInlineAllocator<64>> PacketPendingUpdateDirties;
+	PacketPendingUpdateDirties.SetNum(NumPackets);
+
+	AsyncRenderAssetStreamingPrivate::ForEachPacket(StreamingRenderAssets.Num(), NumPackets, [&](int32 PacketIndex, int32 StartIndex, int32 EndIndex)
 	{
-		const FStreamingRenderAsset& StreamingTexture = StreamingRenderAssets[AssetIndex];
-		if (StreamingTexture.bHasUpdatePending != StreamingTexture.HasUpdatePending(bIsStreamingPaused, HasAnyView()))
+		for (int32 AssetIndex = StartIndex; AssetIndex < EndIndex && !IsAborted(); ++AssetIndex)
 		{
-			// The texture/mesh state are only updated on the gamethread, where we can make sure the UStreamableRenderAsset is in sync.
-			PendingUpdateDirties.Add(AssetIndex);
+			const FStreamingRenderAsset& StreamingTexture = StreamingRenderAssets[AssetIndex];
+			if (StreamingTexture.bHasUpdatePending != StreamingTexture.HasUpdatePending(bIsStreamingPaused, HasAnyView()))
+			{
+				// The texture/mesh state are only updated on the gamethread, where we can make sure the UStreamableRenderAsset is in sync.
+				PacketPendingUpdateDirties[PacketIndex].Add(AssetIndex);
+			}
 		}
+	});
+
+	for (const TArray<int32>& Dirties : PacketPendingUpdateDirties)
+	{
+		PendingUpdateDirties.Append(Dirties);
 	}
 }
 
@@ -908,15 +1257,21 @@ void FRenderAssetStreamingMipCalcTask::DoWork()
 	
 	ApplyPakStateChanges_Async();
 
-	for (FStreamingRenderAsset& StreamingRenderAsset : StreamingRenderAssets)
+	// Each asset only reads the views and writes its own state, except for the stress test which uses the global random stream.
+	const int32 NumPackets = AsyncRenderAssetStreamingPrivate::GetNumPackets(StreamingRenderAssets.Num(), !Settings.bStressTest);
+	AsyncRenderAssetStreamingPrivate::ForEachPacket(StreamingRenderAssets.Num(), NumPackets, [&](int32 PacketIndex, int32 StartIndex, int32 EndIndex)
 	{
-		if (IsAborted()) break;
+		for (int32 AssetIndex = StartIndex; AssetIndex < EndIndex; ++AssetIndex)
+		{
+			if (IsAborted()) break;
 
-		StreamingRenderAsset.UpdateOptionalMipsState_Async();
-		
-		StreamingData.UpdatePerfectWantedMips_Async(StreamingRenderAsset, Settings);
-		StreamingRenderAsset.DynamicBoostFactor = 1.f; // Reset after every computation.
-	}
+			FStreamingRenderAsset& StreamingRenderAsset = StreamingRenderAssets[AssetIndex];
+			StreamingRenderAsset.UpdateOptionalMipsState_Async();
+
+			StreamingData.UpdatePerfectWantedMips_Async(StreamingRenderAsset, Settings);
+			StreamingRenderAsset.DynamicBoostFactor = 1.f; // Reset after every computation.
+		}
+	});
 
 	// According to budget, make relevant sacrifices and keep possible unwanted mips
 	UpdateBudgetedMips_Async();
@@ -193,6 +193,12 @@ private:
 
 	void TryKeepMips(TArray<int32>& PrioritizedRenderAssets, int64& MemoryBudgeted, const int64 InMemoryBudget);
 
+	/** Same result as TryDropMips when the rounds don't depend on each other, but finds where the budget is met with a prefix sum over the memory freed by each round. */
+	void TryDropMipsInRounds(TArray<int32>& PrioritizedRenderAssets, int64& MemoryBudgeted, const int64 InMemoryBudget);
+
+	/** Sorts like FCompareRenderAssetByRetentionPriority, on keys gathered from the assets once rather than on each comparison. */
+	void SortByRetentionPriority(TArray<int32>& RenderAssetIndices);
+
 	void UpdateBudgetedMips_Async();
 
 	void UpdateLoadAndCancelationRequests_Async();
@@ -218,6 +224,29 @@ private:
 	/** Indices of texture with dirty values for bHasUpdatePending */
 	TArray<int32>	PendingUpdateDirties;
 
+	/** State of the assets considered by TryDropMipsInRounds, indexed like the prioritized asset array. */
+	struct FDropMipsCandidates
+	{
+		TArray<int8> NumMissingMips;
+		TArray<int8> BudgetedMips;
+		TArray<int16> NumRounds;
+
+		void SetNum(int32 Num)
+		{
+			NumMissingMips.SetNumUninitialized(Num, EAllowShrinking::No);
+			BudgetedMips.SetNumUninitialized(Num, EAllowShrinking::No);
+			NumRounds.SetNumUninitialized(Num, EAllowShrinking::No);
+		}
+	};
+	FDropMipsCandidates DropMipsCandidates;
+
+	struct FRetentionSortKey
+	{
+		uint64 Key;
+		int32 AssetIndex;
+	};
+	TArray<FRetentionSortKey> RetentionSortKeys;
+
 	/** Whether the async work should abort its processing. */
 	volatile bool				bAbort;
 
@@ -0,0 +1,198 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "AudioStreamingCache.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AudioChunkCacheTestsPrivate
+{
+	static FAudioChunkCache::FChunkKey MakeKey(int32 Index)
+	{
+		// Eight chunks per sound wave
+		const int32 WaveIndex = Index / 8;
+		return FAudioChunkCache::FChunkKey(FName(TEXT("StressTestWave"), WaveIndex), FGuid(WaveIndex, 0, 0, 1), Index % 8);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAudioChunkCacheLookupStressTest, "System.Engine.Audio.StreamingCache.LookupStress", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAudioChunkCacheLookupStressTest::RunTest(const FString& Parameters)
+{
+	using namespace AudioChunkCacheTestsPrivate;
+
+	constexpr int32 NumChunks = 1024;
+	constexpr int32 NumEvictedChunks = 256;
+	constexpr int32 NumThreads = 8;
+	constexpr int32 NumLookupsPerThread = 100000;
+
+	FAudioChunkCache Cache(64 * 1024, NumChunks, 1024 * 1024 * 1024);
+
+	auto InsertLoadedChunk = [&Cache](int32 Index)
+	{
+		FScopeLock ScopeLock(&Cache.CacheMutationCriticalSection);
+		FAudioChunkCache::FCacheElement* Element = Cache.InsertChunk(MakeKey(Index), nullptr);
+		if (Element)
+		{
+			Element->bIsLoaded = true;
+		}
+		return Element != nullptr;
+	};
+
+	for (int32 Index = 0; Index < NumChunks; ++Index)
+	{
+		InsertLoadedChunk(Index);
+	}
+
+	// Filling the cache past its capacity evicts the least recent chunks, which must leave the index
+	for (int32 Index = NumChunks; Index < NumChunks + NumEvictedChunks; ++Index)
+	{
+		if (!InsertLoadedChunk(Index))
+		{
+			AddError(FString::Printf(TEXT("Failed to insert chunk %d"), Index));
+			return false;
+		}
+	}
+
+	for (int32 Index = 0; Index < NumChunks + NumEvictedChunks; ++Index)
+	{
+		const FAudioChunkCache::FChunkKey Key = MakeKey(Index);
+		const bool bShouldBeCached = Index >= NumEvictedChunks;
+		const FAudioChunkCache::FCacheElement* Element = Cache.FindElementForKey(Key);
+		if ((Element != nullptr) != bShouldBeCached || (Element && !(Element->Key == Key)))
+		{
+			AddError(FString::Printf(TEXT("Unexpected lookup result for chunk %d"), Index));
+			return false;
+		}
+		TestEqual(TEXT("Lookup ID matches the index"), Cache.GetCacheLookupIDForChunk(Key) != InvalidAudioStreamCacheLookupID, bShouldBeCached);
+	}
+
+	// Consumers look up chunks on many threads while the LRU list keeps being reordered
+	std::atomic<int32> NumFailedLookups = 0;
+	std::atomic<uint64> TotalLookupCycles = 0;
+	std::atomic<uint64> MaxLookupCycles = 0;
+
+	ParallelFor(NumThreads + 1, [&](int32 ThreadIndex)
+	{
+		FRandomStream RandomStream(ThreadIndex);
+
+		if (ThreadIndex == NumThreads)
+		{
+			for (int32 Iteration = 0; Iteration < NumLookupsPerThread; ++Iteration)
+			{
+				FScopeLock ScopeLock(&Cache.CacheMutationCriticalSection);
+				if (FAudioChunkCache::FCacheElement* Element = Cache.FindElementForKey(MakeKey(RandomStream.RandRange(NumEvictedChunks, NumChunks + NumEvictedChunks - 1))))
+				{
+					Cache.TouchElement(Element);
+				}
+			}
+			return;
+		}
+
+		uint64 ThreadLookupCycles = 0;
+		uint64 ThreadMaxLookupCycles = 0;
+		for (int32 Iteration = 0; Iteration < NumLookupsPerThread; ++Iteration)
+		{
+			const FAudioChunkCache::FChunkKey Key = MakeKey(RandomStream.RandRange(NumEvictedChunks, NumChunks + NumEvictedChunks - 1));
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			FAudioChunkCache::FCacheElement* Element = Cache.FindElementForKey(Key);
+			const uint64 LookupCycles = FPlatformTime::Cycles64() - StartCycles;
+
+			ThreadLookupCycles += LookupCycles;
+			ThreadMaxLookupCycles = FMath::Max(ThreadMaxLookupCycles, LookupCycles);
+
+			if (!Element || !(Element->Key == Key))
+			{
+				++NumFailedLookups;
+				continue;
+			}
+
+			Cache.AddNewReferenceToChunk(Key);
+			Cache.RemoveReferenceToChunk(Key);
+		}
+
+		TotalLookupCycles += ThreadLookupCycles;
+		uint64 PreviousMaxLookupCycles = MaxLookupCycles.load();
+		while (ThreadMaxLookupCycles > PreviousMaxLookupCycles && !MaxLookupCycles.compare_exchange_weak(PreviousMaxLookupCycles, ThreadMaxLookupCycles))
+		{
+		}
+	});
+
+	TestEqual(TEXT("Failed lookups"), NumFailedLookups.load(), 0);
+
+	for (int32 Index = NumEvictedChunks; Index < NumChunks + NumEvictedChunks; ++Index)
+	{
+		const FAudioChunkCache::FCacheElement* Element = Cache.FindElementForKey(MakeKey(Index));
+		if (!Element || Element->NumConsumers.GetValue() != 0)
+		{
+			AddError(FString::Printf(TEXT("Chunk %d is missing or still referenced after the stress test"), Index));
+			break;
+		}
+	}
+
+	const double AverageLookupMicroseconds = FPlatformTime::ToMilliseconds64(TotalLookupCycles.load()) * 1000.0 / (NumThreads * NumLookupsPerThread);
+	const double MaxLookupMicroseconds = FPlatformTime::ToMilliseconds64(MaxLookupCycles.load()) * 1000.0;
+	AddInfo(FString::Printf(TEXT("%d threads, %d lookups each: average lookup %.3f us, max %.3f us"), NumThreads, NumLookupsPerThread, AverageLookupMicroseconds, MaxLookupMicroseconds));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAudioStreamingChunkIndexForTimeTest, "System.Engine.Audio.StreamingCache.ChunkIndexForTime", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAudioStreamingChunkIndexForTimeTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumFrames = 4000;
+
+	auto GetChunkIndex = [](const TIndirectArray<FStreamedAudioChunk>& Chunks, float PlaybackFraction)
+	{
+		return FCachedAudioStreamingManager::GetChunkIndexForPlaybackFraction(Chunks.Num(), NumFrames, PlaybackFraction, [&Chunks](int32 ChunkIndex) -> const FStreamedAudioChunk&
+		{
+			return Chunks[ChunkIndex];
+		});
+	};
+
+	// Chunks with a seek table, of 1000 frames each
+	TIndirectArray<FStreamedAudioChunk> SeekTableChunks;
+	for (uint32 SeekOffset : { 0u, 1000u, 2000u, 3000u })
+	{
+		FStreamedAudioChunk* Chunk = new FStreamedAudioChunk();
+		Chunk->AudioDataSize = 100;
+		Chunk->SeekOffsetInAudioFrames = SeekOffset;
+		SeekTableChunks.Add(Chunk);
+	}
+
+	TestEqual(TEXT("Seek table: start"), GetChunkIndex(SeekTableChunks, 0.0f), 0);
+	TestEqual(TEXT("Seek table: first frame of the second chunk"), GetChunkIndex(SeekTableChunks, 0.25f), 1);
+	TestEqual(TEXT("Seek table: within the second chunk"), GetChunkIndex(SeekTableChunks, 0.45f), 1);
+	TestEqual(TEXT("Seek table: within the last chunk"), GetChunkIndex(SeekTableChunks, 0.9f), 3);
+	TestEqual(TEXT("Seek table: end"), GetChunkIndex(SeekTableChunks, 1.0f), 3);
+
+	// Chunks without a seek table, the chunk sizes follow the time at a constant bitrate
+	TIndirectArray<FStreamedAudioChunk> ChunkSizeChunks;
+	for (int32 AudioDataSize : { 100, 300, 100, 500 })
+	{
+		FStreamedAudioChunk* Chunk = new FStreamedAudioChunk();
+		Chunk->AudioDataSize = AudioDataSize;
+		ChunkSizeChunks.Add(Chunk);
+	}
+
+	TestEqual(TEXT("Chunk size: start"), GetChunkIndex(ChunkSizeChunks, 0.0f), 0);
+	TestEqual(TEXT("Chunk size: within the first chunk"), GetChunkIndex(ChunkSizeChunks, 0.05f), 0);
+	TestEqual(TEXT("Chunk size: start of the second chunk"), GetChunkIndex(ChunkSizeChunks, 0.1f), 1);
+	TestEqual(TEXT("Chunk size: within the second chunk"), GetChunkIndex(ChunkSizeChunks, 0.35f), 1);
+	TestEqual(TEXT("Chunk size: within the third chunk"), GetChunkIndex(ChunkSizeChunks, 0.45f), 2);
+	TestEqual(TEXT("Chunk size: start of the last chunk"), GetChunkIndex(ChunkSizeChunks, 0.5f), 3);
+	TestEqual(TEXT("Chunk size: end"), GetChunkIndex(ChunkSizeChunks, 1.0f), 3);
+
+	// A single chunk is the zeroth chunk, inlined on the asset
+	TIndirectArray<FStreamedAudioChunk> SingleChunk;
+	SingleChunk.Add(new FStreamedAudioChunk());
+	TestEqual(TEXT("Single chunk"), GetChunkIndex(SingleChunk, 0.5f), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
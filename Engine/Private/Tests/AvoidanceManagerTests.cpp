@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "AI/Navigation/AvoidanceManager.h"
+#include "Engine/World.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace UE::AI::Private
+{
+	struct FAvoidanceManagerTestUtil
+	{
+		static void UpdateAgent(UAvoidanceManager& Manager, int32 AvoidanceUID, const FNavAvoidanceData& AvoidanceData)
+		{
+			Manager.UpdateRVO_Internal(AvoidanceUID, AvoidanceData);
+		}
+	};
+}
+
+namespace AvoidanceManagerTestsPrivate
+{
+	using namespace UE::AI::Private;
+
+	/** Registers NumAgents agents walking in random directions, spread so that each one has a handful of neighbors in its test radius */
+	static void AddRandomAgents(UAvoidanceManager& Manager, const int32 NumAgents, TArray<FNavAvoidanceData>& OutAgents, TArray<int32>& OutUIDs)
+	{
+		FRandomStream RandomStream(0x5eed);
+
+		const float AgentSpacing = 150.0f;
+		const float WorldExtent = FMath::Sqrt(float(NumAgents)) * AgentSpacing * 0.5f;
+
+		for (int32 AgentIndex = 0; AgentIndex < NumAgents; ++AgentIndex)
+		{
+			const FVector Center(RandomStream.FRandRange(-WorldExtent, WorldExtent), RandomStream.FRandRange(-WorldExtent, WorldExtent), RandomStream.FRandRange(0.0f, 50.0f));
+			const FVector Velocity = RandomStream.GetUnitVector().GetSafeNormal2D() * RandomStream.FRandRange(100.0f, 600.0f);
+
+			FNavAvoidanceData& AvoidanceData = OutAgents.AddDefaulted_GetRef();
+			AvoidanceData.Init(&Manager, Center, 34.0f, 88.0f, Velocity, RandomStream.FRand());
+
+			const int32 AvoidanceUID = Manager.GetNewAvoidanceUID();
+			OutUIDs.Add(AvoidanceUID);
+			FAvoidanceManagerTestUtil::UpdateAgent(Manager, AvoidanceUID, AvoidanceData);
+		}
+	}
+
+	/** Calculates the velocities of the agents in [0, NumToSolve) one at a time, returns the time it took */
+	static double SolveAgents(UAvoidanceManager& Manager, const TArray<FNavAvoidanceData>& Agents, const TArray<int32>& UIDs, const int32 NumToSolve, TArray<FVector>& OutVelocities)
+	{
+		OutVelocities.SetNumUninitialized(NumToSolve);
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 AgentIndex = 0; AgentIndex < NumToSolve; ++AgentIndex)
+		{
+			OutVelocities[AgentIndex] = Manager.GetAvoidanceVelocityIgnoringUID(Agents[AgentIndex], Manager.DeltaTimeToPredict, UIDs[AgentIndex]);
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	}
+
+	static int32 CountMismatches(const TArray<FVector>& Expected, const TArray<FVector>& Actual)
+	{
+		int32 NumMismatches = 0;
+		for (int32 Index = 0; Index < Expected.Num(); ++Index)
+		{
+			NumMismatches += Expected[Index].Equals(Actual[Index], UE_KINDA_SMALL_NUMBER) ? 0 : 1;
+		}
+		return NumMismatches;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAvoidanceManagerStressBenchmark, "System.Engine.AI.AvoidanceManager.StressBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FAvoidanceManagerStressBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AvoidanceManagerTestsPrivate;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	UAvoidanceManager* Manager = NewObject<UAvoidanceManager>(World);
+
+	constexpr int32 NumAgents = 10000;
+	// Testing every object against every other one is quadratic, only time a subset of agents that way
+	constexpr int32 NumBruteForceAgents = 1000;
+
+	TArray<FNavAvoidanceData> Agents;
+	TArray<int32> UIDs;
+	AddRandomAgents(*Manager, NumAgents, Agents, UIDs);
+
+	TArray<FVector> BruteForceVelocities;
+	Manager->bUseSpatialGrid = false;
+	const double BruteForceSeconds = SolveAgents(*Manager, Agents, UIDs, NumBruteForceAgents, BruteForceVelocities);
+
+	TArray<FVector> GridVelocities;
+	Manager->bUseSpatialGrid = true;
+	const double GridSeconds = SolveAgents(*Manager, Agents, UIDs, NumAgents, GridVelocities);
+
+	TArray<FVector> GridSubsetVelocities(GridVelocities.GetData(), NumBruteForceAgents);
+	TestEqual(TEXT("Spatial grid velocities match testing every avoidance object"), CountMismatches(BruteForceVelocities, GridSubsetVelocities), 0);
+
+	int32 NumAvoiding = 0;
+	for (int32 AgentIndex = 0; AgentIndex < NumAgents; ++AgentIndex)
+	{
+		NumAvoiding += Agents[AgentIndex].Velocity.Equals(GridVelocities[AgentIndex]) ? 0 : 1;
+	}
+
+	AddInfo(FString::Printf(TEXT("%d agents, %d changed course. All objects: %.3f ms per agent (%d agents), spatial grid: %.3f ms for all"),
+		NumAgents, NumAvoiding, BruteForceSeconds * 1000.0 / NumBruteForceAgents, NumBruteForceAgents, GridSeconds * 1000.0));
+
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
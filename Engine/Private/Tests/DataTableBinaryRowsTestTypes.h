@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DataTable.h"
+#include "DataTableBinaryRowsTestTypes.generated.h"
+
+USTRUCT()
+struct FDataTableBinaryRowsTestInner
+{
+	GENERATED_BODY()
+
+	FDataTableBinaryRowsTestInner()
+		: bEnabled(false)
+	{
+	}
+
+	UPROPERTY()
+	int32 Count = 0;
+
+	UPROPERTY()
+	float Weights[3] = {};
+
+	UPROPERTY()
+	uint8 bEnabled : 1;
+};
+
+USTRUCT()
+struct FDataTableBinaryRowsTestRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	FDataTableBinaryRowsTestRow()
+		: bFirstFlag(false)
+		, bSecondFlag(false)
+	{
+	}
+
+	UPROPERTY()
+	int64 Id = 0;
+
+	UPROPERTY()
+	uint8 bFirstFlag : 1;
+
+	UPROPERTY()
+	uint8 bSecondFlag : 1;
+
+	UPROPERTY()
+	bool bPlainBool = false;
+
+	UPROPERTY()
+	double Scale = 1.0;
+
+	UPROPERTY()
+	int16 Values[4] = {};
+
+	UPROPERTY()
+	FDataTableBinaryRowsTestInner Inner;
+
+	UPROPERTY()
+	FDataTableBinaryRowsTestInner InnerArray[2];
+};
+
+/** Same properties as FDataTableBinaryRowsTestRow with a different type for Scale, as if the row struct changed after the cook */
+USTRUCT()
+struct FDataTableBinaryRowsTestChangedRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	FDataTableBinaryRowsTestChangedRow()
+		: bFirstFlag(false)
+		, bSecondFlag(false)
+	{
+	}
+
+	UPROPERTY()
+	int64 Id = 0;
+
+	UPROPERTY()
+	uint8 bFirstFlag : 1;
+
+	UPROPERTY()
+	uint8 bSecondFlag : 1;
+
+	UPROPERTY()
+	bool bPlainBool = false;
+
+	UPROPERTY()
+	float Scale = 1.0f;
+
+	UPROPERTY()
+	int16 Values[4] = {};
+
+	UPROPERTY()
+	FDataTableBinaryRowsTestInner Inner;
+
+	UPROPERTY()
+	FDataTableBinaryRowsTestInner InnerArray[2];
+};
@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "DataTableBinaryRowsTestTypes.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/Package.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(DataTableBinaryRowsTestTypes)
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Gives the tests access to the binary row storage of UDataTable, which is only used when cooking */
+struct FDataTableBinaryRowsTestUtil
+{
+	static bool CanUseBinaryRowStorage(const UDataTable& Table)
+	{
+		return Table.CanUseBinaryRowStorage();
+	}
+
+	static void SaveBinaryRowData(UDataTable& Table, TArray<uint8>& OutBytes)
+	{
+		FMemoryWriter Writer(OutBytes);
+		FStructuredArchiveFromArchive StructuredArchive(Writer);
+		Table.SaveBinaryRowData(StructuredArchive.GetSlot().EnterRecord());
+	}
+
+	static void LoadBinaryRowData(UDataTable& Table, const TArray<uint8>& Bytes)
+	{
+		FMemoryReader Reader(Bytes);
+		FStructuredArchiveFromArchive StructuredArchive(Reader);
+		Table.LoadBinaryRowData(StructuredArchive.GetSlot().EnterRecord());
+	}
+};
+
+namespace DataTableBinaryRowsTestsPrivate
+{
+	static UDataTable* NewTestTable(UScriptStruct* RowStruct)
+	{
+		UDataTable* Table = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+		Table->RowStruct = RowStruct;
+		Table->bUseBinaryRowStorage = true;
+		return Table;
+	}
+
+	static FDataTableBinaryRowsTestRow MakeRow(int32 Index)
+	{
+		FDataTableBinaryRowsTestRow Row;
+		Row.Id = 0x100000000ll * (Index + 1) + Index;
+		Row.bFirstFlag = (Index % 2) == 0;
+		Row.bSecondFlag = (Index % 3) == 0;
+		Row.bPlainBool = (Index % 2) != 0;
+		Row.Scale = 0.5 * Index - 3.25;
+		for (int32 ValueIndex = 0; ValueIndex < UE_ARRAY_COUNT(Row.Values); ValueIndex++)
+		{
+			Row.Values[ValueIndex] = static_cast<int16>(Index * 100 - ValueIndex);
+		}
+		Row.Inner.Count = Index * 7;
+		Row.Inner.Weights[2] = 1.5f * Index;
+		Row.Inner.bEnabled = (Index % 2) != 0;
+		Row.InnerArray[1].Count = -Index;
+		Row.InnerArray[1].Weights[0] = 0.25f * Index;
+		Row.InnerArray[1].bEnabled = true;
+		return Row;
+	}
+
+	static FName MakeRowName(int32 Index)
+	{
+		return FName(TEXT("Row"), Index);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDataTableBinaryRowsRoundTripTest, "System.Engine.DataTable.BinaryRows.RoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FDataTableBinaryRowsRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace DataTableBinaryRowsTestsPrivate;
+
+	constexpr int32 NumRows = 5;
+
+	UDataTable* SavedTable = NewTestTable(FDataTableBinaryRowsTestRow::StaticStruct());
+	for (int32 Index = 0; Index < NumRows; Index++)
+	{
+		SavedTable->AddRow(MakeRowName(Index), MakeRow(Index));
+	}
+
+	if (!TestTrue(TEXT("The row struct can use binary row storage"), FDataTableBinaryRowsTestUtil::CanUseBinaryRowStorage(*SavedTable)))
+	{
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	FDataTableBinaryRowsTestUtil::SaveBinaryRowData(*SavedTable, Bytes);
+
+	UDataTable* LoadedTable = NewTestTable(FDataTableBinaryRowsTestRow::StaticStruct());
+	FDataTableBinaryRowsTestUtil::LoadBinaryRowData(*LoadedTable, Bytes);
+
+	TestEqual(TEXT("Number of rows"), LoadedTable->GetRowMap().Num(), NumRows);
+	TestTrue(TEXT("Row names are in the saved order"), LoadedTable->GetRowNames() == SavedTable->GetRowNames());
+
+	for (int32 Index = 0; Index < NumRows; Index++)
+	{
+		const FDataTableBinaryRowsTestRow Expected = MakeRow(Index);
+		const FDataTableBinaryRowsTestRow* Loaded = LoadedTable->FindRow<FDataTableBinaryRowsTestRow>(MakeRowName(Index), TEXT("BinaryRowsRoundTrip"));
+		if (!Loaded)
+		{
+			AddError(FString::Printf(TEXT("Row %d is missing after loading"), Index));
+			continue;
+		}
+
+		TestTrue(FString::Printf(TEXT("Row %d is identical"), Index), FDataTableBinaryRowsTestRow::StaticStruct()->CompareScriptStruct(Loaded, &Expected, PPF_None));
+		TestEqual(FString::Printf(TEXT("Row %d first bitfield bool"), Index), (bool)Loaded->bFirstFlag, (bool)Expected.bFirstFlag);
+		TestEqual(FString::Printf(TEXT("Row %d second bitfield bool"), Index), (bool)Loaded->bSecondFlag, (bool)Expected.bSecondFlag);
+		TestEqual(FString::Printf(TEXT("Row %d nested bitfield bool"), Index), (bool)Loaded->InnerArray[1].bEnabled, (bool)Expected.InnerArray[1].bEnabled);
+		TestEqual(FString::Printf(TEXT("Row %d static array"), Index), Loaded->Values[3], Expected.Values[3]);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDataTableBinaryRowsLayoutMismatchTest, "System.Engine.DataTable.BinaryRows.LayoutMismatch", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FDataTableBinaryRowsLayoutMismatchTest::RunTest(const FString& Parameters)
+{
+	using namespace DataTableBinaryRowsTestsPrivate;
+
+	UDataTable* SavedTable = NewTestTable(FDataTableBinaryRowsTestRow::StaticStruct());
+	SavedTable->AddRow(MakeRowName(0), MakeRow(0));
+	SavedTable->AddRow(MakeRowName(1), MakeRow(1));
+
+	TArray<uint8> Bytes;
+	FDataTableBinaryRowsTestUtil::SaveBinaryRowData(*SavedTable, Bytes);
+
+	// The row struct changed since the rows were saved, they must not be loaded
+	AddExpectedError(TEXT("doesn't match the layout its binary rows were cooked with"), EAutomationExpectedErrorFlags::Contains, 1);
+
+	UDataTable* LoadedTable = NewTestTable(FDataTableBinaryRowsTestChangedRow::StaticStruct());
+	FDataTableBinaryRowsTestUtil::LoadBinaryRowData(*LoadedTable, Bytes);
+
+	TestEqual(TEXT("Number of rows"), LoadedTable->GetRowMap().Num(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AsyncLoadingTests_Shared.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/StreamableManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * This test validates that a batch waits on the request in flight for a target another handle is already loading, and that both handles complete.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLoadingTests_StreamableManager_BatchJoinsRequestInFlight,
+	TEXT("System.Engine.Loading.StreamableManager.BatchJoinsRequestInFlight"),
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+bool FLoadingTests_StreamableManager_BatchJoinsRequestInFlight::RunTest(const FString& Parameters)
+{
+	FLoadingTestsScope LoadingTestScope(this);
+	FStreamableManager StreamableManager;
+
+	TSharedPtr<FStreamableHandle> SingleHandle = StreamableManager.RequestAsyncLoad(FSoftObjectPath(FLoadingTestsScope::ObjectPath1));
+	TSharedPtr<FStreamableHandle> BatchHandle = StreamableManager.RequestAsyncLoadBatch({ FSoftObjectPath(FLoadingTestsScope::ObjectPath1), FSoftObjectPath(FLoadingTestsScope::ObjectPath2) });
+	if (!TestTrue("Both requests should have made a handle", SingleHandle.IsValid() && BatchHandle.IsValid()))
+	{
+		return false;
+	}
+
+	TSharedPtr<FStreamableBatchLoadStats> BatchStats = BatchHandle->FindFirstContextDataOfType<FStreamableBatchLoadStats>();
+	if (!TestTrue("The batch handle should have batch load stats", BatchStats.IsValid()))
+	{
+		return false;
+	}
+
+	TestEqual("No target should have been loaded before the batch", BatchStats->NumAlreadyLoaded, 0);
+	TestEqual("The batch should have joined the request in flight for the first package", BatchStats->NumJoinedInFlight, 1);
+
+	EAsyncPackageState::Type State = ProcessAsyncLoadingUntilComplete([&SingleHandle, &BatchHandle]() { return SingleHandle->HasLoadCompleted() && BatchHandle->HasLoadCompleted(); }, 5.0);
+	TestEqual("Async loading should have completed", State, EAsyncPackageState::Complete);
+	TestTrue("The handle that made the request should have completed", SingleHandle->HasLoadCompleted());
+	TestTrue("The batch handle should have completed", BatchHandle->HasLoadCompleted());
+
+	TArray<UObject*> LoadedAssets;
+	BatchHandle->GetLoadedAssets(LoadedAssets);
+	TestEqual("The batch should have loaded both targets", LoadedAssets.Num(), 2);
+	TestEqual("The batch should have recorded a latency per target", BatchStats->Latencies.Num(), 2);
+
+	return true;
+}
+
+/**
+ * This test validates that canceling the handle whose request a batch joined makes a new request, so that the batch still completes.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLoadingTests_StreamableManager_CancelRequestJoinedByBatch,
+	TEXT("System.Engine.Loading.StreamableManager.CancelRequestJoinedByBatch"),
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+bool FLoadingTests_StreamableManager_CancelRequestJoinedByBatch::RunTest(const FString& Parameters)
+{
+	FLoadingTestsScope LoadingTestScope(this);
+	FStreamableManager StreamableManager;
+
+	TSharedPtr<FStreamableHandle> SingleHandle = StreamableManager.RequestAsyncLoad(FSoftObjectPath(FLoadingTestsScope::ObjectPath1));
+	TSharedPtr<FStreamableHandle> BatchHandle = StreamableManager.RequestAsyncLoadBatch({ FSoftObjectPath(FLoadingTestsScope::ObjectPath1) });
+	if (!TestTrue("Both requests should have made a handle", SingleHandle.IsValid() && BatchHandle.IsValid()))
+	{
+		return false;
+	}
+
+	TSharedPtr<FStreamableBatchLoadStats> BatchStats = BatchHandle->FindFirstContextDataOfType<FStreamableBatchLoadStats>();
+	TestTrue("The batch should have joined the request in flight", BatchStats.IsValid() && BatchStats->NumJoinedInFlight == 1);
+
+	// The request in flight is bound to the canceled handle and won't complete the batch any more
+	SingleHandle->CancelHandle();
+
+	EAsyncPackageState::Type State = ProcessAsyncLoadingUntilComplete([&BatchHandle]() { return BatchHandle->HasLoadCompleted(); }, 5.0);
+	TestEqual("Async loading should have completed", State, EAsyncPackageState::Complete);
+	TestTrue("The canceled handle should stay canceled", SingleHandle->WasCanceled());
+	TestFalse("The canceled handle should not complete", SingleHandle->HasLoadCompleted());
+	TestTrue("The batch handle should have completed", BatchHandle->HasLoadCompleted());
+	TestNotNull("The batch should have loaded its target", BatchHandle->GetLoadedAsset());
+
+	return true;
+}
+
+/**
+ * This test validates that a batch requests duplicate targets once and completes once all its unique targets have loaded.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FLoadingTests_StreamableManager_BatchDuplicateTargets,
+	TEXT("System.Engine.Loading.StreamableManager.BatchDuplicateTargets"),
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter
+)
+bool FLoadingTests_StreamableManager_BatchDuplicateTargets::RunTest(const FString& Parameters)
+{
+	FLoadingTestsScope LoadingTestScope(this);
+	FStreamableManager StreamableManager;
+
+	TSharedPtr<FStreamableHandle> BatchHandle = StreamableManager.RequestAsyncLoadBatch({
+		FSoftObjectPath(FLoadingTestsScope::ObjectPath1),
+		FSoftObjectPath(FLoadingTestsScope::ObjectPath2),
+		FSoftObjectPath(FLoadingTestsScope::ObjectPath1) });
+	if (!TestTrue("The batch should have made a handle", BatchHandle.IsValid()))
+	{
+		return false;
+	}
+
+	TSharedPtr<FStreamableBatchLoadStats> BatchStats = BatchHandle->FindFirstContextDataOfType<FStreamableBatchLoadStats>();
+	if (!TestTrue("The batch handle should have batch load stats", BatchStats.IsValid()))
+	{
+		return false;
+	}
+
+	TArray<FSoftObjectPath> RequestedAssets;
+	BatchHandle->GetRequestedAssets(RequestedAssets, /*bIncludeChildren*/ false);
+	TestEqual("Duplicate targets should have been removed", RequestedAssets.Num(), 2);
+	TestEqual("The batch should count its unique targets", BatchStats->NumTargets, 2);
+	TestEqual("A duplicate target should not join the request made by the batch itself", BatchStats->NumJoinedInFlight, 0);
+
+	EAsyncPackageState::Type State = ProcessAsyncLoadingUntilComplete([&BatchHandle]() { return BatchHandle->HasLoadCompleted(); }, 5.0);
+	TestEqual("Async loading should have completed", State, EAsyncPackageState::Complete);
+	TestTrue("The batch handle should have completed", BatchHandle->HasLoadCompleted());
+
+	TArray<UObject*> LoadedAssets;
+	BatchHandle->GetLoadedAssets(LoadedAssets);
+	TestEqual("The batch should have loaded both unique targets", LoadedAssets.Num(), 2);
+	TestEqual("The batch should have recorded a latency per unique target", BatchStats->Latencies.Num(), 2);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
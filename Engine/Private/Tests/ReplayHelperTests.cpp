@@ -0,0 +1,219 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "ReplayHelper.h"
+#include "Engine/DataTable.h"
+#include "Math/RandomStream.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace UE::Net::Private
+{
+	struct FReplayHelperTestUtil
+	{
+		using FNetGuidCacheItem = FReplayHelper::FNetGuidCacheItem;
+
+		/** What the game thread gathered for a checkpoint by the time its guid cache is serialized */
+		struct FCheckpointInput
+		{
+			TArray<FNetGuidCacheItem> NetGuidCacheSnapshot;
+			TMap<FName, uint32> NameTableMap;
+			TArray<uint8> NetFieldExportData;
+			TArray<uint8> DemoFrameHeaderData;
+			TArray<FQueuedDemoPacket> DemoFramePackets;
+			bool bLevelStreamingFixes = false;
+		};
+
+		struct FCheckpointOutput
+		{
+			TArray<uint8> Data;
+			TMap<FName, uint32> NameTableMap;
+			int32 NumNetGuids = 0;
+			uint32 GuidCacheSize = 0;
+		};
+
+		/** Runs the checkpoint states from SerializeGuidCache to the end of the demo frame, amortized over as many frames as it takes to serialize one item a frame */
+		static FCheckpointOutput SaveCheckpoint(const FCheckpointInput& Input, bool bAsync)
+		{
+			FReplayHelper ReplayHelper;
+			FReplayHelper::FCheckpointSaveStateContext& Context = ReplayHelper.CheckpointSaveContext;
+
+			FCheckpointOutput Output;
+			FMemoryWriter CheckpointArchive(Output.Data);
+			FScopedForceUnicodeInArchive ScopedUnicodeSerialization(CheckpointArchive);
+
+			// Written after the checkpoint actors
+			Context.bWriteCheckpointOffset = Input.bLevelStreamingFixes;
+			if (Input.bLevelStreamingFixes)
+			{
+				Context.CheckpointOffset = CheckpointArchive.Tell();
+				CheckpointArchive << Context.CheckpointOffset;
+			}
+
+			int32 CurrentLevelIndex = 0;
+			CheckpointArchive << CurrentLevelIndex;
+
+			Context.NetGuidCacheSnapshot = Input.NetGuidCacheSnapshot;
+			Context.NameTableMap = Input.NameTableMap;
+
+			const FRepActorsCheckpointParams Params{ FPlatformTime::Seconds(), UE_SMALL_NUMBER };
+
+			TArray<uint8> NetFieldExportData = Input.NetFieldExportData;
+			TArray<uint8> DemoFrameHeaderData = Input.DemoFrameHeaderData;
+			TArray<FQueuedDemoPacket> DemoFramePackets = Input.DemoFramePackets;
+
+			if (bAsync)
+			{
+				Context.AsyncCheckpointData = MakeShared<FReplayHelper::FAsyncCheckpointData>();
+				Context.AsyncCheckpointData->NameTableMap = MoveTemp(Context.NameTableMap);
+
+				while (!ReplayHelper.SnapshotGuidCache(nullptr, Params))
+				{
+				}
+
+				Context.AsyncCheckpointData->NetFieldExportData = MoveTemp(NetFieldExportData);
+				Context.AsyncCheckpointData->DemoFrameHeaderData = MoveTemp(DemoFrameHeaderData);
+				Context.AsyncCheckpointData->DemoFramePackets = MoveTemp(DemoFramePackets);
+				Context.AsyncCheckpointData->bLevelStreamingFixes = Input.bLevelStreamingFixes;
+
+				ReplayHelper.LaunchAsyncCheckpointTask(CheckpointArchive);
+
+				while (!ReplayHelper.AppendAsyncCheckpointData(Params, &CheckpointArchive))
+				{
+					FPlatformProcess::Yield();
+				}
+			}
+			else
+			{
+				while (!ReplayHelper.SerializeGuidCache(nullptr, Params, &CheckpointArchive))
+				{
+				}
+
+				CheckpointArchive.Serialize(NetFieldExportData.GetData(), NetFieldExportData.Num());
+
+				ReplayHelper.WriteCheckpointOffset(CheckpointArchive, CheckpointArchive.Tell());
+				Context.GuidCacheSize = CheckpointArchive.TotalSize();
+
+				CheckpointArchive.Serialize(DemoFrameHeaderData.GetData(), DemoFrameHeaderData.Num());
+				FReplayHelper::WriteDemoFramePackets(CheckpointArchive, DemoFramePackets, Input.bLevelStreamingFixes);
+			}
+
+			Output.NameTableMap = MoveTemp(Context.NameTableMap);
+			Output.NumNetGuids = Context.NumNetGuidsForRecording;
+			Output.GuidCacheSize = Context.GuidCacheSize;
+
+			return Output;
+		}
+	};
+}
+
+namespace ReplayHelperTestsPrivate
+{
+	using namespace UE::Net::Private;
+
+	static TArray<uint8> MakeRandomBytes(FRandomStream& RandomStream, int32 Num)
+	{
+		TArray<uint8> Bytes;
+		Bytes.SetNumUninitialized(Num);
+		for (uint8& Byte : Bytes)
+		{
+			Byte = (uint8)RandomStream.RandHelper(256);
+		}
+		return Bytes;
+	}
+}
+
+/**
+ * This test validates that serializing the guid cache and the demo frame of a checkpoint on a worker thread writes the same bytes as the game thread,
+ * and that objects destroyed or not stable for networking are left out of both.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FReplayHelperCheckpointSerializeAsyncTest, "System.Engine.Networking.Replay.CheckpointSerializeAsync", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FReplayHelperCheckpointSerializeAsyncTest::RunTest(const FString& Parameters)
+{
+	using namespace ReplayHelperTestsPrivate;
+
+	FRandomStream RandomStream(0xC4EC);
+
+	const int32 NumObjects = 64;
+	const int32 NumPathNames = 16;
+
+	TArray<UObject*> Objects;
+	FReplayHelperTestUtil::FCheckpointInput Input;
+
+	for (int32 ObjectIndex = 0; ObjectIndex < NumObjects; ++ObjectIndex)
+	{
+		UObject* Object = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+		Objects.Add(Object);
+
+		// Transient objects aren't stable for networking, only the static guids are recorded
+		const bool bIsStatic = (ObjectIndex % 8) != 7;
+
+		FReplayHelperTestUtil::FNetGuidCacheItem& Item = Input.NetGuidCacheSnapshot.AddDefaulted_GetRef();
+		Item.NetGuid = FNetworkGUID::CreateFromIndex(ObjectIndex + 1, bIsStatic);
+		Item.Object = Object;
+		Item.OuterGUID = FNetworkGUID::CreateFromIndex(ObjectIndex / 4 + 1, true);
+		Item.PathName = FName(TEXT("/Game/ReplayHelperTest/Object"), RandomStream.RandHelper(NumPathNames));
+		Item.Flags = (uint8)RandomStream.RandHelper(4);
+	}
+
+	// The first item exporting this path name is destroyed, the next one using it must export it instead
+	const FName SharedPathName(TEXT("/Game/ReplayHelperTest/Shared"));
+	Input.NetGuidCacheSnapshot[0].PathName = SharedPathName;
+	Input.NetGuidCacheSnapshot[5].PathName = SharedPathName;
+	Input.NetGuidCacheSnapshot[9].PathName = SharedPathName;
+
+	// Exported by a previous checkpoint
+	Input.NameTableMap.Add(FName(TEXT("/Game/ReplayHelperTest/Object"), 3), 0);
+
+	int32 NumExpectedNetGuids = 0;
+	for (int32 ObjectIndex = 0; ObjectIndex < NumObjects; ++ObjectIndex)
+	{
+		// Destroyed while the checkpoint was saved
+		if (ObjectIndex == 0 || ObjectIndex == 22)
+		{
+			Objects[ObjectIndex]->MarkAsGarbage();
+		}
+		else if (Input.NetGuidCacheSnapshot[ObjectIndex].NetGuid.IsStatic())
+		{
+			++NumExpectedNetGuids;
+		}
+	}
+
+	Input.NetFieldExportData = MakeRandomBytes(RandomStream, 300);
+	Input.DemoFrameHeaderData = MakeRandomBytes(RandomStream, 100);
+
+	for (int32 PacketIndex = 0; PacketIndex < 32; ++PacketIndex)
+	{
+		TArray<uint8> PacketData = MakeRandomBytes(RandomStream, 1 + RandomStream.RandHelper(1024));
+		FQueuedDemoPacket& Packet = Input.DemoFramePackets.Emplace_GetRef(PacketData.GetData(), PacketData.Num(), PacketData.Num() * 8);
+		Packet.SeenLevelIndex = 1 + RandomStream.RandHelper(4);
+	}
+
+	for (const bool bLevelStreamingFixes : { false, true })
+	{
+		Input.bLevelStreamingFixes = bLevelStreamingFixes;
+
+		const FReplayHelperTestUtil::FCheckpointOutput SyncOutput = FReplayHelperTestUtil::SaveCheckpoint(Input, /*bAsync*/ false);
+		const FReplayHelperTestUtil::FCheckpointOutput AsyncOutput = FReplayHelperTestUtil::SaveCheckpoint(Input, /*bAsync*/ true);
+
+		const TCHAR* StreamingFixesStr = bLevelStreamingFixes ? TEXT("with level streaming fixes") : TEXT("without level streaming fixes");
+		TestEqual(FString::Printf(TEXT("The game thread records the valid objects %s"), StreamingFixesStr), SyncOutput.NumNetGuids, NumExpectedNetGuids);
+		TestEqual(FString::Printf(TEXT("The worker thread records the valid objects %s"), StreamingFixesStr), AsyncOutput.NumNetGuids, NumExpectedNetGuids);
+		TestTrue(FString::Printf(TEXT("Both write the same checkpoint %s"), StreamingFixesStr), SyncOutput.Data == AsyncOutput.Data);
+		TestEqual(FString::Printf(TEXT("Both have the same guid cache size %s"), StreamingFixesStr), AsyncOutput.GuidCacheSize, SyncOutput.GuidCacheSize);
+		TestTrue(FString::Printf(TEXT("Both leave the same name table %s"), StreamingFixesStr), SyncOutput.NameTableMap.OrderIndependentCompareEqual(AsyncOutput.NameTableMap));
+		TestTrue(FString::Printf(TEXT("The destroyed object's path is exported by the next object using it %s"), StreamingFixesStr), AsyncOutput.NameTableMap.Contains(SharedPathName));
+	}
+
+	for (UObject* Object : Objects)
+	{
+		Object->MarkAsGarbage();
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
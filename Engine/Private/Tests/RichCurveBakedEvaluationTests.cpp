@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Curves/RichCurve.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RichCurveBakedEvaluationTestsPrivate
+{
+	/** Cubic curve with auto tangents and a linear segment, extrapolated with an offset cycle after its last key */
+	static void MakeTestCurve(FRichCurve& OutCurve)
+	{
+		OutCurve.AddKey(0.0f, 0.0f);
+		OutCurve.AddKey(0.5f, 2.0f);
+		OutCurve.AddKey(1.2f, -1.0f);
+		OutCurve.AddKey(2.0f, 0.5f);
+		OutCurve.AddKey(3.0f, 4.0f);
+
+		for (auto KeyIt = OutCurve.GetKeyHandleIterator(); KeyIt; ++KeyIt)
+		{
+			OutCurve.SetKeyInterpMode(*KeyIt, RCIM_Cubic, false);
+		}
+		OutCurve.SetKeyInterpMode(OutCurve.FindKey(2.0f), RCIM_Linear, false);
+		OutCurve.AutoSetTangents();
+
+		OutCurve.PostInfinityExtrap = RCCE_CycleWithOffset;
+	}
+
+	static float MaxError(const FRichCurve& Curve, TConstArrayView<float> Times, TConstArrayView<float> Values)
+	{
+		float Error = 0.f;
+		for (int32 Index = 0; Index < Times.Num(); ++Index)
+		{
+			Error = FMath::Max(Error, FMath::Abs(Curve.Eval(Times[Index]) - Values[Index]));
+		}
+		return Error;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRichCurveBakedEvaluationTest, "System.Engine.Curves.RichCurve.BakedEvaluation", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FRichCurveBakedEvaluationTest::RunTest(const FString& Parameters)
+{
+	using namespace RichCurveBakedEvaluationTestsPrivate;
+
+	constexpr float ErrorTolerance = 0.001f;
+	constexpr int32 NumTimes = 100000;
+
+	FRichCurve Curve;
+	MakeTestCurve(Curve);
+
+	// Mostly within the keys, with some times before and after them
+	FRandomStream RandomStream(0x7c0e);
+	TArray<float> Times;
+	Times.SetNumUninitialized(NumTimes);
+	for (float& Time : Times)
+	{
+		Time = RandomStream.FRandRange(-0.5f, 4.0f);
+	}
+
+	TArray<float> Values;
+	Values.SetNumUninitialized(NumTimes);
+
+	const double ExactStartTime = FPlatformTime::Seconds();
+	Curve.Eval(Times, Values);
+	const double ExactSeconds = FPlatformTime::Seconds() - ExactStartTime;
+	TestEqual(TEXT("Batched evaluation without baking matches Eval"), MaxError(Curve, Times, Values), 0.f);
+
+	Curve.EnableBakedEvaluation(ErrorTolerance);
+
+	const double BakedStartTime = FPlatformTime::Seconds();
+	Curve.Eval(Times, Values);
+	const double BakedSeconds = FPlatformTime::Seconds() - BakedStartTime;
+	TestTrue(TEXT("Baked evaluation is within the error tolerance"), MaxError(Curve, Times, Values) <= ErrorTolerance * 2.f);
+
+	// Key edits have to rebuild the samples
+	Curve.UpdateOrAddKey(1.2f, 3.0f);
+	Curve.AutoSetTangents();
+	Curve.Eval(Times, Values);
+	TestTrue(TEXT("Baked evaluation follows key edits"), MaxError(Curve, Times, Values) <= ErrorTolerance * 2.f);
+
+	// Copies keep the settings but not the samples
+	FRichCurve CurveCopy = Curve;
+	CurveCopy.AddKey(3.5f, -2.0f);
+	CurveCopy.Eval(Times, Values);
+	TestTrue(TEXT("Copied curves are baked"), CurveCopy.IsBakedEvaluationEnabled());
+	TestTrue(TEXT("Copied curves bake their own samples"), MaxError(CurveCopy, Times, Values) <= ErrorTolerance * 2.f);
+
+	// Steps can't be sampled within any tolerance, such curves are evaluated exactly
+	FRichCurve StepCurve;
+	StepCurve.AddKey(0.0f, 0.0f);
+	StepCurve.AddKey(1.0f, 1.0f);
+	StepCurve.AddKey(2.0f, 0.0f);
+	StepCurve.SetKeyInterpMode(StepCurve.FindKey(0.0f), RCIM_Constant);
+	StepCurve.EnableBakedEvaluation(ErrorTolerance, 256);
+	StepCurve.Eval(Times, Values);
+	TestEqual(TEXT("Curves that can't be baked are evaluated exactly"), MaxError(StepCurve, Times, Values), 0.f);
+
+	AddInfo(FString::Printf(TEXT("%d times. Exact: %.3f ms, baked: %.3f ms"), NumTimes, ExactSeconds * 1000.0, BakedSeconds * 1000.0));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
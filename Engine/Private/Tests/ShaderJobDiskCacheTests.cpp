@@ -0,0 +1,75 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "ShaderCompiler/ShaderJobDiskCache.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+namespace ShaderJobDiskCacheTestsPrivate
+{
+	static FSharedBuffer MakeOutput(uint8 Seed, int32 Size)
+	{
+		FUniqueBuffer Output = FUniqueBuffer::Alloc(Size);
+		uint8* Bytes = static_cast<uint8*>(Output.GetData());
+		for (int32 Index = 0; Index < Size; ++Index)
+		{
+			Bytes[Index] = static_cast<uint8>(Seed + Index * 31);
+		}
+		return Output.MoveToShared();
+	}
+
+	static FBlake3Hash HashOutput(const FSharedBuffer& Output)
+	{
+		return FBlake3::HashBuffer(Output.GetData(), Output.GetSize());
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShaderJobDiskCacheTest, "System.Engine.ShaderCompiler.JobDiskCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FShaderJobDiskCacheTest::RunTest(const FString& Parameters)
+{
+	using namespace ShaderJobDiskCacheTestsPrivate;
+
+	const FString CacheDirectory = FPaths::AutomationTransientDir() / TEXT("ShaderJobDiskCacheTest");
+	IFileManager::Get().DeleteDirectory(*CacheDirectory, false, true);
+
+	const FBlake3Hash InputHashA = FBlake3::HashBuffer(TEXT("A"), sizeof(TCHAR));
+	const FBlake3Hash InputHashB = FBlake3::HashBuffer(TEXT("B"), sizeof(TCHAR));
+	const FBlake3Hash InputHashC = FBlake3::HashBuffer(TEXT("C"), sizeof(TCHAR));
+	const FSharedBuffer Output = MakeOutput(7, 4096);
+	const FBlake3Hash OutputHash = HashOutput(Output);
+
+	{
+		FShaderJobDiskCache DiskCache(CacheDirectory);
+		FBlake3Hash FoundOutputHash;
+		TestTrue(TEXT("Empty cache misses"), DiskCache.Find(InputHashA, FoundOutputHash).IsNull());
+
+		// Two inputs with the same output share it on disk
+		DiskCache.Add(InputHashA, OutputHash, Output);
+		DiskCache.Add(InputHashB, OutputHash, Output);
+		DiskCache.Flush();
+
+		TestEqual(TEXT("Deduplicated output size"), DiskCache.GetSize(), Output.GetSize());
+	}
+
+	{
+		// A new instance, as in the next editor session, finds the outputs through the saved index
+		FShaderJobDiskCache DiskCache(CacheDirectory);
+
+		FBlake3Hash FoundOutputHash;
+		const FSharedBuffer FoundOutput = DiskCache.Find(InputHashB, FoundOutputHash);
+		TestTrue(TEXT("Output is found after reloading"), !FoundOutput.IsNull() && FoundOutput.GetView().EqualBytes(Output.GetView()));
+		TestTrue(TEXT("Found output hash"), FoundOutputHash == OutputHash);
+		TestTrue(TEXT("Unknown input misses"), DiskCache.Find(InputHashC, FoundOutputHash).IsNull());
+		TestEqual(TEXT("Hits"), DiskCache.GetNumHits(), uint64(1));
+		TestEqual(TEXT("Queries"), DiskCache.GetNumQueries(), uint64(2));
+	}
+
+	IFileManager::Get().DeleteDirectory(*CacheDirectory, false, true);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
@@ -0,0 +1,225 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "WorldPartitionRuntimeSpatialHashTestTypes.h"
+#include "WorldPartition/WorldPartitionRuntimeSpatialHash.h"
+#include "WorldPartition/RuntimeSpatialHash/RuntimeSpatialHashGridHelper.h"
+#include "UObject/Package.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(WorldPartitionRuntimeSpatialHashTestTypes)
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#define TEST_NAME_ROOT "System.Engine.WorldPartition"
+
+namespace WorldPartitionTests
+{
+	IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWorldPartitionRuntimeSpatialHashIncrementalTest, TEST_NAME_ROOT ".RuntimeSpatialHash.GetCellsIncremental", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+	// Streaming source info accumulated by a cell during a query, defaults to the values of a cell without info
+	struct FCellSourceInfo
+	{
+		uint8 MinSourcePriority = MAX_uint8;
+		bool bWasRequestedByBlockingSource = false;
+		double MinSquareDistanceToBlockingSource = MAX_dbl;
+		double MinSpatialSortingPriority = MAX_dbl;
+
+		bool operator==(const FCellSourceInfo& Other) const
+		{
+			return (MinSourcePriority == Other.MinSourcePriority)
+				&& (bWasRequestedByBlockingSource == Other.bWasRequestedByBlockingSource)
+				&& (MinSquareDistanceToBlockingSource == Other.MinSquareDistanceToBlockingSource)
+				&& (MinSpatialSortingPriority == Other.MinSpatialSortingPriority);
+		}
+	};
+
+	struct FQueryResult
+	{
+		TSet<const UWorldPartitionRuntimeCell*> ActivateCells;
+		TSet<const UWorldPartitionRuntimeCell*> LoadCells;
+		// Only cells which didn't reach their target state yet need the streaming source info
+		TMap<const UWorldPartitionRuntimeCell*, FCellSourceInfo> SourceInfos;
+	};
+
+	FQueryResult RunQuery(TFunctionRef<void(UWorldPartitionRuntimeHash::FStreamingSourceCells&, UWorldPartitionRuntimeHash::FStreamingSourceCells&)> Query)
+	{
+		UWorldPartitionRuntimeCellData::DirtyStreamingSourceCacheEpoch();
+
+		UWorldPartitionRuntimeHash::FStreamingSourceCells ActivateCells;
+		UWorldPartitionRuntimeHash::FStreamingSourceCells LoadCells;
+		Query(ActivateCells, LoadCells);
+
+		FQueryResult Result;
+		Result.ActivateCells = ActivateCells.GetCells();
+		Result.LoadCells = LoadCells.GetCells();
+
+		auto GatherSourceInfos = [&Result](const TSet<const UWorldPartitionRuntimeCell*>& Cells)
+		{
+			for (const UWorldPartitionRuntimeCell* Cell : Cells)
+			{
+				const EWorldPartitionRuntimeCellState TargetState = Result.ActivateCells.Contains(Cell) ? EWorldPartitionRuntimeCellState::Activated : EWorldPartitionRuntimeCellState::Loaded;
+				if (Cell->GetCurrentState() != TargetState)
+				{
+					FCellSourceInfo& Info = Result.SourceInfos.Add(Cell);
+
+					// Cells which didn't get any info in this query keep the ones of a previous epoch
+					const UWorldPartitionRuntimeCellData* CellData = Cell->RuntimeCellData;
+					if (CellData->CachedSourceInfoEpoch == UWorldPartitionRuntimeCellData::StreamingSourceCacheEpoch)
+					{
+						Info.MinSourcePriority = CellData->CachedMinSourcePriority;
+						Info.bWasRequestedByBlockingSource = CellData->bCachedWasRequestedByBlockingSource;
+						Info.MinSquareDistanceToBlockingSource = CellData->CachedMinSquareDistanceToBlockingSource;
+						Info.MinSpatialSortingPriority = CellData->CachedMinSpatialSortingPriority;
+					}
+				}
+			}
+		};
+
+		GatherSourceInfos(Result.ActivateCells);
+		GatherSourceInfos(Result.LoadCells);
+		return Result;
+	}
+
+	bool FWorldPartitionRuntimeSpatialHashIncrementalTest::RunTest(const FString& Parameters)
+	{
+		FSpatialHashStreamingGrid Grid;
+		Grid.GridName = TEXT("IncrementalTestGrid");
+		Grid.CellSize = 1000;
+		Grid.LoadingRange = 2500.0f;
+		Grid.WorldBounds = FBox(FVector(-16000, -16000, -1000), FVector(16000, 16000, 1000));
+		Grid.GridLevels.SetNum(FSquare2DGridHelper(Grid.WorldBounds, Grid.Origin, Grid.CellSize, Grid.Settings.bUseAlignedGridLevels).Levels.Num());
+
+		FRandomStream RandomStream(0x1C3E);
+		TArray<UWorldPartitionRuntimeSpatialHashTestCell*> Cells;
+
+		auto AddCell = [&Grid, &Cells](const FGridCellCoord& Coords)
+		{
+			UWorldPartitionRuntimeSpatialHashTestCell* Cell = NewObject<UWorldPartitionRuntimeSpatialHashTestCell>(GetTransientPackage());
+			Cell->RuntimeCellData = NewObject<UWorldPartitionRuntimeCellData>(Cell);
+
+			FBox2D CellBounds;
+			Grid.GetGridHelper().GetCellBounds(Coords, CellBounds);
+			Cell->RuntimeCellData->ContentBounds = FBox(FVector(CellBounds.Min, -100), FVector(CellBounds.Max, 100));
+
+			verify(Grid.InsertGridCell(Cell, Coords));
+			Cells.Add(Cell);
+		};
+
+		// Sparse cells on all the levels, the top level ones are not spatially loaded
+		for (int32 Level = 0; Level < Grid.GridLevels.Num(); ++Level)
+		{
+			const int64 GridSize = Grid.GetGridHelper().Levels[Level].GridSize;
+			for (int64 Y = 0; Y < GridSize; ++Y)
+			{
+				for (int64 X = 0; X < GridSize; ++X)
+				{
+					if (RandomStream.FRand() < 0.75f)
+					{
+						AddCell(FGridCellCoord(X, Y, Level));
+					}
+				}
+			}
+		}
+
+		// Loading and activating sources start with different priorities, so that cells missing some of their info don't compare equal
+		const int32 NumSources = 6;
+		TArray<FWorldPartitionStreamingSource> AllSources;
+		TArray<bool> SourceEnabled;
+		for (int32 SourceIndex = 0; SourceIndex < NumSources; ++SourceIndex)
+		{
+			const bool bActivate = !!(SourceIndex % 2);
+			const FVector Location(RandomStream.FRandRange(-8000, 8000), RandomStream.FRandRange(-8000, 8000), 0);
+			AllSources.Emplace(FName(TEXT("IncrementalTestSource"), SourceIndex), Location, FRotator(0, RandomStream.FRandRange(0, 360), 0),
+				bActivate ? EStreamingSourceTargetState::Activated : EStreamingSourceTargetState::Loaded, /*bBlockOnSlowLoading*/ (SourceIndex % 3) == 0,
+				bActivate ? EStreamingSourcePriority::Normal : EStreamingSourcePriority::High, /*bRemote*/ false);
+			SourceEnabled.Add(true);
+		}
+
+		// A source made of a sector and a smaller sphere, intersecting cells with different shape masks
+		FStreamingSourceShape& SectorShape = AllSources[0].Shapes.AddDefaulted_GetRef();
+		SectorShape.bIsSector = true;
+		SectorShape.SectorAngle = 90.0f;
+		FStreamingSourceShape& SphereShape = AllSources[0].Shapes.AddDefaulted_GetRef();
+		SphereShape.LoadingRangeScale = 0.5f;
+
+		const TArray<EWorldPartitionRuntimeCellState> CellStates = { EWorldPartitionRuntimeCellState::Unloaded, EWorldPartitionRuntimeCellState::Loaded, EWorldPartitionRuntimeCellState::Activated };
+		const int32 NumUpdates = 200;
+		for (int32 Update = 0; Update < NumUpdates; ++Update)
+		{
+			TArray<FWorldPartitionStreamingSource> Sources;
+			for (int32 SourceIndex = 0; SourceIndex < NumSources; ++SourceIndex)
+			{
+				FWorldPartitionStreamingSource& Source = AllSources[SourceIndex];
+				const float Action = RandomStream.FRand();
+				if (Action < 0.05f)
+				{
+					SourceEnabled[SourceIndex] = !SourceEnabled[SourceIndex];
+				}
+				else if (Action < 0.1f)
+				{
+					Source.TargetState = (Source.TargetState == EStreamingSourceTargetState::Activated) ? EStreamingSourceTargetState::Loaded : EStreamingSourceTargetState::Activated;
+				}
+				else if (Action < 0.6f)
+				{
+					Source.Location += FVector(RandomStream.FRandRange(-1500, 1500), RandomStream.FRandRange(-1500, 1500), 0);
+					Source.Location = Source.Location.BoundToBox(Grid.WorldBounds.Min, Grid.WorldBounds.Max);
+				}
+				else if (Action < 0.7f)
+				{
+					Source.Rotation.Yaw += 30.0f;
+				}
+
+				if (SourceEnabled[SourceIndex])
+				{
+					Sources.Add(Source);
+				}
+			}
+
+			for (UWorldPartitionRuntimeSpatialHashTestCell* Cell : Cells)
+			{
+				Cell->TestCurrentState = CellStates[RandomStream.RandHelper(CellStates.Num())];
+			}
+
+			// Cells inserted in the grid must be picked up by the next incremental query
+			if (Update == NumUpdates / 2)
+			{
+				FGridCellCoord2 Coords;
+				if (Grid.GetGridHelper().Levels[0].GetCellCoords(FVector2D(AllSources[1].Location), Coords))
+				{
+					AddCell(FGridCellCoord(Coords.X, Coords.Y, 0));
+				}
+			}
+
+			bool bUsedIncrementalQuery = false;
+			const FQueryResult IncrementalResult = RunQuery([&](UWorldPartitionRuntimeHash::FStreamingSourceCells& OutActivateCells, UWorldPartitionRuntimeHash::FStreamingSourceCells& OutLoadCells)
+			{
+				bUsedIncrementalQuery = Grid.GetCellsIncremental(Sources, OutActivateCells, OutLoadCells, /*bEnableZCulling*/ false);
+			});
+
+			const FQueryResult FullResult = RunQuery([&](UWorldPartitionRuntimeHash::FStreamingSourceCells& OutActivateCells, UWorldPartitionRuntimeHash::FStreamingSourceCells& OutLoadCells)
+			{
+				Grid.GetCells(Sources, OutActivateCells, OutLoadCells, /*bEnableZCulling*/ false);
+			});
+
+			const bool bSameActivateCells = (IncrementalResult.ActivateCells.Num() == FullResult.ActivateCells.Num()) && IncrementalResult.ActivateCells.Includes(FullResult.ActivateCells);
+			const bool bSameLoadCells = (IncrementalResult.LoadCells.Num() == FullResult.LoadCells.Num()) && IncrementalResult.LoadCells.Includes(FullResult.LoadCells);
+			const bool bSameSourceInfos = IncrementalResult.SourceInfos.OrderIndependentCompareEqual(FullResult.SourceInfos);
+
+			TestTrue(FString::Printf(TEXT("Update %d uses the incremental query"), Update), bUsedIncrementalQuery);
+			TestTrue(FString::Printf(TEXT("Update %d activates the same cells"), Update), bSameActivateCells);
+			TestTrue(FString::Printf(TEXT("Update %d loads the same cells"), Update), bSameLoadCells);
+			TestTrue(FString::Printf(TEXT("Update %d gives the same streaming source info"), Update), bSameSourceInfos);
+
+			if (!bUsedIncrementalQuery || !bSameActivateCells || !bSameLoadCells || !bSameSourceInfos)
+			{
+				break;
+			}
+		}
+
+		return true;
+	}
+}
+
+#undef TEST_NAME_ROOT
+
+#endif
@@ -0,0 +1,22 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "WorldPartition/WorldPartitionRuntimeLevelStreamingCell.h"
+#include "WorldPartitionRuntimeSpatialHashTestTypes.generated.h"
+
+/** Runtime cell whose current state is set by the tests instead of coming from its level streaming */
+UCLASS()
+class UWorldPartitionRuntimeSpatialHashTestCell : public UWorldPartitionRuntimeLevelStreamingCell
+{
+	GENERATED_BODY()
+
+public:
+	UWorldPartitionRuntimeSpatialHashTestCell(const FObjectInitializer& ObjectInitializer)
+		: Super(ObjectInitializer)
+	{}
+
+	virtual EWorldPartitionRuntimeCellState GetCurrentState() const override { return TestCurrentState; }
+
+	EWorldPartitionRuntimeCellState TestCurrentState = EWorldPartitionRuntimeCellState::Unloaded;
+};
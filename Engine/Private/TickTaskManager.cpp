@@ -26,6 +26,9 @@ DECLARE_CYCLE_STAT(TEXT("TG_NewlySpawned"), STAT_TG_NewlySpawned, STATGROUP_Tick
 DECLARE_CYCLE_STAT(TEXT("ReleaseTickGroup"), STAT_ReleaseTickGroup, STATGROUP_TickGroups);
 DECLARE_CYCLE_STAT(TEXT("ReleaseTickGroup Block"), STAT_ReleaseTickGroup_Block, STATGROUP_TickGroups);
 DECLARE_CYCLE_STAT(TEXT("CleanupTasksWait"), STAT_CleanupTasksWait, STATGROUP_TickGroups);
+DECLARE_CYCLE_STAT(TEXT("Execute Tick Batch"), STAT_ExecuteTickBatch, STATGROUP_TickGroups);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tick Batches Queued"), STAT_TickBatchesQueued, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Batched"), STAT_TicksBatched, STATGROUP_Game);
 
 CSV_DECLARE_CATEGORY_MODULE_EXTERN(CORE_API, Basic);
 
@@ -64,6 +67,17 @@ static TAutoConsoleVariable<int32> CVarAllowAsyncTickCleanup(
 	0,
 	TEXT("If true, ticks are cleaned up in a task thread."));
 
+static TAutoConsoleVariable<int32> CVarAllowBatchedTicks(
+	TEXT("tick.AllowBatchedTicks"),
+	0,
+	TEXT("If true, tick functions without prerequisites that share a class, tick group range and thread are gathered into contiguous work lists and executed by one task per batch instead of one task per tick function. ")
+	TEXT("Only applies when ticks are not queued concurrently (see tick.AllowConcurrentTickQueue)."));
+
+static TAutoConsoleVariable<int32> CVarTickBatchSize(
+	TEXT("tick.TickBatchSize"),
+	32,
+	TEXT("Maximum number of tick functions executed by a single tick batch task. Larger classes are split into several batches that may run in parallel."));
+
 static float GTimeguardThresholdMS = 0.0f;
 static FAutoConsoleVariableRef CVarLightweightTimeguardThresholdMS(
 	TEXT("tick.LightweightTimeguardThresholdMS"), 
@@ -257,25 +271,102 @@ public:
 		**/
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
-		if (bLogTick)
+		ExecuteTickFunction(Target, Context, bLogTick, bLogTicksShowPrerequistes, CurrentThread, MyCompletionGraphEvent);
+	}
+
+	/**
+	 * Execute a single tick function, shared by individual and batched tick tasks.
+	 * @param	InTarget - Function to tick
+	 * @param	InContext - context to tick in
+	 * @param	CurrentThread - the thread we are running on
+	 * @param	CompletionGraphEvent - completion event of the task executing this tick function
+	 **/
+	static FORCEINLINE void ExecuteTickFunction(FTickFunction* InTarget, const FTickContext& InContext, bool bInLogTick, bool bInLogTicksShowPrerequistes, ENamedThreads::Type CurrentThread, const FGraphEventRef& CompletionGraphEvent)
+	{
+		if (bInLogTick)
 		{
-			UE_LOG(LogTick, Log, TEXT("tick %s [%1d, %1d] %6llu %2d %s"), Target->bHighPriority ? TEXT("*") : TEXT(" "), (int32)Target->GetActualTickGroup(), (int32)Target->GetActualEndTickGroup(), (uint64)GFrameCounter, (int32)CurrentThread, *Target->DiagnosticMessage());
-			if (bLogTicksShowPrerequistes)
+			UE_LOG(LogTick, Log, TEXT("tick %s [%1d, %1d] %6llu %2d %s"), InTarget->bHighPriority ? TEXT("*") : TEXT(" "), (int32)InTarget->GetActualTickGroup(), (int32)InTarget->GetActualEndTickGroup(), (uint64)GFrameCounter, (int32)CurrentThread, *InTarget->DiagnosticMessage());
+			if (bInLogTicksShowPrerequistes)
 			{
-				Target->ShowPrerequistes();
+				InTarget->ShowPrerequistes();
 			}
 		}
-		if (Target->IsTickFunctionEnabled())
+		if (InTarget->IsTickFunctionEnabled())
 		{
 #if DO_TIMEGUARD
-			FTimerNameDelegate NameFunction = FTimerNameDelegate::CreateLambda( [&]{ return FString::Printf(TEXT("Slowtick %s "), *Target->DiagnosticMessage()); } );
+			FTimerNameDelegate NameFunction = FTimerNameDelegate::CreateLambda( [&]{ return FString::Printf(TEXT("Slowtick %s "), *InTarget->DiagnosticMessage()); } );
 			SCOPE_TIME_GUARD_DELEGATE_MS(NameFunction, 4);
 #endif
 			LIGHTWEIGHT_TIME_GUARD_BEGIN(FTickFunctionTask, GTimeguardThresholdMS);
-			Target->ExecuteTick(Target->CalculateDeltaTime(Context), Context.TickType, CurrentThread, MyCompletionGraphEvent);
-			LIGHTWEIGHT_TIME_GUARD_END(FTickFunctionTask, Target->DiagnosticMessage());
+			InTarget->ExecuteTick(InTarget->CalculateDeltaTime(InContext), InContext.TickType, CurrentThread, CompletionGraphEvent);
+			LIGHTWEIGHT_TIME_GUARD_END(FTickFunctionTask, InTarget->DiagnosticMessage());
+		}
+		InTarget->InternalData->TaskPointer = nullptr;  // This is stale and a good time to clear it for safety
+		InTarget->InternalData->bIsBatched = false;
+	}
+};
+
+class FTickFunctionBatchTask;
+
+/** Contiguous work list of tick functions without prerequisites that share a class, tick group range and thread **/
+struct FTickFunctionBatch
+{
+	/** Tick functions to execute, in the order they were queued **/
+	TArray<FTickFunction*>					TickFunctions;
+	/** tick context, here thread is desired execution thread **/
+	FTickContext							Context;
+	/** Diagnostic context (usually the class name) shared by every tick function in this batch **/
+	FName									BatchContext;
+	/** Held task that executes this batch **/
+	TGraphTask<FTickFunctionBatchTask>*		Task = nullptr;
+#if STATS
+	/** Per-batch stat, only valid while stats are being collected **/
+	TStatId									StatId;
+#endif
+};
+
+/** Helper class define the task of ticking a batch of tick functions **/
+class FTickFunctionBatchTask
+{
+	/** Batch to tick **/
+	FTickFunctionBatch*		Batch;
+	/** If true, log each tick **/
+	bool					bLogTick;
+	/** If true, log prereqs **/
+	bool					bLogTicksShowPrerequistes;
+public:
+	/** Constructor
+		* @param InBatch - Batch to tick, owned by the sequencer until the end of the frame
+	**/
+	FORCEINLINE FTickFunctionBatchTask(FTickFunctionBatch* InBatch, bool InbLogTick, bool bInLogTicksShowPrerequistes)
+		: Batch(InBatch)
+		, bLogTick(InbLogTick)
+		, bLogTicksShowPrerequistes(bInLogTicksShowPrerequistes)
+	{
+	}
+	static FORCEINLINE TStatId GetStatId()
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FTickFunctionBatchTask, STATGROUP_TaskGraphTasks);
+	}
+	/** return the thread for this task **/
+	FORCEINLINE ENamedThreads::Type GetDesiredThread()
+	{
+		return Batch->Context.Thread;
+	}
+	static FORCEINLINE ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ExecuteTickBatch);
+#if STATS
+		FScopeCycleCounter BatchCycleCounter(Batch->StatId);
+#endif
+		for (FTickFunction* Target : Batch->TickFunctions)
+		{
+			FTickFunctionTask::ExecuteTickFunction(Target, Batch->Context, bLogTick, bLogTicksShowPrerequistes, CurrentThread, MyCompletionGraphEvent);
 		}
-		Target->InternalData->TaskPointer = nullptr;  // This is stale and a good time to clear it for safety
 	}
 };
 
@@ -367,6 +458,42 @@ class FTickTaskSequencer
 	/** LowPri Held tasks for each tick group. */
 	TArrayWithThreadsafeAdd<TGraphTask<FTickFunctionTask>*> TickTasks[TG_MAX][TG_MAX];
 
+	/** Held batch tasks for each tick group. */
+	TArray<TGraphTask<FTickFunctionBatchTask>*> BatchedTickTasks[TG_MAX][TG_MAX];
+
+	/** Identifies the batch a tick function is gathered into **/
+	struct FTickBatchKey
+	{
+		FName BatchContext;
+		ENamedThreads::Type Thread;
+		TEnumAsByte<ETickingGroup> StartTickGroup;
+		TEnumAsByte<ETickingGroup> EndTickGroup;
+
+		bool operator==(const FTickBatchKey& Other) const
+		{
+			return BatchContext == Other.BatchContext && Thread == Other.Thread && StartTickGroup == Other.StartTickGroup && EndTickGroup == Other.EndTickGroup;
+		}
+
+		friend uint32 GetTypeHash(const FTickBatchKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.BatchContext), GetTypeHash((uint32(Key.Thread) << 16) | (uint32(Key.StartTickGroup.GetValue()) << 8) | uint32(Key.EndTickGroup.GetValue())));
+		}
+	};
+
+	/** Batches that still accept tick functions; a batch is closed when it is full or its tick group is dispatched **/
+	TMap<FTickBatchKey, FTickFunctionBatch*> OpenTickBatches;
+
+	/** Batches are recycled from frame to frame to avoid reallocating their work lists **/
+	TArray<TUniquePtr<FTickFunctionBatch>> TickBatchPool;
+
+	/** Number of batches from TickBatchPool in use this frame **/
+	int32 NumTickBatchesUsed;
+
+#if STATS
+	/** Cached per-class stats for batches **/
+	TMap<FName, TStatId> TickBatchStatIds;
+#endif
+
 	/** These are waited for at the end of the frame; they are not on the critical path, but they have to be done before we leave the frame. */
 	FGraphEventArray CleanupTasks;
 
@@ -376,6 +503,12 @@ class FTickTaskSequencer
 	/** If true, allow concurrent ticks **/
 	bool				bAllowConcurrentTicks;
 
+	/** If true, tick functions without prerequisites are gathered into batches **/
+	bool				bAllowBatchedTicks;
+
+	/** Maximum number of tick functions per batch **/
+	int32				TickBatchSize;
+
 	/** If true, log each tick **/
 	bool				bLogTicks;
 	/** If true, log each tick **/
@@ -421,26 +554,106 @@ public:
 		checkSlow(TickFunction->InternalData->ActualStartTickGroup >=0 && TickFunction->InternalData->ActualStartTickGroup < TG_MAX);
 
 		FTickContext UseContext = TickContext;
+		UseContext.Thread = GetTickFunctionThread(TickFunction);
+
+		TickFunction->InternalData->TaskPointer = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndHold(TickFunction, &UseContext, bLogTicks, bLogTicksShowPrerequistes);
+		TickFunction->InternalData->bIsBatched = false;
+	}
 
+	/** Return the desired execution thread for a tick function that has been assigned its actual tick group **/
+	FORCEINLINE ENamedThreads::Type GetTickFunctionThread(const FTickFunction* TickFunction) const
+	{
 		bool bIsOriginalTickGroup = (TickFunction->InternalData->ActualStartTickGroup == TickFunction->TickGroup);
 
 		if (TickFunction->bRunOnAnyThread && bAllowConcurrentTicks && bIsOriginalTickGroup)
 		{
 			if (TickFunction->bHighPriority)
 			{
-				UseContext.Thread = CPrio_HiPriAsyncTickTaskPriority.Get();
+				return CPrio_HiPriAsyncTickTaskPriority.Get();
 			}
 			else
 			{
-				UseContext.Thread = CPrio_NormalAsyncTickTaskPriority.Get();
+				return CPrio_NormalAsyncTickTaskPriority.Get();
 			}
 		}
-		else
+		return ENamedThreads::SetTaskPriority(ENamedThreads::GameThread, TickFunction->bHighPriority ? ENamedThreads::HighTaskPriority : ENamedThreads::NormalTaskPriority);
+	}
+
+	/**
+	 * Return true if a tick function can be gathered into a batch. Only functions without prerequisites that run in their original tick group
+	 * are batched; tick functions that depend on a batched function wait for the whole batch.
+	 */
+	FORCEINLINE bool CanBatchTickFunction(const FGraphEventArray* Prerequisites, const FTickFunction* TickFunction) const
+	{
+		return bAllowBatchedTicks
+			&& (!Prerequisites || Prerequisites->Num() == 0)
+			&& TickFunction->InternalData->ActualStartTickGroup == TickFunction->TickGroup;
+	}
+
+	/**
+	 * Add a tick function to the open batch for its class, tick group range and thread, starting a new held batch task if needed
+	 *
+	 * @param	TickFunction - the tick function to queue
+	 * @param	Context - tick context to tick in. Thread here is the current thread.
+	 */
+	void QueueBatchedTickTask(FTickFunction* TickFunction, const FTickContext& TickContext)
+	{
+		FTickBatchKey Key;
+		Key.BatchContext = TickFunction->DiagnosticContext(false);
+		Key.Thread = GetTickFunctionThread(TickFunction);
+		Key.StartTickGroup = TickFunction->InternalData->ActualStartTickGroup;
+		Key.EndTickGroup = TickFunction->InternalData->ActualEndTickGroup;
+		checkSlow(Key.StartTickGroup >= 0 && Key.StartTickGroup < TG_MAX && Key.EndTickGroup >= 0 && Key.EndTickGroup < TG_MAX && Key.StartTickGroup <= Key.EndTickGroup);
+
+		FTickFunctionBatch* Batch = OpenTickBatches.FindRef(Key);
+		if (!Batch)
 		{
-			UseContext.Thread = ENamedThreads::SetTaskPriority(ENamedThreads::GameThread, TickFunction->bHighPriority ? ENamedThreads::HighTaskPriority : ENamedThreads::NormalTaskPriority);
+			Batch = AllocateTickBatch(Key, TickContext);
+			OpenTickBatches.Add(Key, Batch);
 		}
 
-		TickFunction->InternalData->TaskPointer = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndHold(TickFunction, &UseContext, bLogTicks, bLogTicksShowPrerequistes);
+		Batch->TickFunctions.Add(TickFunction);
+		TickFunction->InternalData->TaskPointer = Batch->Task;
+		TickFunction->InternalData->bIsBatched = true;
+		INC_DWORD_STAT(STAT_TicksBatched);
+
+		if (Batch->TickFunctions.Num() >= TickBatchSize)
+		{
+			// the next tick function with this key starts a new batch, which can run in parallel with this one
+			OpenTickBatches.Remove(Key);
+		}
+	}
+
+	/** Grab a batch from the pool and create its held task **/
+	FTickFunctionBatch* AllocateTickBatch(const FTickBatchKey& Key, const FTickContext& TickContext)
+	{
+		if (NumTickBatchesUsed == TickBatchPool.Num())
+		{
+			TickBatchPool.Add(MakeUnique<FTickFunctionBatch>());
+		}
+		FTickFunctionBatch* Batch = TickBatchPool[NumTickBatchesUsed++].Get();
+		Batch->TickFunctions.Reset(TickBatchSize);
+		Batch->Context = TickContext;
+		Batch->Context.Thread = Key.Thread;
+		Batch->BatchContext = Key.BatchContext;
+#if STATS
+		Batch->StatId = TStatId();
+		if (FThreadStats::IsCollectingData())
+		{
+			TStatId* StatId = TickBatchStatIds.Find(Key.BatchContext);
+			if (!StatId)
+			{
+				StatId = &TickBatchStatIds.Add(Key.BatchContext, FDynamicStats::CreateStatId<FStatGroup_STATGROUP_TickGroups>(FString::Printf(TEXT("TickBatch %s"), *Key.BatchContext.ToString())));
+			}
+			Batch->StatId = *StatId;
+		}
+#endif
+		Batch->Task = TGraphTask<FTickFunctionBatchTask>::CreateTask(nullptr, TickContext.Thread).ConstructAndHold(Batch, bLogTicks, bLogTicksShowPrerequistes);
+
+		BatchedTickTasks[Key.StartTickGroup][Key.EndTickGroup].Add(Batch->Task);
+		TickCompletionEvents[Key.EndTickGroup].Add(Batch->Task->GetCompletionEvent());
+		INC_DWORD_STAT(STAT_TickBatchesQueued);
+		return Batch;
 	}
 
 	/** Add a completion handle to a tick group **/
@@ -495,6 +708,11 @@ public:
 	{
 		checkSlow(TickFunction->InternalData);
 		checkSlow(TickContext.Thread == ENamedThreads::GameThread);
+		if (CanBatchTickFunction(Prerequisites, TickFunction))
+		{
+			QueueBatchedTickTask(TickFunction, TickContext);
+			return;
+		}
 		StartTickTask(Prerequisites, TickFunction, TickContext);
 		TGraphTask<FTickFunctionTask>* Task = (TGraphTask<FTickFunctionTask>*)TickFunction->InternalData->TaskPointer;
 		AddTickTaskCompletion(TickFunction->InternalData->ActualStartTickGroup, TickFunction->InternalData->ActualEndTickGroup, Task, TickFunction->bHighPriority);
@@ -596,17 +814,25 @@ public:
 			bAllowConcurrentTicks = !!CVarAllowAsyncComponentTicks.GetValueOnGameThread();
 		}
 
+		bAllowBatchedTicks = !!CVarAllowBatchedTicks.GetValueOnGameThread();
+		TickBatchSize = FMath::Max(1, CVarTickBatchSize.GetValueOnGameThread());
+
 		WaitForCleanup();
 
+		// all batch tasks completed in the previous frame, their work lists can be reused
+		check(!OpenTickBatches.Num());
+		NumTickBatchesUsed = 0;
+
 		for (int32 Index = 0; Index < TG_MAX; Index++)
 		{
 			check(!TickCompletionEvents[Index].Num());  // we should not be adding to these outside of a ticking proper and they were already cleared after they were ticked
 			TickCompletionEvents[Index].Reset();
 			for (int32 IndexInner = 0; IndexInner < TG_MAX; IndexInner++)
 			{
-				check(!TickTasks[Index][IndexInner].Num() && !HiPriTickTasks[Index][IndexInner].Num());  // we should not be adding to these outside of a ticking proper and they were already cleared after they were ticked
+				check(!TickTasks[Index][IndexInner].Num() && !HiPriTickTasks[Index][IndexInner].Num() && !BatchedTickTasks[Index][IndexInner].Num());  // we should not be adding to these outside of a ticking proper and they were already cleared after they were ticked
 				TickTasks[Index][IndexInner].Reset();
 				HiPriTickTasks[Index][IndexInner].Reset();
+				BatchedTickTasks[Index][IndexInner].Reset();
 			}
 		}
 		WaitForTickGroup = (ETickingGroup)0;
@@ -620,11 +846,15 @@ public:
 		{
 			UE_LOG(LogTick, Log, TEXT("tick %6llu ---------------------------------------- End Frame"),(uint64)GFrameCounter);
 		}
+		OpenTickBatches.Reset();
 	}
 private:
 
 	FTickTaskSequencer()
-		: bAllowConcurrentTicks(false)
+		: NumTickBatchesUsed(0)
+		, bAllowConcurrentTicks(false)
+		, bAllowBatchedTicks(false)
+		, TickBatchSize(1)
 		, bLogTicks(false)
 		, bLogTicksShowPrerequistes(false)
 	{
@@ -658,6 +888,33 @@ private:
 	void DispatchTickGroup(ENamedThreads::Type CurrentThread, ETickingGroup WorldTickGroup)
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_DispatchTickGroup);
+		if (OpenTickBatches.Num())
+		{
+			// nothing can be added to a batch once its task has been released
+			for (TMap<FTickBatchKey, FTickFunctionBatch*>::TIterator It(OpenTickBatches); It; ++It)
+			{
+				if (It.Key().StartTickGroup == WorldTickGroup)
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+		for (int32 IndexInner = 0; IndexInner < TG_MAX; IndexInner++)
+		{
+			TArray<TGraphTask<FTickFunctionBatchTask>*>& BatchArray = BatchedTickTasks[WorldTickGroup][IndexInner]; //-V781
+			if (IndexInner < WorldTickGroup)
+			{
+				check(BatchArray.Num() == 0); // makes no sense to have and end TG before the start TG
+			}
+			else
+			{
+				for (int32 Index = 0; Index < BatchArray.Num(); Index++)
+				{
+					BatchArray[Index]->Unlock(CurrentThread);
+				}
+			}
+			BatchArray.Reset();
+		}
 		for (int32 IndexInner = 0; IndexInner < TG_MAX; IndexInner++)
 		{
 			TArray<TGraphTask<FTickFunctionTask>*>& TickArray = HiPriTickTasks[WorldTickGroup][IndexInner]; //-V781
@@ -1815,6 +2072,7 @@ FTickFunction::FTickFunction()
 FTickFunction::FInternalData::FInternalData()
 	: bRegistered(false)
 	, bWasInterval(false)
+	, bIsBatched(false)
 	, ActualStartTickGroup(TG_PrePhysics)
 	, ActualEndTickGroup(TG_PrePhysics)
 	, TickVisitedGFrameCounter(0)
@@ -1959,6 +2217,11 @@ void FTickFunction::ShowPrerequistes(int32 Indent)
 FGraphEventRef FTickFunction::GetCompletionHandle() const
 {
 	check(InternalData->TaskPointer);
+	if (InternalData->bIsBatched)
+	{
+		TGraphTask<FTickFunctionBatchTask>* BatchTask = (TGraphTask<FTickFunctionBatchTask>*)InternalData->TaskPointer;
+		return BatchTask->GetCompletionEvent();
+	}
 	TGraphTask<FTickFunctionTask>* Task = (TGraphTask<FTickFunctionTask>*)InternalData->TaskPointer;
 	return Task->GetCompletionEvent();
 }
@@ -43,6 +43,20 @@ static FAutoConsoleVariableRef CVarDumpTimerLogSymbolNames(
 	TEXT("When logging timer info, symbol names will be included if set to 1."),
 	ECVF_Default);
 
+static bool GUseTimingWheel = false;
+static FAutoConsoleVariableRef CVarUseTimingWheel(
+	TEXT("TimerManager.UseTimingWheel"),
+	GUseTimingWheel,
+	TEXT("If true, timer managers created afterwards keep their active timers in a hierarchical timing wheel (O(1) insert and cancel, bucketed expiry) instead of a binary heap."),
+	ECVF_Default);
+
+static float GTimingWheelResolution = 1.f / 120.f;
+static FAutoConsoleVariableRef CVarTimingWheelResolution(
+	TEXT("TimerManager.TimingWheelResolution"),
+	GTimingWheelResolution,
+	TEXT("Width in seconds of a bucket of the timer manager timing wheel. Only affects timer managers created afterwards."),
+	ECVF_Default);
+
 static int32 MaxExpiredTimersToLog = 30;
 static FAutoConsoleVariableRef CVarMaxExpiredTimersToLog(
 	TEXT("TimerManager.MaxExpiredTimersToLog"), 
@@ -257,11 +271,232 @@ struct FTimerHeapOrder
 	int32 NumTimers;
 };
 
+/**
+ * Hierarchical timing wheel holding the active timers of a timer manager.
+ *
+ * Expire times are quantized to Resolution and bucketed into NumLevels wheels of NumSlots slots, each level covering NumSlots times the range of the
+ * one below. Scheduling a timer is an append to a bucket, and advancing the clock only visits the buckets it passes, cascading higher level buckets
+ * down as their range comes up. Entries are never removed eagerly: cleared, paused or rescheduled timers leave stale entries behind, which are
+ * recognized through the timer's handle, status and schedule serial and dropped when their bucket is reached.
+ */
+struct FTimerWheel
+{
+	static constexpr int32 SlotBits = 8;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr uint64 SlotMask = NumSlots - 1;
+	static constexpr int32 NumLevels = 4;
+
+	struct FEntry
+	{
+		FTimerHandle Handle;
+		double ExpireTime;
+		uint32 ScheduleSerial;
+	};
+
+	explicit FTimerWheel(double InResolution)
+		: InvResolution(1.0 / FMath::Max(InResolution, UE_DOUBLE_KINDA_SMALL_NUMBER))
+		, CurrentTick(0)
+		, NumSlotEntries(0)
+		, NextExpiredIndex(0)
+	{
+	}
+
+	/** Returns true if the entry still refers to the scheduling of an active timer */
+	static bool IsEntryValid(const TSparseArray<FTimerData>& Timers, const FEntry& Entry)
+	{
+		const int32 Index = Entry.Handle.GetIndex();
+		if (!Timers.IsValidIndex(Index))
+		{
+			return false;
+		}
+		const FTimerData& Data = Timers[Index];
+		return Data.Handle == Entry.Handle && Data.Status == ETimerStatus::Active && Data.ScheduleSerial == Entry.ScheduleSerial;
+	}
+
+	void Insert(FTimerHandle Handle, const FTimerData& Data)
+	{
+		InsertEntry(FEntry{ Handle, Data.ExpireTime, Data.ScheduleSerial });
+	}
+
+	/** Moves the clock forward to Time and gathers every valid entry expiring strictly before Time, sorted by expire time */
+	void Advance(double Time, const TSparseArray<FTimerData>& Timers)
+	{
+		Expired.Reset();
+		NextExpiredIndex = 0;
+
+		const uint64 TargetTick = TimeToTick(Time);
+		if (NumSlotEntries == 0)
+		{
+			// nothing is bucketed, no need to walk the slots
+			CurrentTick = FMath::Max(CurrentTick, TargetTick);
+		}
+		while (CurrentTick < TargetTick)
+		{
+			++CurrentTick;
+
+			// cascade the higher level buckets whose range starts at this tick
+			for (int32 Level = 1; Level < NumLevels && (CurrentTick & ((uint64(1) << (Level * SlotBits)) - 1)) == 0; ++Level)
+			{
+				Cascade(Level, Timers);
+			}
+
+			TArray<FEntry>& Slot = Slots[0][CurrentTick & SlotMask];
+			if (Slot.Num())
+			{
+				NumSlotEntries -= Slot.Num();
+				DueEntries.Append(Slot);
+				Slot.Reset();
+			}
+
+			if (NumSlotEntries == 0)
+			{
+				CurrentTick = TargetTick;
+			}
+		}
+
+		// entries in the current bucket are due, but only the ones before Time have expired
+		for (int32 DueIndex = 0; DueIndex < DueEntries.Num(); )
+		{
+			const FEntry& Entry = DueEntries[DueIndex];
+			if (!IsEntryValid(Timers, Entry))
+			{
+				DueEntries.RemoveAtSwap(DueIndex, 1, EAllowShrinking::No);
+			}
+			else if (Time > Entry.ExpireTime)
+			{
+				Expired.Add(Entry);
+				DueEntries.RemoveAtSwap(DueIndex, 1, EAllowShrinking::No);
+			}
+			else
+			{
+				++DueIndex;
+			}
+		}
+
+		Expired.Sort([](const FEntry& A, const FEntry& B) { return A.ExpireTime < B.ExpireTime; });
+	}
+
+	/** Returns the next gathered expired entry that is still valid */
+	bool PopExpired(const TSparseArray<FTimerData>& Timers, FTimerHandle& OutHandle)
+	{
+		while (NextExpiredIndex < Expired.Num())
+		{
+			const FEntry& Entry = Expired[NextExpiredIndex++];
+			if (IsEntryValid(Timers, Entry))
+			{
+				OutHandle = Entry.Handle;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	int32 Num() const
+	{
+		return NumSlotEntries + DueEntries.Num() + (Expired.Num() - NextExpiredIndex);
+	}
+
+	void GetValidHandles(const TSparseArray<FTimerData>& Timers, TArray<FTimerHandle>& OutHandles) const
+	{
+		auto AddValidHandles = [&Timers, &OutHandles](const TArray<FEntry>& Entries, int32 StartIndex)
+		{
+			for (int32 Index = StartIndex; Index < Entries.Num(); ++Index)
+			{
+				if (IsEntryValid(Timers, Entries[Index]))
+				{
+					OutHandles.Add(Entries[Index].Handle);
+				}
+			}
+		};
+
+		AddValidHandles(Expired, NextExpiredIndex);
+		AddValidHandles(DueEntries, 0);
+		for (int32 Level = 0; Level < NumLevels; ++Level)
+		{
+			for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+			{
+				AddValidHandles(Slots[Level][SlotIndex], 0);
+			}
+		}
+	}
+
+private:
+	uint64 TimeToTick(double Time) const
+	{
+		return static_cast<uint64>(FMath::Max(Time, 0.0) * InvResolution);
+	}
+
+	void InsertEntry(const FEntry& Entry)
+	{
+		const uint64 ExpireTick = TimeToTick(Entry.ExpireTime);
+		if (ExpireTick <= CurrentTick)
+		{
+			DueEntries.Add(Entry);
+			return;
+		}
+
+		const uint64 Delta = ExpireTick - CurrentTick;
+		int32 Level = 0;
+		while (Level < NumLevels - 1 && Delta >= (uint64(1) << ((Level + 1) * SlotBits)))
+		{
+			++Level;
+		}
+
+		// timers beyond the range of the wheel are parked in the furthest bucket of the top level and re-cascaded until they fit
+		const uint64 WheelRange = uint64(1) << (NumLevels * SlotBits);
+		const uint64 SlotTick = Delta < WheelRange ? ExpireTick : CurrentTick + WheelRange - 1;
+
+		Slots[Level][(SlotTick >> (Level * SlotBits)) & SlotMask].Add(Entry);
+		++NumSlotEntries;
+	}
+
+	void Cascade(int32 Level, const TSparseArray<FTimerData>& Timers)
+	{
+		TArray<FEntry>& Slot = Slots[Level][(CurrentTick >> (Level * SlotBits)) & SlotMask];
+		if (Slot.Num())
+		{
+			NumSlotEntries -= Slot.Num();
+
+			// the slot might receive entries again while we re-insert (timers beyond the range of the wheel), so move them out first
+			TArray<FEntry> CascadedEntries = MoveTemp(Slot);
+			for (const FEntry& Entry : CascadedEntries)
+			{
+				if (IsEntryValid(Timers, Entry))
+				{
+					InsertEntry(Entry);
+				}
+			}
+		}
+	}
+
+	double InvResolution;
+	/** All buckets up to and including this tick have been moved to DueEntries */
+	uint64 CurrentTick;
+	/** Number of entries in Slots */
+	int32 NumSlotEntries;
+	TArray<FEntry> Slots[NumLevels][NumSlots];
+	/** Entries whose bucket has been reached but that may not have expired yet */
+	TArray<FEntry> DueEntries;
+	/** Entries gathered by the last Advance, consumed by PopExpired */
+	TArray<FEntry> Expired;
+	int32 NextExpiredIndex;
+};
+
 FTimerManager::FTimerManager(UGameInstance* GameInstance)
+	: FTimerManager(GameInstance, GUseTimingWheel)
+{
+}
+
+FTimerManager::FTimerManager(UGameInstance* GameInstance, bool bInUseTimingWheel)
 	: InternalTime(0.0)
 	, LastTickedFrame(static_cast<uint64>(-1))
 	, OwningGameInstance(nullptr)
 {
+	if (bInUseTimingWheel)
+	{
+		TimingWheel = MakeUnique<FTimerWheel>(GTimingWheelResolution);
+	}
+
 	if (IsRunningDedicatedServer())
 	{
 		// Off by default, reenable if needed
@@ -286,9 +521,12 @@ void FTimerManager::OnCrash()
 {
 	UE_LOG(LogEngine, Warning, TEXT("TimerManager %p on crashing delegate called, dumping extra information"), this);
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Active Timers (including expired) -------"), ActiveTimerHeap.Num());
+	TArray<FTimerHandle> ActiveTimerHandles;
+	GetActiveTimerHandles(ActiveTimerHandles);
+
+	UE_LOG(LogEngine, Log, TEXT("------- %d Active Timers (including expired) -------"), ActiveTimerHandles.Num());
 	int32 ExpiredActiveTimerCount = 0;
-	for (FTimerHandle Handle : ActiveTimerHeap)
+	for (FTimerHandle Handle : ActiveTimerHandles)
 	{
 		const FTimerData& Timer = GetTimer(Handle);
 		if (Timer.Status == ETimerStatus::ActivePendingRemoval)
@@ -316,7 +554,7 @@ void FTimerManager::OnCrash()
 		DescribeFTimerDataSafely(*GLog, Timer);
 	}
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers -------"), PendingTimerSet.Num() + PausedTimerSet.Num() + ActiveTimerHeap.Num() - ExpiredActiveTimerCount);
+	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers -------"), PendingTimerSet.Num() + PausedTimerSet.Num() + ActiveTimerHandles.Num() - ExpiredActiveTimerCount);
 
 	UE_LOG(LogEngine, Warning, TEXT("TimerManager %p dump ended"), this);
 }
@@ -506,7 +744,7 @@ void FTimerManager::InternalSetTimer(FTimerHandle& InOutHandle, FTimerUnifiedDel
 			NewTimerData.ExpireTime = InternalTime + FirstDelay;
 			NewTimerData.Status = ETimerStatus::Active;
 			NewTimerHandle = AddTimer(MoveTemp(NewTimerData));
-			ActiveTimerHeap.HeapPush(NewTimerHandle, FTimerHeapOrder(Timers));
+			ActivateTimer(NewTimerHandle);
 		}
 		else
 		{
@@ -548,7 +786,7 @@ FTimerHandle FTimerManager::InternalSetTimerForNextTick(FTimerUnifiedDelegate&&
 	}
 
 	FTimerHandle NewTimerHandle = AddTimer(MoveTemp(NewTimerData));
-	ActiveTimerHeap.HeapPush(NewTimerHandle, FTimerHeapOrder(Timers));
+	ActivateTimer(NewTimerHandle);
 
 	return NewTimerHandle;
 }
@@ -572,7 +810,15 @@ void FTimerManager::InternalClearTimer(FTimerHandle InHandle)
 			break;
 
 		case ETimerStatus::Active:
-			Data.Status = ETimerStatus::ActivePendingRemoval;
+			if (TimingWheel)
+			{
+				// the wheel entry is left behind and skipped once its bucket is reached
+				RemoveTimer(InHandle);
+			}
+			else
+			{
+				Data.Status = ETimerStatus::ActivePendingRemoval;
+			}
 			break;
 
 		case ETimerStatus::ActivePendingRemoval:
@@ -692,11 +938,7 @@ void FTimerManager::PauseTimer(FTimerHandle InHandle)
 			break;
 
 		case ETimerStatus::Active:
-			{
-				int32 IndexIndex = ActiveTimerHeap.Find(InHandle);
-				check(IndexIndex != INDEX_NONE);
-				ActiveTimerHeap.HeapRemoveAt(IndexIndex, FTimerHeapOrder(Timers), EAllowShrinking::No);
-			}
+			DeactivateTimer(InHandle);
 			break;
 
 		case ETimerStatus::Pending:
@@ -754,7 +996,7 @@ void FTimerManager::UnPauseTimer(FTimerHandle InHandle)
 		// Convert from time remaining back to a valid ExpireTime
 		TimerToUnPause->ExpireTime += InternalTime;
 		TimerToUnPause->Status = ETimerStatus::Active;
-		ActiveTimerHeap.HeapPush(InHandle, FTimerHeapOrder(Timers));
+		ActivateTimer(InHandle);
 	}
 	else
 	{
@@ -774,6 +1016,7 @@ FTimerData::FTimerData()
 	, Rate(0)
 	, ExpireTime(0)
 	, LevelCollection(ELevelCollectionType::DynamicSourceLevels)
+	, ScheduleSerial(0)
 {}
 
 // ---------------------------------
@@ -806,7 +1049,7 @@ void FTimerManager::Tick(float DeltaTime)
 	// @todo, might need to handle long-running case
 	// (e.g. every X seconds, renormalize to InternalTime = 0)
 
-	INC_DWORD_STAT_BY(STAT_NumHeapEntries, ActiveTimerHeap.Num());
+	INC_DWORD_STAT_BY(STAT_NumHeapEntries, GetNumActiveTimerEntries());
 
 	if (HasBeenTickedThisFrame())
 	{
@@ -841,18 +1084,22 @@ void FTimerManager::Tick(float DeltaTime)
 	// Dump timer info to logs if we have way too many timers active.
 	UE_SUPPRESS(LogEngine, Warning,
 	{
-		if (DumpAllTimerLogsThreshold > 0 && ActiveTimerHeap.Num() > DumpAllTimerLogsThreshold)
+		const int32 NumActiveTimerEntries = GetNumActiveTimerEntries();
+		if (DumpAllTimerLogsThreshold > 0 && NumActiveTimerEntries > DumpAllTimerLogsThreshold)
 		{
 			static bool bAlreadyLogged = false;
 			if(!bAlreadyLogged)
 			{
 				bAlreadyLogged = true;
 			
-				UE_LOG(LogEngine, Warning, TEXT("Number of active Timers (%d) has exceeded DumpAllTimerLogsThreshold (%d)!  Dumping all timer info to log:"), ActiveTimerHeap.Num(), DumpAllTimerLogsThreshold);
+				UE_LOG(LogEngine, Warning, TEXT("Number of active Timers (%d) has exceeded DumpAllTimerLogsThreshold (%d)!  Dumping all timer info to log:"), NumActiveTimerEntries, DumpAllTimerLogsThreshold);
+
+				TArray<FTimerHandle> ActiveTimerHandles;
+				GetActiveTimerHandles(ActiveTimerHandles);
 
 				TArray<const FTimerData*> ValidActiveTimers;
-				ValidActiveTimers.Reserve(ActiveTimerHeap.Num());
-				for (FTimerHandle Handle : ActiveTimerHeap)
+				ValidActiveTimers.Reserve(ActiveTimerHandles.Num());
+				for (FTimerHandle Handle : ActiveTimerHandles)
 				{
 					if (const FTimerData* Data = FindTimer(Handle))
 					{
@@ -869,126 +1116,112 @@ void FTimerManager::Tick(float DeltaTime)
 	});
 #endif // #if UE_ENABLE_DUMPALLTIMERLOGSTHRESHOLD
 
-	while (ActiveTimerHeap.Num() > 0)
+	if (TimingWheel)
 	{
-		FTimerHandle TopHandle = ActiveTimerHeap.HeapTop();
-
-		// Test for expired timers
-		int32 TopIndex = TopHandle.GetIndex();
-		FTimerData* Top = &Timers[TopIndex];
+		TimingWheel->Advance(InternalTime, Timers);
+	}
 
-		if (Top->Status == ETimerStatus::ActivePendingRemoval)
-		{
-			ActiveTimerHeap.HeapPop(TopHandle, FTimerHeapOrder(Timers), EAllowShrinking::No);
-			RemoveTimer(TopHandle);
-			continue;
-		}
+	FTimerHandle TopHandle;
+	while (PopExpiredTimer(TopHandle))
+	{
+		// Timer has expired! Fire the delegate, then handle potential looping.
+		FTimerData* Top = &Timers[TopHandle.GetIndex()];
 
-		if (InternalTime > Top->ExpireTime)
+		if (bDumpTimerLogsThresholdExceeded)
 		{
-			// Timer has expired! Fire the delegate, then handle potential looping.
-
-			if (bDumpTimerLogsThresholdExceeded)
+			++NbExpiredTimers;
+			if (NbExpiredTimers <= MaxExpiredTimersToLog)
 			{
-				++NbExpiredTimers;
-				if (NbExpiredTimers <= MaxExpiredTimersToLog)
-				{
-					DescribeFTimerDataSafely(*GLog, *Top);
-				}
+				DescribeFTimerDataSafely(*GLog, *Top);
 			}
+		}
 
-			// Set the relevant level context for this timer
-			const int32 LevelCollectionIndex = OwningWorld ? OwningWorld->FindCollectionIndexByType(Top->LevelCollection) : INDEX_NONE;
-			
-			FScopedLevelCollectionContextSwitch LevelContext(LevelCollectionIndex, LevelCollectionWorld);
+		// Set the relevant level context for this timer
+		const int32 LevelCollectionIndex = OwningWorld ? OwningWorld->FindCollectionIndexByType(Top->LevelCollection) : INDEX_NONE;
+		
+		FScopedLevelCollectionContextSwitch LevelContext(LevelCollectionIndex, LevelCollectionWorld);
 
-			// Remove it from the heap and store it while we're executing
-			ActiveTimerHeap.HeapPop(CurrentlyExecutingTimer, FTimerHeapOrder(Timers), EAllowShrinking::No);
-			Top->Status = ETimerStatus::Executing;
+		// It has been removed from the active timers, store it while we're executing
+		CurrentlyExecutingTimer = TopHandle;
+		Top->Status = ETimerStatus::Executing;
 
-			// Determine how many times the timer may have elapsed (e.g. for large DeltaTime on a short looping timer)
-			int32 const CallCount = Top->bLoop ? 
-				FMath::TruncToInt( (InternalTime - Top->ExpireTime) / Top->Rate ) + 1
-				: 1;
+		// Determine how many times the timer may have elapsed (e.g. for large DeltaTime on a short looping timer)
+		int32 const CallCount = Top->bLoop ? 
+			FMath::TruncToInt( (InternalTime - Top->ExpireTime) / Top->Rate ) + 1
+			: 1;
 
 #if UE_ENABLE_TRACKING_TIMER_SOURCES
-			if (TimerSourceList.IsValid())
-			{
-				//@TODO: The actual call count may be less, e.g., if the delegate clears itself during the loop below
-				TimerSourceList->AddEntry(*Top, CallCount);
-			}
+		if (TimerSourceList.IsValid())
+		{
+			//@TODO: The actual call count may be less, e.g., if the delegate clears itself during the loop below
+			TimerSourceList->AddEntry(*Top, CallCount);
+		}
 #endif
 
-			// Now call the function
-			for (int32 CallIdx=0; CallIdx<CallCount; ++CallIdx)
-			{ 
+		// Now call the function
+		for (int32 CallIdx=0; CallIdx<CallCount; ++CallIdx)
+		{ 
 #if DO_TIMEGUARD && 0
-				FTimerNameDelegate NameFunction = FTimerNameDelegate::CreateLambda([&] { 
-						return FString::Printf(TEXT("FTimerManager slowtick from delegate %s "), *Top->TimerDelegate.ToString());
-					});
-				// no delegate should take longer then 2ms to run 
-				SCOPE_TIME_GUARD_DELEGATE_MS(NameFunction, 2);
+			FTimerNameDelegate NameFunction = FTimerNameDelegate::CreateLambda([&] { 
+					return FString::Printf(TEXT("FTimerManager slowtick from delegate %s "), *Top->TimerDelegate.ToString());
+				});
+			// no delegate should take longer then 2ms to run 
+			SCOPE_TIME_GUARD_DELEGATE_MS(NameFunction, 2);
 #endif
 #if DO_TIMEGUARD && 0
-				RunTimerDelegates.Add(Top->TimerDelegate);
+			RunTimerDelegates.Add(Top->TimerDelegate);
 #endif
 
-				checkf(!WillRemoveTimerAssert(CurrentlyExecutingTimer), TEXT("RemoveTimer(CurrentlyExecutingTimer) - due to fail before Execute()"));
-				Top->TimerDelegate.Execute();
+			checkf(!WillRemoveTimerAssert(CurrentlyExecutingTimer), TEXT("RemoveTimer(CurrentlyExecutingTimer) - due to fail before Execute()"));
+			Top->TimerDelegate.Execute();
 
-				// Update Top pointer, in case it has been invalidated by the Execute call
-				Top = FindTimer(CurrentlyExecutingTimer);
-				checkf(!Top || !WillRemoveTimerAssert(CurrentlyExecutingTimer), TEXT("RemoveTimer(CurrentlyExecutingTimer) - due to fail after Execute()"));
-				if (!Top || Top->Status != ETimerStatus::Executing || Top->bMaxOncePerFrame)
-				{
-					break;
-				}
+			// Update Top pointer, in case it has been invalidated by the Execute call
+			Top = FindTimer(CurrentlyExecutingTimer);
+			checkf(!Top || !WillRemoveTimerAssert(CurrentlyExecutingTimer), TEXT("RemoveTimer(CurrentlyExecutingTimer) - due to fail after Execute()"));
+			if (!Top || Top->Status != ETimerStatus::Executing || Top->bMaxOncePerFrame)
+			{
+				break;
 			}
+		}
 
-			if (DumpTimerLogsThreshold > 0.f && !bDumpTimerLogsThresholdExceeded)
+		if (DumpTimerLogsThreshold > 0.f && !bDumpTimerLogsThresholdExceeded)
+		{
+			// help us hunt down outliers that cause our timer manager times to spike.  Recommended that users set meaningful DumpTimerLogsThresholds in appropriate ini files if they are seeing spikes in the timer manager.
+			const double DeltaT = (FPlatformTime::Seconds() - StartTime) * 1000.f;
+			if (DeltaT >= DumpTimerLogsThreshold)
 			{
-				// help us hunt down outliers that cause our timer manager times to spike.  Recommended that users set meaningful DumpTimerLogsThresholds in appropriate ini files if they are seeing spikes in the timer manager.
-				const double DeltaT = (FPlatformTime::Seconds() - StartTime) * 1000.f;
-				if (DeltaT >= DumpTimerLogsThreshold)
-				{
-					bDumpTimerLogsThresholdExceeded = true;
+				bDumpTimerLogsThresholdExceeded = true;
                     ++NbExpiredTimers;
-					UE_LOG(LogEngine, Log, TEXT("TimerManager's time threshold of %.2fms exceeded with a deltaT of %.4f, dumping current timer data."), DumpTimerLogsThreshold, DeltaT);
-
-					if (Top)
-					{
-						DescribeFTimerDataSafely(*GLog, *Top);
-					}
-					else
-					{
-						UE_LOG(LogEngine, Log, TEXT("There was no timer data for the first timer after exceeding the time threshold!"));
-					}
-				}
-			}
+				UE_LOG(LogEngine, Log, TEXT("TimerManager's time threshold of %.2fms exceeded with a deltaT of %.4f, dumping current timer data."), DumpTimerLogsThreshold, DeltaT);
 
-			// test to ensure it didn't get cleared during execution
-			if (Top)
-			{
-				// if timer requires a delegate, make sure it's still validly bound (i.e. the delegate's object didn't get deleted or something)
-				if (Top->bLoop && (!Top->bRequiresDelegate || Top->TimerDelegate.IsBound()))
+				if (Top)
 				{
-					// Put this timer back on the heap
-					Top->ExpireTime += CallCount * Top->Rate;
-					Top->Status = ETimerStatus::Active;
-					ActiveTimerHeap.HeapPush(CurrentlyExecutingTimer, FTimerHeapOrder(Timers));
+					DescribeFTimerDataSafely(*GLog, *Top);
 				}
 				else
 				{
-					RemoveTimer(CurrentlyExecutingTimer);
+					UE_LOG(LogEngine, Log, TEXT("There was no timer data for the first timer after exceeding the time threshold!"));
 				}
-
-				CurrentlyExecutingTimer.Invalidate();
 			}
 		}
-		else
+
+		// test to ensure it didn't get cleared during execution
+		if (Top)
 		{
-			// no need to go further down the heap, we can be finished
-			break;
+			// if timer requires a delegate, make sure it's still validly bound (i.e. the delegate's object didn't get deleted or something)
+			if (Top->bLoop && (!Top->bRequiresDelegate || Top->TimerDelegate.IsBound()))
+			{
+				// Put this timer back with the active timers
+				Top->ExpireTime += CallCount * Top->Rate;
+				Top->Status = ETimerStatus::Active;
+				ActivateTimer(CurrentlyExecutingTimer);
+			}
+			else
+			{
+				RemoveTimer(CurrentlyExecutingTimer);
+			}
+
+			CurrentlyExecutingTimer.Invalidate();
 		}
 	}
 
@@ -1010,7 +1243,7 @@ void FTimerManager::Tick(float DeltaTime)
 			// Convert from time remaining back to a valid ExpireTime
 			TimerToActivate.ExpireTime += InternalTime;
 			TimerToActivate.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush( Handle, FTimerHeapOrder(Timers) );
+			ActivateTimer(Handle);
 		}
 		PendingTimerSet.Reset();
 	}
@@ -1038,9 +1271,12 @@ void FTimerManager::ListTimers() const
 	// not currently threadsafe
 	check(IsInGameThread());
 
+	TArray<FTimerHandle> ActiveTimerHandles;
+	GetActiveTimerHandles(ActiveTimerHandles);
+
 	TArray<const FTimerData*> ValidActiveTimers;
-	ValidActiveTimers.Reserve(ActiveTimerHeap.Num());
-	for (FTimerHandle Handle : ActiveTimerHeap)
+	ValidActiveTimers.Reserve(ActiveTimerHandles.Num());
+	for (FTimerHandle Handle : ActiveTimerHandles)
 	{
 		if (const FTimerData* Data = FindTimer(Handle))
 		{
@@ -1139,6 +1375,84 @@ bool FTimerManager::WillRemoveTimerAssert(FTimerHandle Handle) const
 	return false;
 }
 
+void FTimerManager::ActivateTimer(FTimerHandle Handle)
+{
+	FTimerData& Data = GetTimer(Handle);
+	check(Data.Status == ETimerStatus::Active);
+
+	if (TimingWheel)
+	{
+		// invalidates any entry left behind by a previous scheduling of this timer
+		++Data.ScheduleSerial;
+		TimingWheel->Insert(Handle, Data);
+	}
+	else
+	{
+		ActiveTimerHeap.HeapPush(Handle, FTimerHeapOrder(Timers));
+	}
+}
+
+void FTimerManager::DeactivateTimer(FTimerHandle Handle)
+{
+	if (TimingWheel)
+	{
+		// the wheel entry is left behind and skipped once the timer status changes
+		return;
+	}
+
+	int32 IndexIndex = ActiveTimerHeap.Find(Handle);
+	check(IndexIndex != INDEX_NONE);
+	ActiveTimerHeap.HeapRemoveAt(IndexIndex, FTimerHeapOrder(Timers), EAllowShrinking::No);
+}
+
+bool FTimerManager::PopExpiredTimer(FTimerHandle& OutHandle)
+{
+	if (TimingWheel)
+	{
+		return TimingWheel->PopExpired(Timers, OutHandle);
+	}
+
+	while (ActiveTimerHeap.Num() > 0)
+	{
+		FTimerHandle TopHandle = ActiveTimerHeap.HeapTop();
+		const FTimerData& Top = Timers[TopHandle.GetIndex()];
+
+		if (Top.Status == ETimerStatus::ActivePendingRemoval)
+		{
+			ActiveTimerHeap.HeapPop(TopHandle, FTimerHeapOrder(Timers), EAllowShrinking::No);
+			RemoveTimer(TopHandle);
+			continue;
+		}
+
+		if (InternalTime > Top.ExpireTime)
+		{
+			ActiveTimerHeap.HeapPop(OutHandle, FTimerHeapOrder(Timers), EAllowShrinking::No);
+			return true;
+		}
+
+		// no need to go further down the heap, we can be finished
+		break;
+	}
+	return false;
+}
+
+int32 FTimerManager::GetNumActiveTimerEntries() const
+{
+	return TimingWheel ? TimingWheel->Num() : ActiveTimerHeap.Num();
+}
+
+void FTimerManager::GetActiveTimerHandles(TArray<FTimerHandle>& OutHandles) const
+{
+	if (TimingWheel)
+	{
+		TimingWheel->GetValidHandles(Timers, OutHandles);
+	}
+	else
+	{
+		OutHandles.Append(ActiveTimerHeap);
+	}
+}
+
 FTimerHandle FTimerManager::GenerateHandle(int32 Index)
 {
 	uint64 NewSerialNumber = ++LastAssignedSerialNumber;
@@ -6,6 +6,8 @@
 #include "Engine/Engine.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerManagerTest, "System.Engine.TimerManager", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerManagerTimingWheelTest, "System.Engine.TimerManager.TimingWheel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTimerManagerBenchmark, "System.Engine.TimerManager.Benchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
 
 #define TIMER_TEST_TEXT( Format, ... ) FString::Printf(TEXT("%s - %d: %s"), TEXT(__FILE__) , __LINE__ , *FString::Printf(TEXT(Format), ##__VA_ARGS__) )
 
@@ -285,4 +287,129 @@ bool FTimerManagerTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+// Ticks a standalone timer manager, bumping GFrameCounter like TimerTest_TickWorld so that every call is a new frame
+void TimerTest_TickTimerManager(FTimerManager& TimerManager, float DeltaTime)
+{
+	TimerManager.Tick(DeltaTime);
+	GFrameCounter++;
+}
+
+// Drives a heap and a timing wheel timer manager with the same random timers and operations, and checks that every timer fires the same number of times
+bool FTimerManagerTimingWheelTest::RunTest(const FString& Parameters)
+{
+	const int32 NumTimers = 2000;
+	const int32 NumFrames = 600;
+
+	FTimerManager HeapTimerManager(nullptr, false);
+	FTimerManager WheelTimerManager(nullptr, true);
+	TestFalse(TIMER_TEST_TEXT("Heap timer manager does not use the timing wheel"), HeapTimerManager.IsUsingTimingWheel());
+	TestTrue(TIMER_TEST_TEXT("Wheel timer manager uses the timing wheel"), WheelTimerManager.IsUsingTimingWheel());
+
+	TArray<int32> HeapCallCounts, WheelCallCounts;
+	HeapCallCounts.SetNumZeroed(NumTimers);
+	WheelCallCounts.SetNumZeroed(NumTimers);
+	TArray<FTimerHandle> HeapHandles, WheelHandles;
+	HeapHandles.SetNum(NumTimers);
+	WheelHandles.SetNum(NumTimers);
+
+	FRandomStream Random(0x7133);
+	for (int32 TimerIndex = 0; TimerIndex < NumTimers; ++TimerIndex)
+	{
+		// spread rates over several wheel levels, from sub-frame to minutes
+		const float Rate = FMath::Pow(10.f, Random.FRandRange(-2.5f, 2.5f));
+		const bool bLoop = Random.FRand() < 0.5f;
+		HeapTimerManager.SetTimer(HeapHandles[TimerIndex], [&HeapCallCounts, TimerIndex]() { ++HeapCallCounts[TimerIndex]; }, Rate, bLoop);
+		WheelTimerManager.SetTimer(WheelHandles[TimerIndex], [&WheelCallCounts, TimerIndex]() { ++WheelCallCounts[TimerIndex]; }, Rate, bLoop);
+	}
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const float DeltaTime = Random.FRandRange(0.005f, 0.1f);
+		TimerTest_TickTimerManager(HeapTimerManager, DeltaTime);
+		TimerTest_TickTimerManager(WheelTimerManager, DeltaTime);
 
+		// exercise pause, unpause and clear on both managers identically
+		const int32 TimerIndex = Random.RandHelper(NumTimers);
+		switch (Random.RandHelper(3))
+		{
+		case 0:
+			HeapTimerManager.PauseTimer(HeapHandles[TimerIndex]);
+			WheelTimerManager.PauseTimer(WheelHandles[TimerIndex]);
+			break;
+		case 1:
+			HeapTimerManager.UnPauseTimer(HeapHandles[TimerIndex]);
+			WheelTimerManager.UnPauseTimer(WheelHandles[TimerIndex]);
+			break;
+		default:
+			HeapTimerManager.ClearTimer(HeapHandles[TimerIndex]);
+			WheelTimerManager.ClearTimer(WheelHandles[TimerIndex]);
+			break;
+		}
+	}
+
+	int32 NumMismatches = 0;
+	for (int32 TimerIndex = 0; TimerIndex < NumTimers; ++TimerIndex)
+	{
+		const bool bExistsInHeap = HeapTimerManager.TimerExists(HeapHandles[TimerIndex]);
+		if (HeapCallCounts[TimerIndex] != WheelCallCounts[TimerIndex] || bExistsInHeap != WheelTimerManager.TimerExists(WheelHandles[TimerIndex]))
+		{
+			++NumMismatches;
+		}
+		else if (bExistsInHeap && !FMath::IsNearlyEqual(HeapTimerManager.GetTimerRemaining(HeapHandles[TimerIndex]), WheelTimerManager.GetTimerRemaining(WheelHandles[TimerIndex]), UE_KINDA_SMALL_NUMBER))
+		{
+			++NumMismatches;
+		}
+	}
+	TestEqual(TIMER_TEST_TEXT("Timers firing differently between heap and timing wheel"), NumMismatches, 0);
+
+	return true;
+}
+
+// Compares the cost of scheduling, ticking and clearing timers between the heap and the timing wheel
+bool FTimerManagerBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 TimerCounts[] = { 10000, 100000, 1000000 };
+	const int32 NumFrames = 300;
+	const float DeltaTime = 1.f / 30.f;
+
+	for (const int32 NumTimers : TimerCounts)
+	{
+		for (const bool bUseTimingWheel : { false, true })
+		{
+			FTimerManager TimerManager(nullptr, bUseTimingWheel);
+			TArray<FTimerHandle> Handles;
+			Handles.SetNum(NumTimers);
+			int64 NumCalls = 0;
+
+			// prime the manager so new timers go straight to the active timers
+			TimerTest_TickTimerManager(TimerManager, DeltaTime);
+
+			FRandomStream Random(NumTimers);
+			const double SetStartTime = FPlatformTime::Seconds();
+			for (int32 TimerIndex = 0; TimerIndex < NumTimers; ++TimerIndex)
+			{
+				TimerManager.SetTimer(Handles[TimerIndex], [&NumCalls]() { ++NumCalls; }, Random.FRandRange(0.1f, 30.f), Random.FRand() < 0.75f);
+			}
+			const double SetTime = FPlatformTime::Seconds() - SetStartTime;
+
+			const double TickStartTime = FPlatformTime::Seconds();
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				TimerTest_TickTimerManager(TimerManager, DeltaTime);
+			}
+			const double TickTime = FPlatformTime::Seconds() - TickStartTime;
+
+			const double ClearStartTime = FPlatformTime::Seconds();
+			for (FTimerHandle& Handle : Handles)
+			{
+				TimerManager.ClearTimer(Handle);
+			}
+			const double ClearTime = FPlatformTime::Seconds() - ClearStartTime;
+
+			AddInfo(FString::Printf(TEXT("%s, %d timers: SetTimer %.2f ms, Tick %.3f ms/frame, ClearTimer %.2f ms, %lld calls"),
+				bUseTimingWheel ? TEXT("Timing wheel") : TEXT("Heap"), NumTimers, SetTime * 1000.0, TickTime * 1000.0 / NumFrames, ClearTime * 1000.0, NumCalls));
+		}
+	}
+
+	return true;
+}
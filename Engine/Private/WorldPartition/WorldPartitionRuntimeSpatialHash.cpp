@@ -76,6 +76,18 @@ static FAutoConsoleVariableRef CVarForceRuntimeSpatialHashZCulling(
 	GForceRuntimeSpatialHashZCulling,
 	TEXT("Used to force the behavior of the runtime hash cells Z culling. Set to 0 to force off, to 1 to force on and any other value to respect the runtime hash setting."));
 
+static bool GRuntimeSpatialHashBatchedQuery = true;
+static FAutoConsoleVariableRef CVarRuntimeSpatialHashBatchedQuery(
+	TEXT("wp.Runtime.RuntimeSpatialHashBatchedQuery"),
+	GRuntimeSpatialHashBatchedQuery,
+	TEXT("Set to 1 to rasterize all streaming sources before visiting the intersecting cells, so that cells intersecting multiple sources are visited once."));
+
+static bool GRuntimeSpatialHashIncrementalUpdate = true;
+static FAutoConsoleVariableRef CVarRuntimeSpatialHashIncrementalUpdate(
+	TEXT("wp.Runtime.RuntimeSpatialHashIncrementalUpdate"),
+	GRuntimeSpatialHashIncrementalUpdate,
+	TEXT("Set to 1 to only update the intersecting cells of streaming sources that moved since the last streaming update, instead of querying all sources."));
+
 static bool GetEffectiveEnableZCulling(bool bEnableZCulling)
 {
 	switch (GForceRuntimeSpatialHashZCulling)
@@ -372,12 +384,111 @@ void FSpatialHashStreamingGrid::GetCells(const TArray<FWorldPartitionStreamingSo
 	typedef TMap<FGridCellCoord, TArray<FStreamingSourceInfo>> FIntersectingCells;
 	FIntersectingCells AllActivatedCells;
 
+	auto IsCellInShapeZRange = [](const UWorldPartitionRuntimeCell* Cell, const FSphericalSector& Shape)
+	{
+		const FVector2D CellMinMaxZ(Cell->GetContentBounds().Min.Z, Cell->GetContentBounds().Max.Z);
+		return TRange<double>::Inclusive(CellMinMaxZ.X, CellMinMaxZ.Y).Overlaps(TRange<double>::Inclusive(Shape.GetCenter().Z - Shape.GetRadius(), Shape.GetCenter().Z + Shape.GetRadius()));
+	};
+
 	const float GridLoadingRange = GetLoadingRange();
 	const FSquare2DGridHelper& Helper = GetGridHelper();
+
+	// Shapes must outlive AllActivatedCells, which references them
+	TArray<TPair<const FWorldPartitionStreamingSource*, FSphericalSector>> SourceShapes;
 	for (const FWorldPartitionStreamingSource& Source : Sources)
 	{
-		Source.ForEachShape(GridLoadingRange, GridName, /*bProjectIn2D*/ true, [&](const FSphericalSector& Shape)
+		Source.ForEachShape(GridLoadingRange, GridName, /*bProjectIn2D*/ true, [&SourceShapes, &Source](const FSphericalSector& Shape)
+		{
+			SourceShapes.Emplace(&Source, Shape);
+		});
+	}
+
+	if (GRuntimeSpatialHashBatchedQuery && (Sources.Num() > 1))
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSpatialHashStreamingGrid::GetCells_Batched);
+
+		// Rasterize all the shapes in a shared coverage map first, each intersecting cell keeps the list of shapes intersecting it
+		struct FShapeLink
+		{
+			int32 ShapeIndex;
+			int32 Next;
+		};
+
+		TMap<FGridCellCoord, int32> Coverage;
+		TArray<FShapeLink> ShapeLinks;
+		for (int32 ShapeIndex = 0; ShapeIndex < SourceShapes.Num(); ++ShapeIndex)
 		{
+			Helper.ForEachIntersectingCells(SourceShapes[ShapeIndex].Value, [&Coverage, &ShapeLinks, ShapeIndex](const FGridCellCoord& Coords)
+			{
+#if !UE_BUILD_SHIPPING
+				if ((GFilterRuntimeSpatialHashGridLevel == INDEX_NONE) || (GFilterRuntimeSpatialHashGridLevel == Coords.Z))
+#endif
+				{
+					int32& FirstLink = Coverage.FindOrAdd(Coords, INDEX_NONE);
+					FirstLink = ShapeLinks.Add({ ShapeIndex, FirstLink });
+				}
+			});
+		}
+
+		// Then visit each intersecting cell once, merging the streaming source info of all the shapes intersecting it
+		const bool bSnapToLowerLevels = !Settings.bUseAlignedGridLevels && Settings.bSnapNonAlignedGridLevelsToLowerLevels;
+		TArray<int32, TInlineAllocator<16>> ActivatingShapeIndices;
+		for (const TPair<FGridCellCoord, int32>& CoordsCoverage : Coverage)
+		{
+			ActivatingShapeIndices.Reset();
+
+			ForEachRuntimeCell(CoordsCoverage.Key, [&](const UWorldPartitionRuntimeCell* Cell)
+			{
+				const EDataLayerRuntimeState CellWantedState = Cell->GetCellEffectiveWantedState();
+				if (CellWantedState == EDataLayerRuntimeState::Unloaded)
+				{
+					return;
+				}
+
+				for (int32 LinkIndex = CoordsCoverage.Value; LinkIndex != INDEX_NONE; LinkIndex = ShapeLinks[LinkIndex].Next)
+				{
+					const int32 ShapeIndex = ShapeLinks[LinkIndex].ShapeIndex;
+					const FWorldPartitionStreamingSource& Source = *SourceShapes[ShapeIndex].Key;
+					const FSphericalSector& Shape = SourceShapes[ShapeIndex].Value;
+
+					if (bEnableZCulling && !IsCellInShapeZRange(Cell, Shape))
+					{
+						continue;
+					}
+
+					if ((CellWantedState == EDataLayerRuntimeState::Loaded) || (Source.TargetState == EStreamingSourceTargetState::Loaded))
+					{
+						OutLoadCells.AddCell(Cell, Source, Shape);
+					}
+					else
+					{
+						check(CellWantedState == EDataLayerRuntimeState::Activated);
+						check(Source.TargetState == EStreamingSourceTargetState::Activated);
+						OutActivateCells.AddCell(Cell, Source, Shape);
+						if (bSnapToLowerLevels)
+						{
+							ActivatingShapeIndices.AddUnique(ShapeIndex);
+						}
+					}
+				}
+			});
+
+			if (ActivatingShapeIndices.Num())
+			{
+				TArray<FStreamingSourceInfo>& ActivatedCellInfos = AllActivatedCells.FindOrAdd(CoordsCoverage.Key);
+				for (int32 ShapeIndex : ActivatingShapeIndices)
+				{
+					ActivatedCellInfos.Emplace(*SourceShapes[ShapeIndex].Key, SourceShapes[ShapeIndex].Value);
+				}
+			}
+		}
+	}
+	else
+	{
+		for (const TPair<const FWorldPartitionStreamingSource*, FSphericalSector>& SourceShape : SourceShapes)
+		{
+			const FWorldPartitionStreamingSource& Source = *SourceShape.Key;
+			const FSphericalSector& Shape = SourceShape.Value;
 			FStreamingSourceInfo Info(Source, Shape);
 
 			Helper.ForEachIntersectingCells(Shape, [&](const FGridCellCoord& Coords)
@@ -390,15 +501,7 @@ void FSpatialHashStreamingGrid::GetCells(const TArray<FWorldPartitionStreamingSo
 				{
 					ForEachRuntimeCell(Coords, [&](const UWorldPartitionRuntimeCell* Cell)
 					{
-						bool bIncludeCell = true;
-
-						if (bEnableZCulling)
-						{
-							const FVector2D CellMinMaxZ(Cell->GetContentBounds().Min.Z, Cell->GetContentBounds().Max.Z);
-							bIncludeCell = TRange<double>::Inclusive(CellMinMaxZ.X, CellMinMaxZ.Y).Overlaps(TRange<double>::Inclusive(Shape.GetCenter().Z - Shape.GetRadius(), Shape.GetCenter().Z + Shape.GetRadius()));
-						}
-						
-						if (bIncludeCell)
+						if (!bEnableZCulling || IsCellInShapeZRange(Cell, Shape))
 						{
 							switch (Cell->GetCellEffectiveWantedState())
 							{
@@ -432,7 +535,7 @@ void FSpatialHashStreamingGrid::GetCells(const TArray<FWorldPartitionStreamingSo
 					AllActivatedCells.FindOrAdd(Coords).Add(Info);
 				}
 			});
-		});
+		}
 	}
 
 	GetNonSpatiallyLoadedCells(OutActivateCells.GetCells(), OutLoadCells.GetCells());
@@ -512,6 +615,378 @@ void FSpatialHashStreamingGrid::GetCells(const TArray<FWorldPartitionStreamingSo
 	}
 }
 
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkRuntimeSpatialHashGetCellsCommand(
+	TEXT("wp.Runtime.BenchmarkRuntimeSpatialHashGetCells"),
+	TEXT("Times the streaming grids cell queries for 16 and 256 clustered streaming sources, with and without batching. Args [iterations]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		const UWorldPartition* WorldPartition = World ? World->GetWorldPartition() : nullptr;
+		const UWorldPartitionRuntimeSpatialHash* RuntimeHash = WorldPartition ? Cast<UWorldPartitionRuntimeSpatialHash>(WorldPartition->RuntimeHash) : nullptr;
+		if (!RuntimeHash)
+		{
+			UE_LOG(LogWorldPartition, Warning, TEXT("BenchmarkRuntimeSpatialHashGetCells requires a world using a runtime spatial hash"));
+			return;
+		}
+
+		const int32 NumIterations = Args.Num() ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+		const bool bWasBatchedQuery = GRuntimeSpatialHashBatchedQuery;
+		FRandomStream RandomStream(0x5EED);
+
+		RuntimeHash->ForEachStreamingGrid([&](const FSpatialHashStreamingGrid& StreamingGrid)
+		{
+			// A single source never takes the batched path, so it isn't part of the comparison
+			for (const int32 NumSources : { 16, 256 })
+			{
+				// Cluster the sources within the loading range of a random location, as for players in a crowded area
+				const FBox& Bounds = StreamingGrid.WorldBounds;
+				const FVector ClusterCenter(
+					FMath::Lerp(Bounds.Min.X, Bounds.Max.X, RandomStream.GetFraction()),
+					FMath::Lerp(Bounds.Min.Y, Bounds.Max.Y, RandomStream.GetFraction()),
+					FMath::Lerp(Bounds.Min.Z, Bounds.Max.Z, RandomStream.GetFraction()));
+				const float ClusterRadius = StreamingGrid.GetLoadingRange();
+
+				TArray<FWorldPartitionStreamingSource> Sources;
+				for (int32 SourceIndex = 0; SourceIndex < NumSources; ++SourceIndex)
+				{
+					const FVector Offset(RandomStream.FRandRange(-ClusterRadius, ClusterRadius), RandomStream.FRandRange(-ClusterRadius, ClusterRadius), 0);
+					const FRotator Rotation(0, RandomStream.FRandRange(0, 360), 0);
+					Sources.Emplace(FName(TEXT("BenchmarkSource"), SourceIndex), ClusterCenter + Offset, Rotation, EStreamingSourceTargetState::Activated, false, EStreamingSourcePriority::Default, false);
+				}
+
+				double Durations[2];
+				int32 NumCells = 0;
+				for (int32 Batched = 0; Batched < 2; ++Batched)
+				{
+					GRuntimeSpatialHashBatchedQuery = !!Batched;
+					UWorldPartitionRuntimeHash::FStreamingSourceCells ActivateCells;
+					UWorldPartitionRuntimeHash::FStreamingSourceCells LoadCells;
+
+					const double StartTime = FPlatformTime::Seconds();
+					for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+					{
+						ActivateCells.Reset();
+						LoadCells.Reset();
+						StreamingGrid.GetCells(Sources, ActivateCells, LoadCells, /*bEnableZCulling*/ false);
+					}
+					Durations[Batched] = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumIterations;
+					NumCells = ActivateCells.Num() + LoadCells.Num();
+				}
+
+				UE_LOG(LogWorldPartition, Display, TEXT("Grid %s, %3d sources, %5d cells: %.3f ms per query, batched %.3f ms"), *StreamingGrid.GridName.ToString(), NumSources, NumCells, Durations[0], Durations[1]);
+			}
+		});
+
+		GRuntimeSpatialHashBatchedQuery = bWasBatchedQuery;
+
+		// Cells accumulated the benchmark sources info, make sure it's reset by the next streaming update
+		UWorldPartitionRuntimeCellData::DirtyStreamingSourceCacheEpoch();
+	})
+);
+#endif
+
+struct FSpatialHashStreamingGridIncrementalState
+{
+	struct FContribution
+	{
+		int32 SourceIndex;
+		uint32 ShapeMask;
+	};
+
+	struct FCoordsRefs
+	{
+		// Number of contributing sources per target state, used to classify cells that don't need their streaming source info
+		int32 NumActivateRefs = 0;
+		int32 NumLoadRefs = 0;
+		TArray<FContribution, TInlineAllocator<2>> Contributions;
+		// Runtime cells of the coordinates, resolved when the coordinates start intersecting a source
+		TArray<const UWorldPartitionRuntimeCell*, TInlineAllocator<4>> Cells;
+	};
+
+	struct FSourceState
+	{
+		FWorldPartitionStreamingSource Source;
+		TArray<FSphericalSector, TInlineAllocator<2>> Shapes;
+		TMap<FGridCellCoord, uint32> Coords;
+		uint32 UpdateIndex = 0;
+	};
+
+	TSparseArray<FSourceState> SourceStates;
+	TMap<FName, int32> SourceIndices;
+	TMap<FGridCellCoord, FCoordsRefs> CoordsRefs;
+	uint32 UpdateIndex = 0;
+
+	FCoordsRefs& AddContribution(const FGridCellCoord& Coords, int32 SourceIndex, uint32 ShapeMask, EStreamingSourceTargetState TargetState)
+	{
+		FCoordsRefs& Refs = CoordsRefs.FindOrAdd(Coords);
+		Refs.Contributions.Add({ SourceIndex, ShapeMask });
+		++(TargetState == EStreamingSourceTargetState::Activated ? Refs.NumActivateRefs : Refs.NumLoadRefs);
+		return Refs;
+	}
+
+	void RemoveContribution(const FGridCellCoord& Coords, int32 SourceIndex, EStreamingSourceTargetState TargetState)
+	{
+		FCoordsRefs& Refs = CoordsRefs.FindChecked(Coords);
+		const int32 ContributionIndex = Refs.Contributions.IndexOfByPredicate([SourceIndex](const FContribution& Contribution) { return Contribution.SourceIndex == SourceIndex; });
+		check(ContributionIndex != INDEX_NONE);
+		Refs.Contributions.RemoveAtSwap(ContributionIndex, 1, EAllowShrinking::No);
+		--(TargetState == EStreamingSourceTargetState::Activated ? Refs.NumActivateRefs : Refs.NumLoadRefs);
+
+		if (Refs.Contributions.IsEmpty())
+		{
+			check(!Refs.NumActivateRefs && !Refs.NumLoadRefs);
+			CoordsRefs.Remove(Coords);
+		}
+	}
+
+	void RemoveSource(int32 SourceIndex)
+	{
+		FSourceState& SourceState = SourceStates[SourceIndex];
+		for (const TPair<FGridCellCoord, uint32>& Coords : SourceState.Coords)
+		{
+			RemoveContribution(Coords.Key, SourceIndex, SourceState.Source.TargetState);
+		}
+		SourceIndices.Remove(SourceState.Source.Name);
+		SourceStates.RemoveAt(SourceIndex);
+	}
+
+	// Shapes are projected in 2D, only changes of their footprint on the grid require to update the intersecting cells
+	static bool HasSameFootprint(const FSphericalSector& A, const FSphericalSector& B)
+	{
+		return (A.GetCenter().X == B.GetCenter().X) && (A.GetCenter().Y == B.GetCenter().Y) && (A.GetRadius() == B.GetRadius()) && (A.GetAngle() == B.GetAngle()) && (A.GetAxis() == B.GetAxis());
+	}
+};
+
+bool FSpatialHashStreamingGrid::GetCellsIncremental(const TArray<FWorldPartitionStreamingSource>& Sources, UWorldPartitionRuntimeHash::FStreamingSourceCells& OutActivateCells, UWorldPartitionRuntimeHash::FStreamingSourceCells& OutLoadCells, bool bEnableZCulling) const
+{
+	// Z culling depends on the exact shape of each source for each cell, and snapping to lower levels propagates activation
+	// through parent cells, both need the full query
+	if (bEnableZCulling || (!Settings.bUseAlignedGridLevels && Settings.bSnapNonAlignedGridLevelsToLowerLevels))
+	{
+		return false;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FSpatialHashStreamingGrid::GetCellsIncremental);
+
+	typedef FSpatialHashStreamingGridIncrementalState FState;
+
+	const float GridLoadingRange = GetLoadingRange();
+	TArray<TArray<FSphericalSector, TInlineAllocator<2>>, TInlineAllocator<16>> SourcesShapes;
+	SourcesShapes.SetNum(Sources.Num());
+
+	TSet<FName, DefaultKeyFuncs<FName>, TInlineSetAllocator<16>> SourceNames;
+	for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+	{
+		const FWorldPartitionStreamingSource& Source = Sources[SourceIndex];
+
+		bool bIsAlreadyInSet = false;
+		SourceNames.Add(Source.Name, &bIsAlreadyInSet);
+		if (bIsAlreadyInSet)
+		{
+			// Sources are tracked by name between calls
+			return false;
+		}
+
+		Source.ForEachShape(GridLoadingRange, GridName, /*bProjectIn2D*/ true, [&SourcesShapes, SourceIndex](const FSphericalSector& Shape)
+		{
+			SourcesShapes[SourceIndex].Add(Shape);
+		});
+
+		if (SourcesShapes[SourceIndex].Num() > 32)
+		{
+			// Intersecting shapes are stored as a mask per cell
+			return false;
+		}
+	}
+
+	if (!IncrementalState.IsValid())
+	{
+		IncrementalState = MakeShared<FState>();
+	}
+
+	FState& State = *IncrementalState;
+	const uint32 UpdateIndex = ++State.UpdateIndex;
+	const FSquare2DGridHelper& Helper = GetGridHelper();
+
+	// Update the intersecting cells of new sources and sources whose footprint changed
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSpatialHashStreamingGrid::GetCellsIncremental_UpdateSources);
+
+		TMap<FGridCellCoord, uint32> NewCoords;
+		for (int32 Index = 0; Index < Sources.Num(); ++Index)
+		{
+			const FWorldPartitionStreamingSource& Source = Sources[Index];
+			const TArray<FSphericalSector, TInlineAllocator<2>>& Shapes = SourcesShapes[Index];
+
+			int32 SourceIndex;
+			bool bFootprintChanged = true;
+			if (const int32* ExistingSourceIndex = State.SourceIndices.Find(Source.Name))
+			{
+				SourceIndex = *ExistingSourceIndex;
+				const FState::FSourceState& SourceState = State.SourceStates[SourceIndex];
+				if ((SourceState.Source.TargetState == Source.TargetState) && (SourceState.Shapes.Num() == Shapes.Num()))
+				{
+					bFootprintChanged = false;
+					for (int32 ShapeIndex = 0; ShapeIndex < Shapes.Num(); ++ShapeIndex)
+					{
+						if (!FState::HasSameFootprint(SourceState.Shapes[ShapeIndex], Shapes[ShapeIndex]))
+						{
+							bFootprintChanged = true;
+							break;
+						}
+					}
+				}
+				else if (SourceState.Source.TargetState != Source.TargetState)
+				{
+					// Contributions are counted per target state, readd them all
+					State.RemoveSource(SourceIndex);
+					SourceIndex = State.SourceStates.Add(FState::FSourceState());
+					State.SourceIndices.Add(Source.Name, SourceIndex);
+				}
+			}
+			else
+			{
+				SourceIndex = State.SourceStates.Add(FState::FSourceState());
+				State.SourceIndices.Add(Source.Name, SourceIndex);
+			}
+
+			FState::FSourceState& SourceState = State.SourceStates[SourceIndex];
+			SourceState.Source = Source;
+			SourceState.Shapes = Shapes;
+			SourceState.UpdateIndex = UpdateIndex;
+
+			if (!bFootprintChanged)
+			{
+				continue;
+			}
+
+			NewCoords.Reset();
+			for (int32 ShapeIndex = 0; ShapeIndex < Shapes.Num(); ++ShapeIndex)
+			{
+				Helper.ForEachIntersectingCells(Shapes[ShapeIndex], [&NewCoords, ShapeIndex](const FGridCellCoord& Coords)
+				{
+					NewCoords.FindOrAdd(Coords, 0) |= (1u << ShapeIndex);
+				});
+			}
+
+			// Apply the delta: cells leaving the source, then cells entering it or intersected by other shapes of the source
+			for (const TPair<FGridCellCoord, uint32>& OldCoords : SourceState.Coords)
+			{
+				if (!NewCoords.Contains(OldCoords.Key))
+				{
+					State.RemoveContribution(OldCoords.Key, SourceIndex, Source.TargetState);
+				}
+			}
+
+			for (const TPair<FGridCellCoord, uint32>& Coords : NewCoords)
+			{
+				if (const uint32* OldShapeMask = SourceState.Coords.Find(Coords.Key))
+				{
+					if (*OldShapeMask != Coords.Value)
+					{
+						FState::FContribution* Contribution = State.CoordsRefs.FindChecked(Coords.Key).Contributions.FindByPredicate([SourceIndex](const FState::FContribution& Contribution) { return Contribution.SourceIndex == SourceIndex; });
+						check(Contribution);
+						Contribution->ShapeMask = Coords.Value;
+					}
+				}
+				else
+				{
+					FState::FCoordsRefs& Refs = State.AddContribution(Coords.Key, SourceIndex, Coords.Value, Source.TargetState);
+					if (Refs.Contributions.Num() == 1)
+					{
+						ForEachRuntimeCell(Coords.Key, [&Refs](const UWorldPartitionRuntimeCell* Cell) { Refs.Cells.Add(Cell); });
+					}
+				}
+			}
+
+			Swap(SourceState.Coords, NewCoords);
+		}
+
+		// Remove sources that went away
+		TArray<int32, TInlineAllocator<16>> RemovedSourceIndices;
+		for (TSparseArray<FState::FSourceState>::TConstIterator It(State.SourceStates); It; ++It)
+		{
+			if (It->UpdateIndex != UpdateIndex)
+			{
+				RemovedSourceIndices.Add(It.GetIndex());
+			}
+		}
+
+		for (int32 SourceIndex : RemovedSourceIndices)
+		{
+			State.RemoveSource(SourceIndex);
+		}
+	}
+
+	// Build the cells from the reference counted cell coordinates. The grid is only looked up for the coordinates entering
+	// the sources above, the output sets still need all the cells. Streaming source info is only needed by cells which
+	// still have to be processed by the streaming policy, others are only added to the sets.
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSpatialHashStreamingGrid::GetCellsIncremental_GatherCells);
+
+		auto AddCell = [&State](UWorldPartitionRuntimeHash::FStreamingSourceCells& OutCells, const UWorldPartitionRuntimeCell* Cell, const FState::FCoordsRefs& Refs, EWorldPartitionRuntimeCellState TargetCellState, TOptional<EStreamingSourceTargetState> SourceTargetState)
+		{
+			if (Cell->GetCurrentState() == TargetCellState)
+			{
+				OutCells.GetCells().Add(Cell);
+				return;
+			}
+
+			for (const FState::FContribution& Contribution : Refs.Contributions)
+			{
+				const FState::FSourceState& SourceState = State.SourceStates[Contribution.SourceIndex];
+				if (!SourceTargetState.IsSet() || (SourceState.Source.TargetState == SourceTargetState.GetValue()))
+				{
+					for (uint32 ShapeMask = Contribution.ShapeMask; ShapeMask; ShapeMask &= ShapeMask - 1)
+					{
+						OutCells.AddCell(Cell, SourceState.Source, SourceState.Shapes[FMath::CountTrailingZeros(ShapeMask)]);
+					}
+				}
+			}
+		};
+
+		for (const TPair<FGridCellCoord, FState::FCoordsRefs>& Coords : State.CoordsRefs)
+		{
+#if !UE_BUILD_SHIPPING
+			if ((GFilterRuntimeSpatialHashGridLevel != INDEX_NONE) && (GFilterRuntimeSpatialHashGridLevel != Coords.Key.Z))
+			{
+				continue;
+			}
+#endif
+			const FState::FCoordsRefs& Refs = Coords.Value;
+			for (const UWorldPartitionRuntimeCell* Cell : Refs.Cells)
+			{
+				switch (Cell->GetCellEffectiveWantedState())
+				{
+				case EDataLayerRuntimeState::Loaded:
+					AddCell(OutLoadCells, Cell, Refs, EWorldPartitionRuntimeCellState::Loaded, {});
+					break;
+				case EDataLayerRuntimeState::Activated:
+					if (Refs.NumLoadRefs)
+					{
+						// A cell also wanted activated by other sources still sorts with the info of the sources loading it
+						const EWorldPartitionRuntimeCellState TargetCellState = Refs.NumActivateRefs ? EWorldPartitionRuntimeCellState::Activated : EWorldPartitionRuntimeCellState::Loaded;
+						AddCell(OutLoadCells, Cell, Refs, TargetCellState, EStreamingSourceTargetState::Loaded);
+					}
+					if (Refs.NumActivateRefs)
+					{
+						AddCell(OutActivateCells, Cell, Refs, EWorldPartitionRuntimeCellState::Activated, EStreamingSourceTargetState::Activated);
+					}
+					break;
+				case EDataLayerRuntimeState::Unloaded:
+					break;
+				default:
+					checkNoEntry();
+				}
+			}
+		}
+	}
+
+	GetNonSpatiallyLoadedCells(OutActivateCells.GetCells(), OutLoadCells.GetCells());
+
+	return true;
+}
+
 bool FSpatialHashStreamingGrid::InsertGridCell(UWorldPartitionRuntimeCell* InCell, const FGridCellCoord& InGridCellCoords)
 {
 	check(InCell);
@@ -539,6 +1014,7 @@ bool FSpatialHashStreamingGrid::InsertGridCell(UWorldPartitionRuntimeCell* InCel
 				GridLevel.LayerCellsMapping.Add(CellIndex, LayerCellIndex);
 			}
 			GridLevel.LayerCells[LayerCellIndex].GridCells.Add(InCell);
+			IncrementalState.Reset();
 			return true;
 		}
 	}
@@ -554,6 +1030,7 @@ void FSpatialHashStreamingGrid::InjectExternalStreamingObjectGrid(const FSpatial
 	}
 
 	check(GetGridHelper().Levels.Num() == InjectedGridLevels.Num());
+	IncrementalState.Reset();
 
 	for (int32 SourceGridLevel = 0; SourceGridLevel < InExternalObjectStreamingGrid.GridLevels.Num(); ++SourceGridLevel)
 	{
@@ -609,6 +1086,8 @@ void FSpatialHashStreamingGrid::InjectExternalStreamingObjectGrid(const FSpatial
 
 void FSpatialHashStreamingGrid::RemoveExternalStreamingObjectGrid(const FSpatialHashStreamingGrid& InExternalObjectStreamingGrid) const
 {
+	IncrementalState.Reset();
+
 	for (int SourceGridLevel = 0; SourceGridLevel < InExternalObjectStreamingGrid.GridLevels.Num(); ++SourceGridLevel)
 	{
 		const FSpatialHashStreamingGridLevel& ExternalObjectGridLevel = InExternalObjectStreamingGrid.GridLevels[SourceGridLevel];
@@ -1707,12 +2186,17 @@ void UWorldPartitionRuntimeSpatialHash::ForEachStreamingCellsSources(const TArra
 	}
 	else
 	{
-		// Get cells based on streaming sources
+		// Get cells based on streaming sources. The debug display of the streaming priority needs the source info of all cells.
+		const bool bUseIncrementalUpdate = GRuntimeSpatialHashIncrementalUpdate && !FWorldPartitionDebugHelper::IsRuntimeSpatialHashCellStreamingPriorityShown();
 		ForEachStreamingGrid([&](const FSpatialHashStreamingGrid& StreamingGrid)
 		{
 			if (IsCellRelevantFor(StreamingGrid.bClientOnlyVisible))
 			{
-				StreamingGrid.GetCells(Sources, ActivateStreamingSourceCells, LoadStreamingSourceCells, GetEffectiveEnableZCulling(bEnableZCulling));
+				const bool bEffectiveEnableZCulling = GetEffectiveEnableZCulling(bEnableZCulling);
+				if (!bUseIncrementalUpdate || !StreamingGrid.GetCellsIncremental(Sources, ActivateStreamingSourceCells, LoadStreamingSourceCells, bEffectiveEnableZCulling))
+				{
+					StreamingGrid.GetCells(Sources, ActivateStreamingSourceCells, LoadStreamingSourceCells, bEffectiveEnableZCulling);
+				}
 			}
 		});
 	}
@@ -836,12 +836,50 @@ public:
 		
 		if (FAnimWeight::IsRelevant(Weight))
 		{
-			UE::Anim::FNamedValueArrayUtils::Union(*this, AdditiveCurve, [Weight](ElementType& InOutThisElement, const OtherElementType& InAdditiveCurveElement, UE::Anim::ENamedValueUnionFlags InFlags)
+			// Curves blended together are often extracted from the same assets and hold the same elements,
+			// in which case there is nothing to merge and they can be accumulated index by index
+			if (HasMatchingElements(AdditiveCurve))
 			{
-				InOutThisElement.Value += InAdditiveCurveElement.Value * Weight;
-				InOutThisElement.Flags |= InAdditiveCurveElement.Flags;
-			});
+				for (int32 ElementIndex = 0; ElementIndex < Super::Elements.Num(); ++ElementIndex)
+				{
+					ElementType& ThisElement = Super::Elements[ElementIndex];
+					const OtherElementType& AdditiveCurveElement = AdditiveCurve.Elements[ElementIndex];
+					ThisElement.Value += AdditiveCurveElement.Value * Weight;
+					ThisElement.Flags |= AdditiveCurveElement.Flags;
+				}
+			}
+			else
+			{
+				UE::Anim::FNamedValueArrayUtils::Union(*this, AdditiveCurve, [Weight](ElementType& InOutThisElement, const OtherElementType& InAdditiveCurveElement, UE::Anim::ENamedValueUnionFlags InFlags)
+				{
+					InOutThisElement.Value += InAdditiveCurveElement.Value * Weight;
+					InOutThisElement.Flags |= InAdditiveCurveElement.Flags;
+				});
+			}
+		}
+	}
+
+	/**
+	 * Check whether the other curve holds elements with the same names in the same order as this curve
+	 * @return true if elements of both curves can be combined index by index
+	 */
+	template<typename OtherAllocator, typename OtherElementType>
+	bool HasMatchingElements(const TBaseBlendedCurve<OtherAllocator, OtherElementType>& OtherCurve) const
+	{
+		if (Super::Elements.Num() != OtherCurve.Elements.Num())
+		{
+			return false;
 		}
+
+		for (int32 ElementIndex = 0; ElementIndex < Super::Elements.Num(); ++ElementIndex)
+		{
+			if (Super::Elements[ElementIndex].Name != OtherCurve.Elements[ElementIndex].Name)
+			{
+				return false;
+			}
+		}
+
+		return true;
 	}
 
 	/**
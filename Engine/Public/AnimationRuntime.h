@@ -486,6 +486,19 @@ public:
 	 */
 	static ENGINE_API void LerpBoneTransforms(TArray<FTransform>& A, const TArray<FTransform>& B, float Alpha, const TArray<FBoneIndexType>& RequiredBonesArray);
 
+	/** Weighted blend of N transform arrays in a single pass over the bones: OutTransforms[i] = Sum(SourceTransforms[Pose][i] * SourceWeights[Pose]).
+	 * Rotations are accumulated along the shortest path, same as BlendTransform<ETransformBlendMode::Accumulate>.
+	 * @param SourceTransforms : Source transform arrays, each holding NumTransforms transforms.
+	 * @param SourceWeights : Weight of each source array.
+	 * @param OutTransforms : Out transform array holding NumTransforms transforms, can be one of the sources.
+	 * @param NumTransforms : Number of transforms to blend.
+	 * @param bNormalizeRotations : Whether to normalize the resulting rotations.
+	 */
+	static ENGINE_API void BlendTransformsTogether(TArrayView<const FTransform* const> SourceTransforms, TArrayView<const float> SourceWeights, FTransform* OutTransforms, int32 NumTransforms, bool bNormalizeRotations);
+
+	/** Per bone version of BlendTransformsTogether, the weight of transform i of source Pose is SourceWeights[Pose * NumTransforms + i]. */
+	static ENGINE_API void BlendTransformsTogetherPerBone(TArrayView<const FTransform* const> SourceTransforms, TArrayView<const float> SourceWeights, FTransform* OutTransforms, int32 NumTransforms, bool bNormalizeRotations);
+
 	/** 
 	 * Blend Array of Transforms by weight
 	 *
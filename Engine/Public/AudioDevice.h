@@ -6,6 +6,7 @@
 #include "AudioDynamicParameter.h"
 #include "AudioVirtualLoop.h"
 #include "Components/AudioComponent.h"
+#include "ContentStreaming.h"
 #include "HAL/LowLevelMemStats.h"
 #include "Math/Transform.h"
 #include "Math/Vector.h"
@@ -1500,6 +1501,12 @@ protected:
 	 */
 	ENGINE_API void StartSources(TArray<FWaveInstance*>& WaveInstances, int32 FirstActiveIndex, bool bGameTicking);
 
+	/**
+	 * Hands the streamed sound waves that are playing or about to play to the streaming manager, so their upcoming chunks are read ahead of playback.
+	 * This covers every wave instance, whether or not it got a source, the other branches of playing sound cues and virtualized loops.
+	 */
+	void UpdateStreamingPrefetch(const TArray<FWaveInstance*>& WaveInstances);
+
 	/**
 	 * This is overridden in Audio::FMixerDevice to propogate listener information to the audio thread.
 	 */
@@ -2228,6 +2235,15 @@ private:
 	/** Cached copy of sound class adjusters array. Cached to avoid allocating every frame. */
 	TArray<FSoundClassAdjuster> SoundClassAdjustersCopy;
 
+	/** Requests passed to the streaming manager by UpdateStreamingPrefetch. Cached to avoid allocating every frame. */
+	TArray<FAudioChunkPrefetchRequest> PrefetchRequests;
+
+	/** Proxies of the sound waves being prefetched, kept for as long as the sound waves are being prefetched. */
+	TMap<FObjectKey, FSoundWaveProxyPtr> PrefetchSoundWaveProxies;
+
+	/** Streamed sound waves reachable from each playing sound cue, kept for as long as the sound cue is playing. */
+	TMap<FObjectKey, TArray<TWeakObjectPtr<USoundWave>>> PrefetchSoundCueWaves;
+
 	/** Set of sounds which will be stopped next audio frame update */
 	TSet<FActiveSound*> PendingSoundsToStop;
 
@@ -120,6 +120,10 @@ public:
 	// InOutCacheLookupID will be set to the offset the chunk is in the cache, which can be used for faster lookup in the future.
 	TArrayView<uint8> GetChunk(const FChunkKey& InKey, const TSharedPtr<FSoundWaveData>& InSoundWavePtr, bool bBlockForLoadCompletion, bool bNeededForPlayback, uint64& InOutCacheLookupID);
 
+	// Starts reading a chunk that will be needed soon, or puts it back at the top of the cache if it's already there.
+	// Returns true if a new read was started. Prefetch hits and misses are reported in the cache miss log.
+	bool PrefetchChunk(const FChunkKey& InKey, const TSharedPtr<FSoundWaveData>& InSoundWaveData);
+
 	// add an additional reference for a chunk.
 	void AddNewReferenceToChunk(const FChunkKey& InKey);
 	void RemoveReferenceToChunk(const FChunkKey& InKey);
@@ -218,6 +222,10 @@ public:
 
 private:
 
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FAudioChunkCacheLookupStressTest;
+#endif
+
 #if DEBUG_STREAM_CACHE
 	// This struct lets us breadcrumb debug information.
 	struct FCacheElementDebugInfo
@@ -293,6 +301,9 @@ private:
 		// How many disparate consumers have called GetLoadedChunk.
 		FThreadSafeCounter NumConsumers;
 
+		// Set when this chunk was read by PrefetchChunk, and cleared once it's first asked for or evicted.
+		bool bWasPrefetched = false;
+
 #if WITH_EDITORONLY_DATA
 		TUniquePtr<FAsyncStreamDerivedChunkTask> DDCTask;
 #endif
@@ -418,9 +429,14 @@ private:
 	mutable FCriticalSection CacheMutationCriticalSection;
 
 	// Map that USoundWaves, FSoundWaveProxys, FChunkKeys, and FAudioChunkHandles can use to
-	// quickly lookup where their chunks are currently stored in the cache
+	// quickly lookup where their chunks are currently stored in the cache.
+	// Kept in sync with the element keys, so that any chunk in the cache can be found without searching the LRU list.
 	TMap<FChunkKey, uint64> CacheLookupIdMap;
 
+	// Read write lock: guards CacheLookupIdMap and the keys of the elements. Lookups only take it for read, so that
+	// consumers of chunks already in the cache don't contend with each other. Always acquired after CacheMutationCriticalSection.
+	mutable FRWLock CacheLookupIdLock;
+
 	struct FSoundWaveMemoryTracker
 	{
 		int32 RefCount = 0;
@@ -446,6 +462,12 @@ private:
 	// This is set to true when BeginLoggingCacheMisses is called. 
 	bool bLogCacheMisses;
 
+	// Prefetch statistics: reads started by PrefetchChunk, and how they resolved.
+	FThreadSafeCounter NumPrefetchedChunks;
+	FThreadSafeCounter NumPrefetchHits;
+	FThreadSafeCounter NumLatePrefetches;
+	FThreadSafeCounter NumUnusedPrefetches;
+
 	uint64 GetCurrentMemoryUsageBytes() const { return MemoryCounterBytes + ForceInlineMemoryCounterBytes + FeatureMemoryCounterBytes; }
 
 	// Returns cached element if it exists in our cache, nullptr otherwise.
@@ -454,6 +476,9 @@ private:
 	FCacheElement* LinearSearchCacheForElement(const FChunkKey& InKey);
 	FCacheElement* LinearSearchChunkArrayForElement(const FChunkKey& InKey);
 
+	// Changes the key of an element and updates CacheLookupIdMap accordingly.
+	void SetElementKey(FCacheElement* InElement, const FChunkKey& InKey);
+
 	// Puts this element at the front of the linked list.
 	void TouchElement(FCacheElement* InElement);
 
@@ -551,12 +576,18 @@ public:
 	// IAudioStreamingManager interface (used functions)
 	virtual bool RequestChunk(const FSoundWaveProxyPtr& SoundWave, uint32 ChunkIndex, TFunction<void(EAudioChunkLoadResult)> OnLoadCompleted, ENamedThreads::Type ThreadToCallOnLoadCompletedOn, bool bForImmediatePlayback = false) override;
 	virtual FAudioChunkHandle GetLoadedChunk(const FSoundWaveProxyPtr&  SoundWave, uint32 ChunkIndex, bool bBlockForLoad = false, bool bForImmediatePlayback = false) const override;
+	virtual void PrefetchChunks(TArrayView<const FAudioChunkPrefetchRequest> Requests) override;
 	virtual uint64 TrimMemory(uint64 NumBytesToFree) override;
 	virtual int32 RenderStatAudioStreaming(UWorld* World, FViewport* Viewport, FCanvas* Canvas, int32 X, int32 Y, const FVector* ViewLocation, const FRotator* ViewRotation) override;
 	virtual FString GenerateMemoryReport() override;
 	virtual void SetProfilingMode(bool bEnabled) override;
 	// End IAudioStreamingManager interface
 
+	/**
+	 * Returns the index of the chunk holding the audio at the given fraction of a wave's duration, clamped to [0, 1].
+	 * Uses the seek table of the chunks if they have one, otherwise assumes a constant bitrate.
+	 */
+	static int32 GetChunkIndexForPlaybackFraction(int32 NumChunks, int32 NumFrames, float PlaybackFraction, TFunctionRef<const FStreamedAudioChunk&(int32)> GetChunk);
 
 protected:
 
@@ -581,6 +612,11 @@ protected:
 	 */
 	int32 GetNextChunkIndex(const FSoundWaveProxyPtr&  InSoundWave, uint32 CurrentChunkIndex) const;
 
+	/**
+	 * Returns the index of the chunk holding the audio at the given playback time, in seconds.
+	 */
+	int32 GetChunkIndexForTime(const FSoundWaveProxyPtr& InSoundWave, float InTime) const;
+
 	/** Audio chunk caches. These are set up on initialization. */
 	TArray<FAudioChunkCache> CacheArray;
 };
@@ -510,6 +510,21 @@ enum class EAudioChunkLoadResult : uint8
 	CacheBlown
 };
 
+/** A sound wave that is playing or about to play, whose upcoming chunks should be read ahead of its decoder. */
+struct FAudioChunkPrefetchRequest
+{
+	FSoundWaveProxyPtr SoundWave;
+
+	/** Current playback position in the sound wave, in seconds. */
+	float PlaybackTime = 0.0f;
+
+	/** Requests with a higher priority are read first. */
+	float Priority = 0.0f;
+
+	/** Whether playback wraps back around to the start of the sound wave. */
+	bool bLooping = false;
+};
+
 /**
  * Interface to add functions specifically related to audio streaming
  */
@@ -571,6 +586,14 @@ struct IAudioStreamingManager : public IStreamingManager
 	 */
 	virtual FAudioChunkHandle GetLoadedChunk(const FSoundWaveProxyPtr&  SoundWave, uint32 ChunkIndex,  bool bBlockForLoad = false, bool bForImmediatePlayback = false) const = 0;
 
+	/**
+	 * Reads the chunks the given sound waves will need within the prefetch lookahead, so that they are in the cache before the decoder asks for them.
+	 * Called from the audio thread once per update with every sound currently worth prefetching for.
+	 *
+	 * @param Requests	The playing and about to play sound waves, in no particular order.
+	 */
+	virtual void PrefetchChunks(TArrayView<const FAudioChunkPrefetchRequest> Requests) {}
+
 	/**
 	 * This will start evicting elements from the cache until either hit our target of bytes or run out of chunks we can free.
 	 *
@@ -124,6 +124,11 @@ typedef TConstRepDataBuffer<ERepDataBufferType::ShadowBuffer> FConstRepShadowDat
 class FRepLayout;
 class FRepLayoutCmd;
 
+namespace UE::Net::Private
+{
+	struct FRepLayoutTestUtil;
+}
+
 namespace UE::Net
 {
 	/**
@@ -861,6 +866,20 @@ public:
 	ERepLayoutCmdType Type;
 	ERepLayoutCmdFlags Flags;
 };
+
+/**
+ * Part of the compare plan of an FRepLayout.
+ * Describes a run of Layout Commands holding plain old data that is contiguous in both Object and Shadow Memory,
+ * which allows the whole run to be compared with a single memory compare.
+ */
+struct FRepLayoutCompareBlock
+{
+	/** Number of commands in the run starting at this command, or 0 if no run starts here. */
+	uint16 NumCmds = 0;
+
+	/** Size of the run in bytes. */
+	uint16 NumBytes = 0;
+};
 	
 /** Converts a relative handle to the appropriate index into the Cmds array */
 class FHandleToCmdIndex
@@ -1156,6 +1175,10 @@ private:
 	friend class FNetSerializeCB;
 	friend struct FCustomDeltaPropertyIterator;
 
+#if WITH_DEV_AUTOMATION_TESTS
+	friend UE::Net::Private::FRepLayoutTestUtil;
+#endif
+
 	FRepLayout();
 
 public:
@@ -1782,6 +1805,9 @@ private:
 		const int32 CmdEnd,
 		TArray<FHandleToCmdIndex>& HandleToCmdIndex);
 
+	/** Builds CompareBlocks. Must be called after shadow offsets have been assigned. */
+	void BuildCompareBlocks();
+
 	ERepLayoutResult UpdateChangelistMgr(
 		FSendingRepState* RESTRICT RepState,
 		FReplicationChangelistMgr& InChangelistMgr,
@@ -1862,6 +1888,13 @@ private:
 	/** Converts a relative handle to the appropriate index into the Cmds array */
 	TArray<FHandleToCmdIndex> BaseHandleToCmdIndex;
 
+	/**
+	 * Compare plan, indexed by command.
+	 * Lets CompareProperties skip runs of unchanged POD properties with a single memory compare.
+	 * Empty if the layout has no such runs.
+	 */
+	TArray<FRepLayoutCompareBlock> CompareBlocks;
+
 	/**
 	 * Special state tracking for Lifetime Custom Delta Properties.
 	 * Will only ever be valid if the Layout has Lifetime Custom Delta Properties.
@@ -10,12 +10,20 @@
 #include "Net/ReplayResult.h"
 #include "ReplayTypes.h"
 #include "Containers/ArrayView.h"
+#include "Tasks/Task.h"
 
 class APlayerController;
 class UNetConnection;
 
 class FReplayHelper;
 
+#if WITH_DEV_AUTOMATION_TESTS
+namespace UE::Net::Private
+{
+	struct FReplayHelperTestUtil;
+}
+#endif
+
 class FReplayResultHandler final : public UE::Net::FNetResultHandler
 {
 	friend class FReplayHelper;
@@ -35,6 +43,9 @@ class FReplayHelper
 	friend class UDemoNetConnection;
 	friend class UReplayNetConnection;
 	friend class FReplayResultHandler;
+#if WITH_DEV_AUTOMATION_TESTS
+	friend UE::Net::Private::FReplayHelperTestUtil;
+#endif
 
 public:
 	FReplayHelper();
@@ -135,6 +146,8 @@ private:
 	void RecordFrame(float DeltaSeconds, UNetConnection* Connection);
 
 	void WriteDemoFrame(UNetConnection* Connection, FArchive& Ar, TArray<FQueuedDemoPacket>& QueuedPackets, float FrameTime, EWriteDemoFrameFlags Flags);
+	void WriteDemoFrameHeader(UNetConnection* Connection, FArchive& Ar, float FrameTime, EWriteDemoFrameFlags Flags);
+	static void WriteDemoFramePackets(FArchive& Ar, TArray<FQueuedDemoPacket>& QueuedPackets, bool bLevelStreamingFixes);
 	bool ReadDemoFrame(UNetConnection* Connection, FArchive& Ar, TArray<FPlaybackPacket>& InPlaybackPackets, const bool bForLevelFastForward, const FArchivePos MaxArchiveReadPos, float* OutTime);
 
 	// Possible values returned by ReadPacket.
@@ -164,9 +177,16 @@ private:
 	 */
 	static const EReadPacketState ReadPacket(FArchive& Archive, TArray<uint8>& OutBuffer, const EReadPacketMode Mode);
 
+	struct FNetGuidCacheItem;
+
 	void CacheNetGuids(UNetConnection* Connection);
 
 	bool SerializeGuidCache(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
+	static void SerializeGuidCacheItem(FArchive& Ar, FNetGuidCacheItem& Item, TMap<FName, uint32>& NameTableMap, UNetConnection* Connection);
+	bool SnapshotGuidCache(UNetConnection* Connection, const FRepActorsCheckpointParams& Params);
+	void LaunchAsyncCheckpointTask(const FArchive& CheckpointArchive);
+	bool AppendAsyncCheckpointData(const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
+	void WriteCheckpointOffset(FArchive& CheckpointArchive, FArchivePos DemoFramePos);
 	bool SerializeDeletedStartupActors(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
 	bool SerializeDeltaDynamicDestroyed(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
 	bool SerializeDeltaClosedChannels(UNetConnection* Connection, const FRepActorsCheckpointParams& Params, FArchive* CheckpointArchive);
@@ -267,6 +287,7 @@ private:
 		SerializeGuidCache,
 		SerializeNetFieldExportGroupMap,
 		SerializeDemoFrameFromQueuedDemoPackets,
+		AppendAsyncCheckpointData,
 		Finalize,
 	};
 
@@ -331,10 +352,36 @@ private:
 		int32 LevelIndex;
 	};
 
+	/** Net guid cache entry resolved on the game thread, so that the guid cache can be serialized on a worker thread */
 	struct FNetGuidCacheItem
 	{
 		FNetworkGUID NetGuid;
-		FNetGuidCacheObject NetGuidCacheObject;
+		TWeakObjectPtr<UObject> Object;	// Checked again on the game thread before the item is serialized
+		FNetworkGUID OuterGUID;
+		FName PathName;
+		FString RemappedPathName;	// Set by SnapshotGuidCache for the first item exporting a path name, so that the worker thread doesn't remap it
+		uint8 Flags;
+	};
+
+	/**
+	 * Checkpoint data gathered on the game thread when demo.CheckpointSerializeAsync is enabled.
+	 * A task serializes it into Data, which the game thread appends to the checkpoint archive once the task completed.
+	 */
+	struct FAsyncCheckpointData
+	{
+		TArray<FNetGuidCacheItem> NetGuidCacheItems;	// Items still valid once the guid cache snapshot was checked on the game thread
+		TMap<FName, uint32> NameTableMap;				// Owned by the task while it runs, moved back into the checkpoint context afterwards
+		TSet<FName> ExportedPathNames;					// Game thread only, path names the items will export
+		TArray<uint8> NetFieldExportData;
+		TArray<uint8> DemoFrameHeaderData;
+		TArray<FQueuedDemoPacket> DemoFramePackets;		// Replicated state of the checkpoint actors
+		bool bLevelStreamingFixes = false;
+
+		TArray<uint8> Data;
+		int64 DemoFrameOffset = 0;						// Offset of the demo frame in Data
+		int32 NumNetGuids = 0;
+
+		void CountBytes(FArchive& Ar) const;
 	};
 
 	/** Checkpoint state */
@@ -374,6 +421,9 @@ private:
 		int32 NumNetGuidsForRecording;
 		FArchivePos NetGuidsCountPos;
 
+		TSharedPtr<FAsyncCheckpointData> AsyncCheckpointData;			// Valid while a checkpoint is saved with demo.CheckpointSerializeAsync
+		UE::Tasks::FTask AsyncCheckpointTask;
+
 		TArray<FString> CheckpointDeletedNetStartupActors;
 
 		TMap<FName, uint32> NameTableMap;
@@ -547,6 +547,14 @@ private:
 		/** Memory budget allocated for the job cache */
 		uint64 CacheMemBudget = 0;
 
+		/** Total number of queries to the on-disk tier of the job cache, and how many of them found an output. */
+		uint64 TotalCacheDiskQueries = 0;
+		uint64 TotalCacheDiskHits = 0;
+
+		/** Size of the outputs stored on disk by the job cache, and the size they are trimmed to. */
+		uint64 CacheDiskUsed = 0;
+		uint64 CacheDiskBudget = 0;
+
 		FCounters& operator+=(const FCounters& Other)
 		{
 			AccumulatedLocalWorkerIdleTime += Other.AccumulatedLocalWorkerIdleTime;
@@ -583,6 +591,11 @@ private:
 			UniqueCacheOutputs += Other.UniqueCacheOutputs;
 			CacheMemUsed += Other.CacheMemUsed;
 			CacheMemBudget += Other.CacheMemBudget;
+			TotalCacheDiskQueries += Other.TotalCacheDiskQueries;
+			TotalCacheDiskHits += Other.TotalCacheDiskHits;
+			// Cook processes share the same disk cache
+			CacheDiskUsed = FMath::Max(Other.CacheDiskUsed, CacheDiskUsed);
+			CacheDiskBudget = FMath::Max(Other.CacheDiskBudget, CacheDiskBudget);
 
 			return *this;
 		}
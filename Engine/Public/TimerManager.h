@@ -18,6 +18,7 @@
 class UGameInstance;
 enum class ELevelCollectionType : uint8;
 struct FTimerSourceList;
+struct FTimerWheel;
 
 // using "not checked" user policy (means race detection is disabled) because this delegate is stored in a TSparseArray and causes its reallocation
 // from inside delegate's execution. This is incompatible with race detection that needs to access the delegate instance after its execution
@@ -144,6 +145,9 @@ struct FTimerData
 	/** The level collection that was active when this timer was created. Used to set the correct context before executing the timer's delegate. */
 	ELevelCollectionType LevelCollection;
 
+	/** Incremented each time the timer is scheduled on a timing wheel, so that entries left behind by a pause or reschedule can be recognized as stale. */
+	uint32 ScheduleSerial;
+
 	ENGINE_API FTimerData();
 
 	// Movable only
@@ -177,6 +181,14 @@ public:
 	// Timer API
 
 	ENGINE_API explicit FTimerManager(UGameInstance* GameInstance = nullptr);
+
+	/**
+	 * Constructs a timer manager with an explicit choice of active timer storage, instead of the TimerManager.UseTimingWheel setting.
+	 *
+	 * @param GameInstance			The game instance that owns this timer manager, may be null.
+	 * @param bInUseTimingWheel		true to keep active timers in a hierarchical timing wheel, false to keep them in a binary heap.
+	 */
+	ENGINE_API FTimerManager(UGameInstance* GameInstance, bool bInUseTimingWheel);
 	ENGINE_API virtual ~FTimerManager();
 
 	/**
@@ -430,6 +442,12 @@ public:
 		return (LastTickedFrame == GFrameCounter);
 	}
 
+	/** Returns true if active timers are kept in a hierarchical timing wheel rather than a binary heap. */
+	bool FORCEINLINE IsUsingTimingWheel() const
+	{
+		return TimingWheel.IsValid();
+	}
+
 	/**
 	 * Finds a handle to a timer bound to a particular dynamic delegate.
 	 * This function is intended to be used only by the K2 system.
@@ -483,10 +501,23 @@ private:
 	ENGINE_API void RemoveTimer(FTimerHandle Handle);
 	ENGINE_API bool WillRemoveTimerAssert(FTimerHandle Handle) const;
 
+	/** Schedules a timer whose status is Active and whose ExpireTime is on the running clock. */
+	ENGINE_API void ActivateTimer(FTimerHandle Handle);
+	/** Unschedules an active timer, e.g. before it gets paused. */
+	ENGINE_API void DeactivateTimer(FTimerHandle Handle);
+	/** Pops the next scheduled timer that expired before InternalTime, in expire time order. Returns false when there are none left. */
+	ENGINE_API bool PopExpiredTimer(FTimerHandle& OutHandle);
+	/** Number of entries in the active timer storage, including ones pending removal. */
+	ENGINE_API int32 GetNumActiveTimerEntries() const;
+	/** Gathers the handles of all scheduled timers, including ones pending removal. */
+	ENGINE_API void GetActiveTimerHandles(TArray<FTimerHandle>& OutHandles) const;
+
 	/** The array of timers - all other arrays will index into this */
 	TSparseArray<FTimerData> Timers;
 	/** Heap of actively running timers. */
 	TArray<FTimerHandle> ActiveTimerHeap;
+	/** Timing wheel of actively running timers, used instead of ActiveTimerHeap when valid. */
+	TUniquePtr<FTimerWheel> TimingWheel;
 	/** Set of paused timers. */
 	TSet<FTimerHandle> PausedTimerSet;
 	/** Set of timers added this frame, to be added after timer has been ticked */
@@ -219,6 +219,105 @@ struct FOverlapDatum : FBaseTraceDatum
 	              const FVector& InPos, const FQuat& InRot, const FOverlapDelegate* InDelegate, int32 FrameCounter);
 };
 
+/**
+ * Batch of traces/sweeps sharing the same collision parameters, submitted with UWorld::AsyncTraceBatch
+ *
+ * Inputs and outputs are stored as parallel arrays indexed by query, and hits are written into per chunk buffers
+ * that are kept across Reset, so a batch that is reused every frame doesn't allocate once it has reached its peak size.
+ * Unlike the per trace async API there are no delegates or handles: call Wait (or wait for the next frame) and read results by query index.
+ */
+struct FTraceBatch : FNoncopyable
+{
+	ENGINE_API FTraceBatch();
+	ENGINE_API ~FTraceBatch();
+
+	/** Removes all queries and results, keeping allocations. Waits for any in flight execution. */
+	ENGINE_API void Reset();
+
+	/** Preallocates space for the given number of queries */
+	ENGINE_API void Reserve(int32 NumQueries);
+
+	/**
+	 * Sets the parameters used by every query in the batch. A line shape (or a nearly zero shape) runs raycasts, anything else runs sweeps.
+	 * Waits for the previous execution if it is still in flight.
+	 */
+	ENGINE_API void SetParams(EAsyncTraceType InTraceType, ECollisionChannel InTraceChannel, const FCollisionShape& InCollisionShape, const FCollisionQueryParams& InParams,
+		const FCollisionResponseParams& InResponseParam = FCollisionResponseParams::DefaultResponseParam, const FCollisionObjectQueryParams& InObjectQueryParam = FCollisionObjectQueryParams::DefaultObjectQueryParam);
+
+	/** Adds a query and returns its index in the batch. Waits for the previous execution if it is still in flight. */
+	int32 Add(const FVector& Start, const FVector& End, const FQuat& Rot = FQuat::Identity)
+	{
+		// Results of the previous execution may have been read in the next frame without calling Wait, release its events
+		if (CompletionEvents.Num() > 0)
+		{
+			Wait();
+		}
+		Starts.Add(Start);
+		Ends.Add(End);
+		return Rots.Add(Rot);
+	}
+
+	/** Number of queries in the batch */
+	int32 Num() const
+	{
+		return Starts.Num();
+	}
+
+	/** Blocks until the batch has been executed. Results can only be read after this returns or after the world has started the next frame. */
+	ENGINE_API void Wait();
+
+	/** Whether the batch has finished executing, without blocking */
+	ENGINE_API bool IsComplete() const;
+
+	/** Whether the query found a blocking hit. Valid for every trace type. */
+	bool HasBlockingHit(int32 QueryIndex) const
+	{
+		checkSlow(IsComplete());
+		return BlockingHits[QueryIndex] != 0;
+	}
+
+	/** Hits of the query: empty for Test, at most one for Single, the blocking hit and any touches up to it for Multi */
+	ENGINE_API TArrayView<const FHitResult> GetHits(int32 QueryIndex) const;
+
+private:
+
+	friend class UWorld;
+
+	/** Persistent output of one execution chunk */
+	struct FChunk
+	{
+		/** Hits of every query in the chunk, contiguous per query */
+		TArray<FHitResult> Hits;
+		/** Scratch buffer for multi queries since they reset their output array */
+		TArray<FHitResult> Scratch;
+	};
+
+	/** Runs the queries in [FirstQuery, FirstQuery + NumQueries) and writes their results to the given chunk */
+	void RunChunk(const UWorld* World, int32 ChunkIndex, int32 FirstQuery, int32 NumQueries);
+
+	/** Shared query parameters */
+	FCollisionParameters CollisionParams;
+	ECollisionChannel TraceChannel;
+	EAsyncTraceType TraceType;
+
+	/** Queries */
+	TArray<FVector> Starts;
+	TArray<FVector> Ends;
+	TArray<FQuat> Rots;
+
+	/** Results, one entry per query. HitStarts indexes into the hits of the chunk that ran the query. */
+	TArray<uint8> BlockingHits;
+	TArray<int32> HitStarts;
+	TArray<int32> HitCounts;
+
+	/** Number of queries per chunk for the last submission */
+	int32 ChunkSize;
+	TArray<FChunk> Chunks;
+
+	/** Completion events of the chunks dispatched to worker threads */
+	FGraphEventArray CompletionEvents;
+};
+
 #define ASYNC_TRACE_BUFFER_SIZE 64
 
 /**
@@ -183,6 +183,11 @@ struct FSpatialHashStreamingGrid
 	ENGINE_API int64 GetCellSize(int32 Level) const;
 	ENGINE_API void GetCells(const FWorldPartitionStreamingQuerySource& QuerySource, TSet<const UWorldPartitionRuntimeCell*>& OutCells, bool bEnableZCulling, FWorldPartitionQueryCache* QueryCache = nullptr) const;
 	ENGINE_API void GetCells(const TArray<FWorldPartitionStreamingSource>& Sources, UWorldPartitionRuntimeHash::FStreamingSourceCells& OutActivateCells, UWorldPartitionRuntimeHash::FStreamingSourceCells& OutLoadCells, bool bEnableZCulling) const;
+	/**
+	 * Same as GetCells, but only re-rasterizes the sources whose shapes changed since the previous call, merging the
+	 * cells entering and leaving them into reference counted cells. Returns false when the full query must be used instead.
+	 */
+	ENGINE_API bool GetCellsIncremental(const TArray<FWorldPartitionStreamingSource>& Sources, UWorldPartitionRuntimeHash::FStreamingSourceCells& OutActivateCells, UWorldPartitionRuntimeHash::FStreamingSourceCells& OutLoadCells, bool bEnableZCulling) const;
 	ENGINE_API void GetNonSpatiallyLoadedCells(TSet<const UWorldPartitionRuntimeCell*>& OutActivateCells, TSet<const UWorldPartitionRuntimeCell*>& OutLoadCells) const;
 	ENGINE_API void Draw2D(const class UWorldPartitionRuntimeSpatialHash* Owner, const FBox2D& Region2D, const FBox2D& GridScreenBounds, TFunctionRef<FVector2D(const FVector2D&, bool)> WorldToScreen, FWorldPartitionDraw2DContext& DrawContext) const;
 	ENGINE_API void Draw3D(const class UWorldPartitionRuntimeSpatialHash* Owner, const TArray<FWorldPartitionStreamingSource>& Sources, const FTransform& Transform) const;
@@ -203,6 +208,9 @@ private:
 	ENGINE_API EWorldPartitionRuntimeCellVisualizeMode GetStreamingCellVisualizeMode() const;
 	mutable FSquare2DGridHelper* GridHelper;
 
+	// Per source cell coordinates and their cells from the previous GetCellsIncremental call, reset when the grid cells change
+	mutable TSharedPtr<struct FSpatialHashStreamingGridIncrementalState> IncrementalState;
+
 	// Contains cells injected at runtime from content bundles
 	UPROPERTY(Transient)
 	mutable TArray<FSpatialHashStreamingGridLevel> InjectedGridLevels;
@@ -10,6 +10,8 @@
 #include "Math/RandomStream.h"
 #include "Stats/Stats.h"
 #include "Async/AsyncWork.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeLock.h"
 #include "HAL/IConsoleManager.h"
 #include "Misc/App.h"
 #include "UObject/ObjectMacros.h"
@@ -128,6 +130,25 @@ static FAutoConsoleVariableRef CVarMaxAsyncTasks(
 	GMaxAsyncTasks,
 	TEXT("Used to control the number of grass components created at a time."));
 
+static int32 GGrassParallelBuild = 0;
+static FAutoConsoleVariableRef CVarGrassParallelBuild(
+	TEXT("grass.ParallelBuild"),
+	GGrassParallelBuild,
+	TEXT("If non-zero, the instances of a grass component are generated in parallel tiles rather than by a single async task.\n")
+	TEXT("Parallel builds use a random stream per tile, so the placement differs from the default single threaded build, which keeps the placement of a single stream per component."));
+
+static int32 GGrassBuildInstancesPerTile = 4096;
+static FAutoConsoleVariableRef CVarGrassBuildInstancesPerTile(
+	TEXT("grass.BuildInstancesPerTile"),
+	GGrassBuildInstancesPerTile,
+	TEXT("Number of candidate instances generated per tile when building grass in parallel. Each tile has its own random stream, so changing this changes the placement."));
+
+static float GGrassBuildScratchIdleTime = 10.0f;
+static FAutoConsoleVariableRef CVarGrassBuildScratchIdleTime(
+	TEXT("grass.BuildScratchIdleTime"),
+	GGrassBuildScratchIdleTime,
+	TEXT("Time in seconds after which the scratch buffers pooled for building grass are freed if no build used them."));
+
 static float GGrassDensityScale = 1;
 static FAutoConsoleVariableRef CVarGrassDensityScale(
 	TEXT("grass.densityScale"),
@@ -1823,6 +1844,105 @@ private:
 	int32 Stride;
 };
 
+// Scratch buffers for FAsyncGrassBuilder::Build, pooled so that building grass while streaming doesn't reallocate them for every component
+struct FGrassBuildScratch
+{
+	struct FInstanceLocal
+	{
+		FVector Pos;
+		FVector Normal;
+		bool bKeep;
+		float Weight;
+	};
+
+	struct FTile
+	{
+		FRandomStream RandomStream;
+		int32 NumKept;
+		int32 FirstOutputIndex;
+	};
+
+	TArray<FInstanceLocal> Instances;
+	TArray<FTile> Tiles;
+	TArray<FMatrix> InstanceTransforms;
+	TArray<float> InstanceRandomIDs;
+	TArray<int32> SortedInstances;
+	TArray<int32> InstanceReorderTable;
+	TArray<FVector4> LegacyScaleRotations;
+
+	void Reset()
+	{
+		Instances.Reset();
+		Tiles.Reset();
+		InstanceTransforms.Reset();
+		InstanceRandomIDs.Reset();
+		SortedInstances.Reset();
+		InstanceReorderTable.Reset();
+		LegacyScaleRotations.Reset();
+	}
+};
+
+class FGrassBuildScratchPool
+{
+public:
+	static FGrassBuildScratchPool& Get()
+	{
+		static FGrassBuildScratchPool Pool;
+		return Pool;
+	}
+
+	TUniquePtr<FGrassBuildScratch> Acquire()
+	{
+		FScopeLock Lock(&CriticalSection);
+		// The most recently released scratch is the least likely to be freed for being idle
+		return FreeScratch.Num() ? FreeScratch.Pop(EAllowShrinking::No).Scratch : MakeUnique<FGrassBuildScratch>();
+	}
+
+	void Release(TUniquePtr<FGrassBuildScratch> Scratch)
+	{
+		Scratch->Reset();
+		FScopeLock Lock(&CriticalSection);
+		// Keep as many as there can be builds in flight, anything beyond that is only needed after a burst of builds (e.g. flushing the cache)
+		if (FreeScratch.Num() < FMath::Max(GMaxAsyncTasks, 1))
+		{
+			FreeScratch.Push({ MoveTemp(Scratch), FPlatformTime::Seconds() });
+		}
+	}
+
+	/** Frees the scratch buffers no build used for grass.BuildScratchIdleTime, so that the largest component built doesn't keep its buffers alive for good */
+	void Trim()
+	{
+		FScopeLock Lock(&CriticalSection);
+		// Released in order, so the idle ones are at the front
+		const double IdleTime = FPlatformTime::Seconds() - GGrassBuildScratchIdleTime;
+		int32 NumIdle = 0;
+		while (NumIdle < FreeScratch.Num() && FreeScratch[NumIdle].ReleaseTime < IdleTime)
+		{
+			NumIdle++;
+		}
+		if (NumIdle > 0)
+		{
+			FreeScratch.RemoveAt(0, NumIdle, EAllowShrinking::No);
+		}
+	}
+
+	void Empty()
+	{
+		FScopeLock Lock(&CriticalSection);
+		FreeScratch.Empty();
+	}
+
+private:
+	struct FFreeScratch
+	{
+		TUniquePtr<FGrassBuildScratch> Scratch;
+		double ReleaseTime;
+	};
+
+	FCriticalSection CriticalSection;
+	TArray<FFreeScratch> FreeScratch;
+};
+
 struct FAsyncGrassBuilder : public FGrassBuilderBase
 {
 	FLandscapeComponentGrassAccess GrassData;
@@ -1837,6 +1957,7 @@ struct FAsyncGrassBuilder : public FGrassBuilderBase
 	bool bAlignToSurface;
 	float PlacementJitter;
 	FRandomStream RandomStream;
+	bool bParallelBuild;
 	FMatrix XForm;
 	FBox MeshBox;
 	int32 DesiredInstancesPerLeaf;
@@ -1875,6 +1996,7 @@ struct FAsyncGrassBuilder : public FGrassBuilderBase
 		, bAlignToSurface(GrassVariety.AlignToSurface)
 		, PlacementJitter(GrassVariety.PlacementJitter)
 		, RandomStream(GrassInstancedStaticMeshComponent->InstancingRandomSeed)
+		, bParallelBuild(GGrassParallelBuild != 0)
 		, XForm(LandscapeToWorld * GrassInstancedStaticMeshComponent->GetComponentTransform().ToMatrixWithScale().Inverse())
 		, MeshBox(GrassVariety.GrassMesh->GetBounds().GetBox())
 		, DesiredInstancesPerLeaf(GrassInstancedStaticMeshComponent->DesiredInstancesPerLeaf())
@@ -1993,11 +2115,11 @@ struct FAsyncGrassBuilder : public FGrassBuilderBase
 			FVector2D LightMapCoordinate = NormalizedGrassCoordinate * LightmapBaseScale + LightmapBaseBias;
 			FVector2D ShadowMapCoordinate = NormalizedGrassCoordinate * ShadowmapBaseScale + ShadowmapBaseBias;
 
-			InstanceBuffer.SetInstance(InstanceIndex, FMatrix44f(InXForm), RandomStream.GetFraction(), LightMapCoordinate, ShadowMapCoordinate);
+			InstanceBuffer.SetInstance(InstanceIndex, FMatrix44f(InXForm), RandomFraction, LightMapCoordinate, ShadowMapCoordinate);
 		}
 		else
 		{
-			InstanceBuffer.SetInstance(InstanceIndex, FMatrix44f(InXForm), RandomStream.GetFraction());
+			InstanceBuffer.SetInstance(InstanceIndex, FMatrix44f(InXForm), RandomFraction);
 		}
 	}
 
@@ -2023,7 +2145,7 @@ struct FAsyncGrassBuilder : public FGrassBuilderBase
 		return Result;
 	}
 
-	FVector GetRandomScale(float InWeight) const
+	FVector GetRandomScale(float InWeight, FRandomStream& InRandomStream) const
 	{
 		FVector Result(1.0f);
 
@@ -2036,19 +2158,19 @@ struct FAsyncGrassBuilder : public FGrassBuilderBase
 		switch (Scaling)
 		{
 		case EGrassScaling::Uniform:
-			Result.X = ScaleX.Interpolate(RandomStream.GetFraction() * WeightAttenuationFactor);
+			Result.X = ScaleX.Interpolate(InRandomStream.GetFraction() * WeightAttenuationFactor);
 			Result.Y = Result.X;
 			Result.Z = Result.X;
 			break;
 		case EGrassScaling::Free:
-			Result.X = ScaleX.Interpolate(RandomStream.GetFraction() * WeightAttenuationFactor);
-			Result.Y = ScaleY.Interpolate(RandomStream.GetFraction() * WeightAttenuationFactor);
-			Result.Z = ScaleZ.Interpolate(RandomStream.GetFraction() * WeightAttenuationFactor);
+			Result.X = ScaleX.Interpolate(InRandomStream.GetFraction() * WeightAttenuationFactor);
+			Result.Y = ScaleY.Interpolate(InRandomStream.GetFraction() * WeightAttenuationFactor);
+			Result.Z = ScaleZ.Interpolate(InRandomStream.GetFraction() * WeightAttenuationFactor);
 			break;
 		case EGrassScaling::LockXY:
-			Result.X = ScaleX.Interpolate(RandomStream.GetFraction() * WeightAttenuationFactor);
+			Result.X = ScaleX.Interpolate(InRandomStream.GetFraction() * WeightAttenuationFactor);
 			Result.Y = Result.X;
-			Result.Z = ScaleZ.Interpolate(RandomStream.GetFraction() * WeightAttenuationFactor);
+			Result.Z = ScaleZ.Interpolate(InRandomStream.GetFraction() * WeightAttenuationFactor);
 			break;
 		default:
 			check(0);
@@ -2076,8 +2198,9 @@ struct FAsyncGrassBuilder : public FGrassBuilderBase
 		double StartTime = FPlatformTime::Seconds();
 		const FVector DefaultScale = GetDefaultScale();
 		float Div = 1.0f / float(SqrtMaxInstances);
-		TArray<FMatrix> InstanceTransforms;
-		if (HaltonBaseIndex)
+		const bool bHalton = HaltonBaseIndex != 0;
+		FVector MaxJitter(0.0f);
+		if (bHalton)
 		{
 			if (Extent.X < 0)
 			{
@@ -2089,179 +2212,222 @@ struct FAsyncGrassBuilder : public FGrassBuilderBase
 				Origin.Y += Extent.Y;
 				Extent.Y *= -1.0f;
 			}
-			int32 MaxNum = SqrtMaxInstances * SqrtMaxInstances;
-			InstanceTransforms.Reserve(MaxNum);
-			FVector DivExtent(Extent * Div);
-			for (int32 InstanceIndex = 0; InstanceIndex < MaxNum; InstanceIndex++)
-			{
-				float HaltonX = Halton(InstanceIndex + HaltonBaseIndex, 2);
-				float HaltonY = Halton(InstanceIndex + HaltonBaseIndex, 3);
-				FVector Location(Origin.X + HaltonX * Extent.X, Origin.Y + HaltonY * Extent.Y, 0.0f);
-				FVector LocationWithHeight;
-				FVector ComputedNormal;
-				float Weight = 0.f;
-				SampleLandscapeAtLocationLocal(Location, LocationWithHeight, Weight, bAlignToSurface ? &ComputedNormal : nullptr);
-				bool bKeep = Weight > 0.0f && Weight >= RandomStream.GetFraction() && !IsExcluded(LocationWithHeight);
-				if (bKeep)
-				{
-					const FVector Scale = bRandomScale ? GetRandomScale(Weight) : DefaultScale;
-					const float Rot = bRandomRotation ? RandomStream.GetFraction() * 360.0f : 0.0f;
-					const FMatrix BaseXForm = FScaleRotationTranslationMatrix(Scale, FRotator(0.0f, Rot, 0.0f), FVector::ZeroVector);
-					FMatrix OutXForm;
-					if (bAlignToSurface && !ComputedNormal.IsNearlyZero())
-					{
-						const FVector NewZ = ComputedNormal * FMath::Sign(ComputedNormal.Z);
-						const FVector NewX = (FVector(0, -1, 0) ^ NewZ).GetSafeNormal();
-						const FVector NewY = NewZ ^ NewX;
-						const FMatrix Align = FMatrix(NewX, NewY, NewZ, FVector::ZeroVector);
-						OutXForm = (BaseXForm * Align).ConcatTranslation(LocationWithHeight) * XForm;
-					}
-					else
-					{
-						OutXForm = BaseXForm.ConcatTranslation(LocationWithHeight) * XForm;
-					}
-					InstanceTransforms.Add(OutXForm);
-				}
-			}
-			if (InstanceTransforms.Num())
-			{
-				TotalInstances += InstanceTransforms.Num();
-				InstanceBuffer.AllocateInstances(InstanceTransforms.Num(), 0, EResizeBufferFlags::AllowSlackOnGrow | EResizeBufferFlags::AllowSlackOnReduce, true);
-				for (int32 InstanceIndex = 0; InstanceIndex < InstanceTransforms.Num(); InstanceIndex++)
-				{
-					const FMatrix& OutXForm = InstanceTransforms[InstanceIndex];
-					SetInstance(InstanceIndex, OutXForm, RandomStream.GetFraction());
-				}
-			}
 		}
 		else
 		{
-			int32 NumKept = 0;
 			float MaxJitter1D = FMath::Clamp<float>(PlacementJitter, 0.0f, .99f) * Div * .5f;
-			FVector MaxJitter(MaxJitter1D, MaxJitter1D, 0.0f);
+			MaxJitter = FVector(MaxJitter1D, MaxJitter1D, 0.0f);
 			MaxJitter *= Extent;
 			Origin += Extent * (Div * 0.5f);
-			struct FInstanceLocal
-			{
-				FVector Pos;
-				bool bKeep;
-				float Weight;
-			};
-			TArray<FInstanceLocal> Instances;
-			Instances.AddUninitialized(SqrtMaxInstances * SqrtMaxInstances);
+		}
+
+		TUniquePtr<FGrassBuildScratch> Scratch = FGrassBuildScratchPool::Get().Acquire();
+		TArray<FGrassBuildScratch::FInstanceLocal>& Instances = Scratch->Instances;
+		TArray<FGrassBuildScratch::FTile>& Tiles = Scratch->Tiles;
+
+		// Instances are generated in tiles of consecutive candidates, each with its own random stream, so the result only depends on the tile size and not on how many workers pick them up.
+		// On the jittered grid the candidates are laid out column by column, so a tile is a run of columns.
+		// Single threaded builds use a single tile with the component's stream, drawing the random numbers in the same order as before tiles were added so that the placement doesn't change.
+		const int32 MaxNum = SqrtMaxInstances * SqrtMaxInstances;
+		const bool bLegacyRandomOrder = !bParallelBuild;
+		const int32 InstancesPerTile = bLegacyRandomOrder ? FMath::Max(MaxNum, 1) : FMath::Max(GGrassBuildInstancesPerTile, 1);
+		const int32 NumTiles = FMath::DivideAndRoundUp(MaxNum, InstancesPerTile);
+		const EParallelForFlags ParallelForFlags = (bParallelBuild && NumTiles > 1) ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread;
+
+		Instances.SetNumUninitialized(MaxNum, EAllowShrinking::No);
+		Tiles.SetNumUninitialized(NumTiles, EAllowShrinking::No);
+
+		// The legacy Halton path drew the scale and rotation of an instance right after deciding to keep it
+		const bool bLegacyHaltonOrder = bLegacyRandomOrder && bHalton;
+		TArray<FVector4>& LegacyScaleRotations = Scratch->LegacyScaleRotations;
+
+		{
+			QUICK_SCOPE_CYCLE_COUNTER(STAT_FoliageGrassAsyncBuild_Sample);
+
+			ParallelFor(NumTiles, [&](int32 TileIndex)
 			{
-				int32 InstanceIndex = 0;
-				for (int32 xStart = 0; xStart < SqrtMaxInstances; xStart++)
+				FGrassBuildScratch::FTile& Tile = Tiles[TileIndex];
+				Tile.RandomStream.Initialize(int32(uint32(RandomStream.GetInitialSeed()) + uint32(TileIndex) * 0x9E3779B9u));
+				Tile.NumKept = 0;
+
+				const int32 FirstIndex = TileIndex * InstancesPerTile;
+				const int32 LastIndex = FMath::Min(FirstIndex + InstancesPerTile, MaxNum);
+				for (int32 InstanceIndex = FirstIndex; InstanceIndex < LastIndex; InstanceIndex++)
 				{
-					for (int32 yStart = 0; yStart < SqrtMaxInstances; yStart++)
+					FGrassBuildScratch::FInstanceLocal& Instance = Instances[InstanceIndex];
+					float Weight = 0.f;
+					if (bHalton)
 					{
+						float HaltonX = Halton(InstanceIndex + HaltonBaseIndex, 2);
+						float HaltonY = Halton(InstanceIndex + HaltonBaseIndex, 3);
+						FVector Location(Origin.X + HaltonX * Extent.X, Origin.Y + HaltonY * Extent.Y, 0.0f);
+						Instance.Normal = FVector::ZeroVector;
+						SampleLandscapeAtLocationLocal(Location, Instance.Pos, Weight, bAlignToSurface ? &Instance.Normal : nullptr);
+					}
+					else
+					{
+						const int32 xStart = InstanceIndex / SqrtMaxInstances;
+						const int32 yStart = InstanceIndex % SqrtMaxInstances;
 						FVector Location(Origin.X + float(xStart) * Div * Extent.X, Origin.Y + float(yStart) * Div * Extent.Y, 0.0f);
 
 						// NOTE: We evaluate the random numbers on the stack and store them in locals rather than inline within the FVector() constructor below, because 
 						// the order of evaluation of function arguments in C++ is unspecified.  We really want this to behave consistently on all sorts of
 						// different platforms!
-						const float FirstRandom = RandomStream.GetFraction();
-						const float SecondRandom = RandomStream.GetFraction();
+						const float FirstRandom = Tile.RandomStream.GetFraction();
+						const float SecondRandom = Tile.RandomStream.GetFraction();
 						Location += FVector(FirstRandom * 2.0f - 1.0f, SecondRandom * 2.0f - 1.0f, 0.0f) * MaxJitter;
 
-						FInstanceLocal& Instance = Instances[InstanceIndex];
-						float Weight = 0.f;
 						SampleLandscapeAtLocationLocal(Location, Instance.Pos, Weight);
-						Instance.bKeep = Weight > 0.0f && Weight >= RandomStream.GetFraction() && !IsExcluded(Instance.Pos);
-						Instance.Weight = Weight;
-						if (Instance.bKeep)
+					}
+					Instance.bKeep = Weight > 0.0f && Weight >= Tile.RandomStream.GetFraction() && !IsExcluded(Instance.Pos);
+					Instance.Weight = Weight;
+					if (Instance.bKeep)
+					{
+						Tile.NumKept++;
+
+						if (bLegacyHaltonOrder)
 						{
-							NumKept++;
+							const FVector Scale = bRandomScale ? GetRandomScale(Weight, Tile.RandomStream) : DefaultScale;
+							const float Rot = bRandomRotation ? Tile.RandomStream.GetFraction() * 360.0f : 0.0f;
+							LegacyScaleRotations.Add(FVector4(Scale, Rot));
 						}
-						InstanceIndex++;
 					}
 				}
-			}
-			if (NumKept)
+			}, ParallelForFlags);
+		}
+
+		int32 NumKept = 0;
+		for (FGrassBuildScratch::FTile& Tile : Tiles)
+		{
+			Tile.FirstOutputIndex = NumKept;
+			NumKept += Tile.NumKept;
+		}
+
+		if (NumKept)
+		{
+			TotalInstances += NumKept;
+
+			// The transforms are only needed to build the tree, the instance buffer is filled in tree order afterwards
+			TArray<FMatrix>& InstanceTransforms = Scratch->InstanceTransforms;
+			TArray<float>& InstanceRandomIDs = Scratch->InstanceRandomIDs;
+			InstanceTransforms.SetNumUninitialized(NumKept, EAllowShrinking::No);
+			InstanceRandomIDs.SetNumUninitialized(NumKept, EAllowShrinking::No);
+
 			{
-				InstanceTransforms.AddUninitialized(NumKept);
-				TotalInstances += NumKept;
+				QUICK_SCOPE_CYCLE_COUNTER(STAT_FoliageGrassAsyncBuild_Transforms);
+
+				ParallelFor(NumTiles, [&](int32 TileIndex)
 				{
-					InstanceBuffer.AllocateInstances(NumKept, 0, EResizeBufferFlags::AllowSlackOnGrow | EResizeBufferFlags::AllowSlackOnReduce, true);
-					int32 InstanceIndex = 0;
-					int32 OutInstanceIndex = 0;
-					for (int32 xStart = 0; xStart < SqrtMaxInstances; xStart++)
+					FGrassBuildScratch::FTile& Tile = Tiles[TileIndex];
+					int32 OutInstanceIndex = Tile.FirstOutputIndex;
+
+					const int32 FirstIndex = TileIndex * InstancesPerTile;
+					const int32 LastIndex = FMath::Min(FirstIndex + InstancesPerTile, MaxNum);
+					for (int32 InstanceIndex = FirstIndex; InstanceIndex < LastIndex; InstanceIndex++)
 					{
-						for (int32 yStart = 0; yStart < SqrtMaxInstances; yStart++)
+						const FGrassBuildScratch::FInstanceLocal& Instance = Instances[InstanceIndex];
+						if (!Instance.bKeep)
 						{
-							const FInstanceLocal& Instance = Instances[InstanceIndex];
-							if (Instance.bKeep)
-							{
-								const FVector Scale = bRandomScale ? GetRandomScale(Instance.Weight) : DefaultScale;
-								const float Rot = bRandomRotation ? RandomStream.GetFraction() * 360.0f : 0.0f;
-								const FMatrix BaseXForm = FScaleRotationTranslationMatrix(Scale, FRotator(0.0f, Rot, 0.0f), FVector::ZeroVector);
-								FMatrix OutXForm;
-								if (bAlignToSurface)
-								{
-									FVector PosX1 = xStart ? Instances[InstanceIndex - SqrtMaxInstances].Pos : Instance.Pos;
-									FVector PosX2 = (xStart + 1 < SqrtMaxInstances) ? Instances[InstanceIndex + SqrtMaxInstances].Pos : Instance.Pos;
-									FVector PosY1 = yStart ? Instances[InstanceIndex - 1].Pos : Instance.Pos;
-									FVector PosY2 = (yStart + 1 < SqrtMaxInstances) ? Instances[InstanceIndex + 1].Pos : Instance.Pos;
-
-									if (PosX1 != PosX2 && PosY1 != PosY2)
-									{
-										FVector NewZ = ((PosX1 - PosX2) ^ (PosY1 - PosY2)).GetSafeNormal();
-										NewZ *= FMath::Sign(NewZ.Z);
-
-										const FVector NewX = (FVector(0, -1, 0) ^ NewZ).GetSafeNormal();
-										const FVector NewY = NewZ ^ NewX;
+							continue;
+						}
 
-										FMatrix Align = FMatrix(NewX, NewY, NewZ, FVector::ZeroVector);
-										OutXForm = (BaseXForm * Align).ConcatTranslation(Instance.Pos) * XForm;
-									}
-									else
-									{
-										OutXForm = BaseXForm.ConcatTranslation(Instance.Pos) * XForm;
-									}
-								}
-								else
+						FVector Scale;
+						float Rot;
+						if (bLegacyHaltonOrder)
+						{
+							const FVector4& ScaleRotation = LegacyScaleRotations[OutInstanceIndex];
+							Scale = FVector(ScaleRotation);
+							Rot = static_cast<float>(ScaleRotation.W);
+						}
+						else
+						{
+							Scale = bRandomScale ? GetRandomScale(Instance.Weight, Tile.RandomStream) : DefaultScale;
+							Rot = bRandomRotation ? Tile.RandomStream.GetFraction() * 360.0f : 0.0f;
+						}
+						const FMatrix BaseXForm = FScaleRotationTranslationMatrix(Scale, FRotator(0.0f, Rot, 0.0f), FVector::ZeroVector);
+						FVector NewZ = FVector::ZeroVector;
+						if (bAlignToSurface)
+						{
+							if (bHalton)
+							{
+								NewZ = Instance.Normal * FMath::Sign(Instance.Normal.Z);
+							}
+							else
+							{
+								// Neighbours may belong to other tiles, their positions are all known once sampling is done
+								const int32 xStart = InstanceIndex / SqrtMaxInstances;
+								const int32 yStart = InstanceIndex % SqrtMaxInstances;
+								FVector PosX1 = xStart ? Instances[InstanceIndex - SqrtMaxInstances].Pos : Instance.Pos;
+								FVector PosX2 = (xStart + 1 < SqrtMaxInstances) ? Instances[InstanceIndex + SqrtMaxInstances].Pos : Instance.Pos;
+								FVector PosY1 = yStart ? Instances[InstanceIndex - 1].Pos : Instance.Pos;
+								FVector PosY2 = (yStart + 1 < SqrtMaxInstances) ? Instances[InstanceIndex + 1].Pos : Instance.Pos;
+
+								if (PosX1 != PosX2 && PosY1 != PosY2)
 								{
-									OutXForm = BaseXForm.ConcatTranslation(Instance.Pos) * XForm;
+									NewZ = ((PosX1 - PosX2) ^ (PosY1 - PosY2)).GetSafeNormal();
+									NewZ *= FMath::Sign(NewZ.Z);
 								}
-								InstanceTransforms[OutInstanceIndex] = OutXForm;
-								SetInstance(OutInstanceIndex++, OutXForm, RandomStream.GetFraction());
 							}
-							InstanceIndex++;
 						}
+
+						FMatrix& OutXForm = InstanceTransforms[OutInstanceIndex];
+						if (!NewZ.IsNearlyZero())
+						{
+							const FVector NewX = (FVector(0, -1, 0) ^ NewZ).GetSafeNormal();
+							const FVector NewY = NewZ ^ NewX;
+							const FMatrix Align = FMatrix(NewX, NewY, NewZ, FVector::ZeroVector);
+							OutXForm = (BaseXForm * Align).ConcatTranslation(Instance.Pos) * XForm;
+						}
+						else
+						{
+							OutXForm = BaseXForm.ConcatTranslation(Instance.Pos) * XForm;
+						}
+						if (!bLegacyHaltonOrder)
+						{
+							InstanceRandomIDs[OutInstanceIndex] = Tile.RandomStream.GetFraction();
+						}
+						OutInstanceIndex++;
+					}
+					check(OutInstanceIndex == Tile.FirstOutputIndex + Tile.NumKept);
+				}, ParallelForFlags);
+
+				// The legacy Halton path drew the random ids once all the instances were placed
+				if (bLegacyHaltonOrder)
+				{
+					for (int32 InstanceIndex = 0; InstanceIndex < NumKept; InstanceIndex++)
+					{
+						InstanceRandomIDs[InstanceIndex] = Tiles[0].RandomStream.GetFraction();
 					}
 				}
 			}
-		}
 
-		int32 NumInstances = InstanceTransforms.Num();
-		if (NumInstances)
-		{
-			TArray<int32> SortedInstances;
-			TArray<int32> InstanceReorderTable;
+			TArray<int32>& SortedInstances = Scratch->SortedInstances;
+			TArray<int32>& InstanceReorderTable = Scratch->InstanceReorderTable;
 			TArray<float> InstanceCustomDataDummy;
 			UGrassInstancedStaticMeshComponent::BuildTreeAnyThread(InstanceTransforms, InstanceCustomDataDummy, 0, MeshBox, ClusterTree, SortedInstances, InstanceReorderTable, OutOcclusionLayerNum, DesiredInstancesPerLeaf, false);
+			check(SortedInstances.Num() == NumKept);
 
-			// in-place sort the instances and generate the sorted instance data
-			for (int32 FirstUnfixedIndex = 0; FirstUnfixedIndex < NumInstances; FirstUnfixedIndex++)
 			{
-				int32 LoadFrom = SortedInstances[FirstUnfixedIndex];				
+				QUICK_SCOPE_CYCLE_COUNTER(STAT_FoliageGrassAsyncBuild_InstanceBuffer);
 
-				if (LoadFrom != FirstUnfixedIndex)
+				// Write the instances straight to their sorted slot rather than sorting the instance buffer in place
+				InstanceBuffer.AllocateInstances(NumKept, 0, EResizeBufferFlags::AllowSlackOnGrow | EResizeBufferFlags::AllowSlackOnReduce, true);
+				const int32 NumOutputTiles = FMath::DivideAndRoundUp(NumKept, InstancesPerTile);
+				ParallelFor(NumOutputTiles, [&](int32 TileIndex)
 				{
-					check(LoadFrom > FirstUnfixedIndex);
-					InstanceBuffer.SwapInstance(FirstUnfixedIndex, LoadFrom);
-
-					int32 SwapGoesTo = InstanceReorderTable[FirstUnfixedIndex];
-					check(SwapGoesTo > FirstUnfixedIndex);
-					check(SortedInstances[SwapGoesTo] == FirstUnfixedIndex);
-					SortedInstances[SwapGoesTo] = LoadFrom;
-					InstanceReorderTable[LoadFrom] = SwapGoesTo;
-
-					InstanceReorderTable[FirstUnfixedIndex] = FirstUnfixedIndex;
-					SortedInstances[FirstUnfixedIndex] = FirstUnfixedIndex;
-				}
+					const int32 FirstIndex = TileIndex * InstancesPerTile;
+					const int32 LastIndex = FMath::Min(FirstIndex + InstancesPerTile, NumKept);
+					for (int32 InstanceIndex = FirstIndex; InstanceIndex < LastIndex; InstanceIndex++)
+					{
+						const int32 LoadFrom = SortedInstances[InstanceIndex];
+						SetInstance(InstanceIndex, InstanceTransforms[LoadFrom], InstanceRandomIDs[LoadFrom]);
+					}
+				}, (bParallelBuild && NumOutputTiles > 1) ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
 			}
 		}
+
+		FGrassBuildScratchPool::Get().Release(MoveTemp(Scratch));
+
 		BuildTime = FPlatformTime::Seconds() - StartTime;
 	}
 
@@ -3089,6 +3255,8 @@ void ALandscapeProxy::ProcessAsyncGrassInstanceTasks(bool bWaitAsyncTasks, bool
 			}
 		}
 	}
+
+	FGrassBuildScratchPool::Get().Trim();
 }
 
 FAsyncGrassTask::FAsyncGrassTask(FAsyncGrassBuilder* InBuilder, const FCachedLandscapeFoliage::FGrassCompKey& InKey, UHierarchicalInstancedStaticMeshComponent* InFoliage)
@@ -3114,6 +3282,7 @@ static void FlushGrass(const TArray<FString>& Args)
 	{
 		Landscape->FlushGrassComponents();
 	}
+	FGrassBuildScratchPool::Get().Empty();
 }
 
 static void FlushGrassPIE(const TArray<FString>& Args)
@@ -3141,6 +3310,93 @@ static void DumpExclusionBoxes(const TArray<FString>& Args)
 	}
 }
 
+// Times building the grass of a synthetic landscape component single threaded and in parallel tiles, for the random and the halton placements
+static void BenchmarkGrassBuild(const TArray<FString>& Args)
+{
+	const int32 NumIterations = Args.Num() ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 4;
+
+	// A single component of the default size and scale, so that the timings don't depend on what is loaded
+	const int32 ComponentSizeQuads = 255;
+	const int32 Stride = ComponentSizeQuads + 1;
+
+	ALandscape* Landscape = NewObject<ALandscape>(GetTransientPackage(), NAME_None, RF_Transient);
+	ULandscapeComponent* Component = NewObject<ULandscapeComponent>(Landscape, NAME_None, RF_Transient);
+	Component->ComponentSizeQuads = ComponentSizeQuads;
+	Component->SubsectionSizeQuads = ComponentSizeQuads;
+	Component->NumSubsections = 1;
+	Component->SetSectionBase(FIntPoint::ZeroValue);
+
+	ULandscapeGrassType* GrassType = NewObject<ULandscapeGrassType>(GetTransientPackage(), NAME_None, RF_Transient);
+	FGrassVariety& GrassVariety = GrassType->GrassVarieties.AddDefaulted_GetRef();
+	GrassVariety.GrassMesh = NewObject<UStaticMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+	GrassVariety.ScaleX = FFloatInterval(0.8f, 1.2f);
+
+	// Rolling hills, with a weight layer that fades in and out so that part of the candidates are rejected
+	TArray<uint16> HeightData;
+	TArray<uint8> Weights;
+	HeightData.SetNumUninitialized(Stride * Stride);
+	Weights.SetNumUninitialized(Stride * Stride);
+	for (int32 Y = 0; Y < Stride; Y++)
+	{
+		for (int32 X = 0; X < Stride; X++)
+		{
+			const float Height = FMath::Sin(X * 0.05f) * FMath::Cos(Y * 0.07f);
+			HeightData[X + Y * Stride] = static_cast<uint16>(LandscapeDataAccess::MidValue + Height * 4096.0f);
+			Weights[X + Y * Stride] = static_cast<uint8>(255.0f * FMath::Clamp(0.5f + FMath::Sin((X + Y) * 0.03f), 0.0f, 1.0f));
+		}
+	}
+	TMap<ULandscapeGrassType*, TArray<uint8>> WeightData;
+	WeightData.Add(GrassType, MoveTemp(Weights));
+	Component->GrassData->InitializeFrom(HeightData, WeightData);
+
+	UGrassInstancedStaticMeshComponent* GrassInstancedStaticMeshComponent = NewObject<UGrassInstancedStaticMeshComponent>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	TArray<FBox> NoExcludedBoxes;
+	for (int32 Placement = 0; Placement < 2; Placement++)
+	{
+		// The grass of a component starts its halton sequence at 1, 0 gives the jittered random placement
+		const uint32 HaltonBaseIndex = Placement;
+
+		double SerialTime = 0.0;
+		double ParallelTime = 0.0;
+		int32 NumInstances = 0;
+		for (int32 Pass = 0; Pass < 2; Pass++)
+		{
+			const bool bParallel = Pass != 0;
+			for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+			{
+				FAsyncGrassBuilder Builder(Landscape, Component, GrassType, GrassVariety, GMaxRHIFeatureLevel, GrassInstancedStaticMeshComponent, 1, 0, 0, HaltonBaseIndex, NoExcludedBoxes);
+				check(Builder.bHaveValidData);
+				Builder.bParallelBuild = bParallel;
+				Builder.Build();
+
+				(bParallel ? ParallelTime : SerialTime) += Builder.BuildTime;
+				NumInstances = Builder.InstanceBuffer.GetNumInstances();
+			}
+		}
+
+		UE_LOG(LogGrass, Display, TEXT("Grass build benchmark, %s placement: %d iterations, %d instances. Single threaded %.2fms, parallel %.2fms (%.2fx), %.0f instances/sec"),
+			HaltonBaseIndex ? TEXT("halton") : TEXT("random"),
+			NumIterations,
+			NumInstances,
+			1000.0 * SerialTime / NumIterations,
+			1000.0 * ParallelTime / NumIterations,
+			ParallelTime > 0.0 ? SerialTime / ParallelTime : 0.0,
+			ParallelTime > 0.0 ? double(NumInstances) * NumIterations / ParallelTime : 0.0);
+	}
+
+	GrassInstancedStaticMeshComponent->MarkAsGarbage();
+	GrassVariety.GrassMesh->MarkAsGarbage();
+	GrassType->MarkAsGarbage();
+	Landscape->MarkAsGarbage();
+}
+
+static FAutoConsoleCommand BenchmarkGrassBuildCmd(
+	TEXT("grass.BenchmarkBuild"),
+	TEXT("Build the grass of a synthetic landscape component single threaded and in parallel, with the random and the halton placements, and print the timings. Optional argument: number of iterations."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkGrassBuild)
+	);
+
 static FAutoConsoleCommand FlushGrassCmd(
 	TEXT("grass.FlushCache"),
 	TEXT("Flush the grass cache, debugging."),